@@ -0,0 +1,345 @@
+/**
+ * @file TFFT.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TFFT class implementing the fast
+ * Fourier transform used by the spectral processing modules.
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TFFT.hpp"
+#include "TCore.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/************************
+ **   PUBLIC METHODS   **
+ ************************/
+
+TFFT::TFFT(const std::size_t size) : _size(size) {
+    if (!isPowerOfTwo(size)) {
+        throw SignalProcessingError("FFT size should be a power of two");
+    }
+
+    _twiddles.resize(size / 2);
+    for (std::size_t k = 0; k < size / 2; ++k) {
+        const double angle =
+            -TWO_PI * static_cast<double>(k) / static_cast<double>(size);
+        _twiddles[k] = {cos(angle), sin(angle)};
+    }
+
+    std::size_t bitsCount = 0;
+    while ((std::size_t{1} << bitsCount) < size) {
+        ++bitsCount;
+    }
+    _bitReverse.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::size_t reversed = 0;
+        for (std::size_t bit = 0; bit < bitsCount; ++bit) {
+            reversed |= ((i >> bit) & 1U) << (bitsCount - 1 - bit);
+        }
+        _bitReverse[i] = reversed;
+    }
+}
+
+std::size_t TFFT::getSize() const {
+    return _size;
+}
+
+void TFFT::forward(std::vector<std::complex<double>>& data) const {
+    if (data.size() != _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+    transform(data.data(), _size, false);
+}
+
+void TFFT::inverse(std::vector<std::complex<double>>& data) const {
+    if (data.size() != _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+    transform(data.data(), _size, true);
+
+    const double scale = 1.0 / static_cast<double>(_size);
+    for (auto& value : data) {
+        value *= scale;
+    }
+}
+
+void TFFT::forwardReal(const std::vector<double>&         input,
+                       std::vector<std::complex<double>>& output) const {
+    if (_size < 2) {
+        throw SignalProcessingError("Real FFT size should be at least two");
+    }
+    if (input.size() != _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+
+    // Pack the even samples into the real parts and the odd samples into the
+    // imaginary parts of a half-length sequence.
+    const std::size_t                 half = _size / 2;
+    std::vector<std::complex<double>> packed(half);
+    for (std::size_t n = 0; n < half; ++n) {
+        packed[n] = {input[2 * n], input[2 * n + 1]};
+    }
+    transform(packed.data(), half, false);
+
+    output.resize(half + 1);
+    unpackReal(packed.data(), output.data());
+}
+
+void TFFT::inverseReal(const std::vector<std::complex<double>>& input,
+                       std::vector<double>&                     output) const {
+    if (_size < 2) {
+        throw SignalProcessingError("Real FFT size should be at least two");
+    }
+    const std::size_t half = _size / 2;
+    if (input.size() != half + 1) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+
+    std::vector<std::complex<double>> packed(half);
+    packReal(input.data(), packed.data());
+    transform(packed.data(), half, true);
+
+    const double scale = 1.0 / static_cast<double>(half);
+    output.resize(_size);
+    for (std::size_t n = 0; n < half; ++n) {
+        output[2 * n]     = packed[n].real() * scale;
+        output[2 * n + 1] = packed[n].imag() * scale;
+    }
+}
+
+void TFFT::forwardBatch(std::vector<std::complex<double>>& data,
+                        const std::size_t                  count) const {
+    if (data.size() != count * _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+    transformBatch(data.data(), _size, count, false);
+}
+
+void TFFT::inverseBatch(std::vector<std::complex<double>>& data,
+                        const std::size_t                  count) const {
+    if (data.size() != count * _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+    transformBatch(data.data(), _size, count, true);
+
+    const double scale = 1.0 / static_cast<double>(_size);
+    for (auto& value : data) {
+        value *= scale;
+    }
+}
+
+void TFFT::forwardRealBatch(const std::vector<double>&         input,
+                            const std::size_t                  count,
+                            std::vector<std::complex<double>>& output) const {
+    if (_size < 2) {
+        throw SignalProcessingError("Real FFT size should be at least two");
+    }
+    if (input.size() != count * _size) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+
+    const std::size_t                 half = _size / 2;
+    std::vector<std::complex<double>> packed(count * half);
+    for (std::size_t n = 0; n < count * half; ++n) {
+        packed[n] = {input[2 * n], input[2 * n + 1]};
+    }
+    transformBatch(packed.data(), half, count, false);
+
+    output.resize(count * (half + 1));
+    for (std::size_t c = 0; c < count; ++c) {
+        unpackReal(packed.data() + c * half, output.data() + c * (half + 1));
+    }
+}
+
+void TFFT::inverseRealBatch(const std::vector<std::complex<double>>& input,
+                            const std::size_t                        count,
+                            std::vector<double>& output) const {
+    if (_size < 2) {
+        throw SignalProcessingError("Real FFT size should be at least two");
+    }
+    const std::size_t half = _size / 2;
+    if (input.size() != count * (half + 1)) {
+        throw SignalProcessingError("FFT data size does not match the plan");
+    }
+
+    std::vector<std::complex<double>> packed(count * half);
+    for (std::size_t c = 0; c < count; ++c) {
+        packReal(input.data() + c * (half + 1), packed.data() + c * half);
+    }
+    transformBatch(packed.data(), half, count, true);
+
+    const double scale = 1.0 / static_cast<double>(half);
+    output.resize(count * _size);
+    for (std::size_t n = 0; n < count * half; ++n) {
+        output[2 * n]     = packed[n].real() * scale;
+        output[2 * n + 1] = packed[n].imag() * scale;
+    }
+}
+
+/************************
+ **   STATIC METHODS   **
+ ************************/
+
+bool TFFT::isPowerOfTwo(const std::size_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+std::size_t TFFT::nextPowerOfTwo(const std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1U;
+    }
+    return result;
+}
+
+/*************************
+ **   PRIVATE METHODS   **
+ *************************/
+
+void TFFT::transform(std::complex<double>* data,
+                     const std::size_t     size,
+                     const bool            inverse) const {
+    const std::size_t permutationStride = _size / size;
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::size_t reversed = _bitReverse[i * permutationStride];
+        if (i < reversed) {
+            std::swap(data[i], data[reversed]);
+        }
+    }
+
+    // Iterative radix-2 decimation-in-time butterflies
+    for (std::size_t length = 2; length <= size; length <<= 1U) {
+        const std::size_t half   = length / 2;
+        const std::size_t stride = _size / length;
+        for (std::size_t start = 0; start < size; start += length) {
+            for (std::size_t k = 0; k < half; ++k) {
+                // The product is expanded by hand to avoid the NaN-aware
+                // complex multiplication of the standard library.
+                const double twiddleRe = _twiddles[k * stride].real();
+                const double twiddleIm = inverse
+                                             ? -_twiddles[k * stride].imag()
+                                             : _twiddles[k * stride].imag();
+                const std::complex<double> even  = data[start + k];
+                const std::complex<double> value = data[start + k + half];
+                const std::complex<double> odd = {
+                    value.real() * twiddleRe - value.imag() * twiddleIm,
+                    value.real() * twiddleIm + value.imag() * twiddleRe};
+                data[start + k]        = even + odd;
+                data[start + k + half] = even - odd;
+            }
+        }
+    }
+}
+
+void TFFT::transformBatch(std::complex<double>* data,
+                          const std::size_t     size,
+                          const std::size_t     count,
+                          const bool            inverse) const {
+    constexpr std::size_t lanes = FFT::BATCH_LANES;
+    const std::size_t     permutationStride = _size / size;
+
+    // The signals of a group are transposed into separate real and imaginary
+    // arrays with the lanes innermost, so every butterfly below operates on
+    // `lanes` contiguous values.
+    std::vector<double> real(size * lanes, 0.0);
+    std::vector<double> imag(size * lanes, 0.0);
+
+    for (std::size_t group = 0; group < count; group += lanes) {
+        const std::size_t used = std::min(lanes, count - group);
+        if (used < lanes) {
+            std::fill(real.begin(), real.end(), 0.0);
+            std::fill(imag.begin(), imag.end(), 0.0);
+        }
+        for (std::size_t b = 0; b < used; ++b) {
+            const std::complex<double>* signal = data + (group + b) * size;
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t reversed = _bitReverse[i * permutationStride];
+                real[reversed * lanes + b] = signal[i].real();
+                imag[reversed * lanes + b] = signal[i].imag();
+            }
+        }
+
+        for (std::size_t length = 2; length <= size; length <<= 1U) {
+            const std::size_t half   = length / 2;
+            const std::size_t stride = _size / length;
+            for (std::size_t start = 0; start < size; start += length) {
+                for (std::size_t k = 0; k < half; ++k) {
+                    const double twiddleRe = _twiddles[k * stride].real();
+                    const double twiddleIm =
+                        inverse ? -_twiddles[k * stride].imag()
+                                : _twiddles[k * stride].imag();
+                    double* evenRe = real.data() + (start + k) * lanes;
+                    double* evenIm = imag.data() + (start + k) * lanes;
+                    double* oddRe  = real.data() + (start + k + half) * lanes;
+                    double* oddIm  = imag.data() + (start + k + half) * lanes;
+                    for (std::size_t b = 0; b < lanes; ++b) {
+                        const double productRe =
+                            oddRe[b] * twiddleRe - oddIm[b] * twiddleIm;
+                        const double productIm =
+                            oddRe[b] * twiddleIm + oddIm[b] * twiddleRe;
+                        oddRe[b]  = evenRe[b] - productRe;
+                        oddIm[b]  = evenIm[b] - productIm;
+                        evenRe[b] = evenRe[b] + productRe;
+                        evenIm[b] = evenIm[b] + productIm;
+                    }
+                }
+            }
+        }
+
+        for (std::size_t b = 0; b < used; ++b) {
+            std::complex<double>* signal = data + (group + b) * size;
+            for (std::size_t i = 0; i < size; ++i) {
+                signal[i] = {real[i * lanes + b], imag[i * lanes + b]};
+            }
+        }
+    }
+}
+
+void TFFT::unpackReal(const std::complex<double>* packed,
+                      std::complex<double>*       output) const {
+    // With Z the transform of z[n] = x[2n] + i*x[2n+1], the transforms of the
+    // even and odd samples are E[k] = (Z[k] + conj(Z[H-k])) / 2 and
+    // O[k] = (Z[k] - conj(Z[H-k])) / 2i, and X[k] = E[k] + W^k * O[k].
+    const std::size_t half = _size / 2;
+    for (std::size_t k = 0; k <= half; ++k) {
+        const std::size_t          mirrorIndex = (half - k) % half;
+        const std::complex<double> current     = packed[k % half];
+        const std::complex<double> mirror      = std::conj(packed[mirrorIndex]);
+        const std::complex<double> even        = (current + mirror) * 0.5;
+        const std::complex<double> diff        = current - mirror;
+        const std::complex<double> odd         = {diff.imag() * 0.5,
+                                                  -diff.real() * 0.5};
+        const std::complex<double> twiddle =
+            k < half ? _twiddles[k] : std::complex<double>{-1.0, 0.0};
+        output[k] = {even.real() + twiddle.real() * odd.real() -
+                         twiddle.imag() * odd.imag(),
+                     even.imag() + twiddle.real() * odd.imag() +
+                         twiddle.imag() * odd.real()};
+    }
+}
+
+void TFFT::packReal(const std::complex<double>* input,
+                    std::complex<double>*       packed) const {
+    // Inverse of unpackReal: E[k] = (X[k] + conj(X[H-k])) / 2,
+    // O[k] = (X[k] - conj(X[H-k])) * conj(W^k) / 2 and Z[k] = E[k] + i*O[k].
+    const std::size_t half = _size / 2;
+    for (std::size_t k = 0; k < half; ++k) {
+        const std::complex<double> current = input[k];
+        const std::complex<double> mirror  = std::conj(input[half - k]);
+        const std::complex<double> even    = (current + mirror) * 0.5;
+        const std::complex<double> diff    = (current - mirror) * 0.5;
+        const std::complex<double> twiddle = std::conj(_twiddles[k]);
+        const std::complex<double> odd     = {
+            diff.real() * twiddle.real() - diff.imag() * twiddle.imag(),
+            diff.real() * twiddle.imag() + diff.imag() * twiddle.real()};
+        packed[k] = {even.real() - odd.imag(), even.imag() + odd.real()};
+    }
+}
\ No newline at end of file
@@ -0,0 +1,262 @@
+/**
+ * @file TFFT.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TFFT class implementing the fast
+ * Fourier transform used by the spectral processing modules.
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @namespace FFT
+ * @brief Contains parameters of the FFT engine.
+ */
+namespace FFT {
+
+    static constexpr std::size_t BATCH_LANES =
+        8;  ///< Number of transforms processed side by side by the batched
+            ///< transforms.
+
+}  // namespace FFT
+
+/**
+ * @class TFFT
+ * @brief Precomputed plan of a radix-2 fast Fourier transform of a fixed size.
+ *
+ * @details The plan stores the twiddle factors and the bit-reversal
+ * permutation of the transform size, so it can be created once and reused for
+ * any number of transforms. Transforms are performed in place. The forward
+ * transform is unscaled, and the inverse transform is scaled by `1 / size`, so
+ * `inverse(forward(x)) == x`. The plan is immutable after construction and can
+ * be shared between threads.
+ *
+ * Real signals are transformed with the half-length packing trick: the even
+ * and odd samples are packed into one complex sequence of half the size, and
+ * the spectrum (`size / 2 + 1` bins) is recovered from its half-size
+ * transform. The batched transforms process `FFT::BATCH_LANES` equal-size
+ * transforms side by side, so every butterfly is vectorized across transforms
+ * and the per-call overhead is paid once per batch.
+ */
+class TFFT {
+   public:
+    /**
+     * @brief Constructs an FFT plan of the specified size.
+     *
+     * @param size Transform size (must be a power of two).
+     *
+     * @throws SignalProcessingError If the size is not a power of two.
+     */
+    explicit TFFT(std::size_t size);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TFFT() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TFFT(const TFFT&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TFFT(TFFT&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TFFT& operator=(const TFFT&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TFFT& operator=(TFFT&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the transform size.
+     *
+     * @return std::size_t The transform size.
+     */
+    [[nodiscard]] std::size_t getSize() const;
+
+    /**
+     * @brief Performs the forward transform in place.
+     *
+     * @param data Data to transform (must contain exactly `getSize()` values).
+     *
+     * @throws SignalProcessingError If the data size does not match the plan.
+     */
+    void forward(std::vector<std::complex<double>>& data) const;
+
+    /**
+     * @brief Performs the inverse transform in place (scaled by `1 / size`).
+     *
+     * @param data Data to transform (must contain exactly `getSize()` values).
+     *
+     * @throws SignalProcessingError If the data size does not match the plan.
+     */
+    void inverse(std::vector<std::complex<double>>& data) const;
+
+    /**
+     * @brief Performs the forward transform of a real signal.
+     *
+     * @param input Real samples (must contain exactly `getSize()` values).
+     * @param output Receives the non-negative frequency bins
+     * (`getSize() / 2 + 1` values); the remaining bins are their complex
+     * conjugates.
+     *
+     * @throws SignalProcessingError If the plan size is less than two or the
+     * input size does not match the plan.
+     */
+    void forwardReal(const std::vector<double>&         input,
+                     std::vector<std::complex<double>>& output) const;
+
+    /**
+     * @brief Performs the inverse transform of a spectrum of a real signal
+     * (scaled by `1 / size`).
+     *
+     * @param input Non-negative frequency bins (must contain exactly
+     * `getSize() / 2 + 1` values).
+     * @param output Receives the real samples (`getSize()` values).
+     *
+     * @throws SignalProcessingError If the plan size is less than two or the
+     * input size does not match the plan.
+     */
+    void inverseReal(const std::vector<std::complex<double>>& input,
+                     std::vector<double>&                     output) const;
+
+    /**
+     * @brief Performs the forward transform of several signals in place.
+     *
+     * @param data Consecutive signals of `getSize()` values each.
+     * @param count Number of signals.
+     *
+     * @throws SignalProcessingError If the data size is not `count` times the
+     * plan size.
+     */
+    void forwardBatch(std::vector<std::complex<double>>& data,
+                      std::size_t                        count) const;
+
+    /**
+     * @brief Performs the inverse transform of several spectra in place
+     * (scaled by `1 / size`).
+     *
+     * @param data Consecutive spectra of `getSize()` values each.
+     * @param count Number of spectra.
+     *
+     * @throws SignalProcessingError If the data size is not `count` times the
+     * plan size.
+     */
+    void inverseBatch(std::vector<std::complex<double>>& data,
+                      std::size_t                        count) const;
+
+    /**
+     * @brief Performs the forward transform of several real signals.
+     *
+     * @param input Consecutive real signals of `getSize()` values each.
+     * @param count Number of signals.
+     * @param output Receives consecutive spectra of `getSize() / 2 + 1` values
+     * each.
+     *
+     * @throws SignalProcessingError If the plan size is less than two or the
+     * input size is not `count` times the plan size.
+     */
+    void forwardRealBatch(const std::vector<double>&         input,
+                          std::size_t                        count,
+                          std::vector<std::complex<double>>& output) const;
+
+    /**
+     * @brief Performs the inverse transform of several spectra of real signals
+     * (scaled by `1 / size`).
+     *
+     * @param input Consecutive spectra of `getSize() / 2 + 1` values each.
+     * @param count Number of spectra.
+     * @param output Receives consecutive real signals of `getSize()` values
+     * each.
+     *
+     * @throws SignalProcessingError If the plan size is less than two or the
+     * input size is not `count` times the spectrum size.
+     */
+    void inverseRealBatch(const std::vector<std::complex<double>>& input,
+                          std::size_t                              count,
+                          std::vector<double>& output) const;
+
+    /**
+     * @brief Checks whether a value is a power of two.
+     *
+     * @param value The value to check.
+     * @return true If the value is a power of two; false otherwise.
+     */
+    [[nodiscard]] static bool isPowerOfTwo(std::size_t value);
+
+    /**
+     * @brief Finds the smallest power of two not less than a value.
+     *
+     * @param value The value to round up.
+     * @return std::size_t The smallest power of two not less than `value`.
+     */
+    [[nodiscard]] static std::size_t nextPowerOfTwo(std::size_t value);
+
+   private:
+    std::size_t _size = 0;  ///< Transform size.
+    std::vector<std::complex<double>>
+        _twiddles;  ///< Twiddle factors exp(-2*pi*i*k/size), k < size/2.
+    std::vector<std::size_t>
+        _bitReverse;  ///< Bit-reversal permutation of the transform size.
+
+    /**
+     * @brief Performs the unscaled transform in place.
+     * @details Any power of two not greater than the plan size is supported,
+     * since the twiddle factors and the bit-reversal permutation of a smaller
+     * size are strided subsets of those of the plan.
+     *
+     * @param data Pointer to `size` values to transform.
+     * @param size Transform size.
+     * @param inverse If true, the conjugate twiddle factors are used.
+     */
+    void transform(std::complex<double>* data,
+                   std::size_t           size,
+                   bool                  inverse) const;
+
+    /**
+     * @brief Performs unscaled transforms of several signals in place,
+     * `FFT::BATCH_LANES` signals side by side.
+     *
+     * @param data Pointer to `count` consecutive signals of `size` values.
+     * @param size Transform size.
+     * @param count Number of signals.
+     * @param inverse If true, the conjugate twiddle factors are used.
+     */
+    void transformBatch(std::complex<double>* data,
+                        std::size_t           size,
+                        std::size_t           count,
+                        bool                  inverse) const;
+
+    /**
+     * @brief Recovers the spectrum of a real signal from the transform of its
+     * packed half-length sequence.
+     *
+     * @param packed Transform of the packed sequence (`size / 2` values).
+     * @param output Pointer to `size / 2 + 1` output bins.
+     */
+    void unpackReal(const std::complex<double>* packed,
+                    std::complex<double>*       output) const;
+
+    /**
+     * @brief Builds the packed half-length spectrum whose inverse transform
+     * interleaves the even and odd samples of a real signal.
+     *
+     * @param input Pointer to `size / 2 + 1` bins of the real signal.
+     * @param packed Pointer to `size / 2` packed values.
+     */
+    void packReal(const std::complex<double>* input,
+                  std::complex<double>*       packed) const;
+};
\ No newline at end of file
@@ -0,0 +1,906 @@
+/**
+ * @file TFilterDesign.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the FIR and IIR filter design
+ * routines and the design cache.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TFilterDesign.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using Complex = std::complex<double>;
+
+    /**
+     * @struct ZeroPoleGain
+     * @brief Filter given by its zeros, poles and gain.
+     */
+    struct ZeroPoleGain {
+        std::vector<Complex> zeros = {};  ///< Zeros of the transfer function.
+        std::vector<Complex> poles = {};  ///< Poles of the transfer function.
+        double               gain  = 1.0;  ///< Overall gain.
+    };
+
+    /**
+     * @class DesignCache
+     * @brief Thread-safe map from specifications to shared designs.
+     */
+    template <typename Spec, typename Design>
+    class DesignCache {
+       public:
+        template <typename Designer>
+        std::shared_ptr<const Design> get(const Spec&  spec,
+                                          Designer&& designer) {
+            {
+                const std::lock_guard lock(_mutex);
+                const auto            found = _designs.find(spec);
+                if (found != _designs.end()) {
+                    return found->second;
+                }
+            }
+            // Designing may take long, so other specifications are served
+            // meanwhile; a concurrent design of the same one is discarded
+            auto design = std::make_shared<const Design>(designer(spec));
+            const std::lock_guard lock(_mutex);
+            return _designs.try_emplace(spec, std::move(design)).first->second;
+        }
+
+        void clear() {
+            const std::lock_guard lock(_mutex);
+            _designs.clear();
+        }
+
+       private:
+        std::mutex _mutex;  ///< Guards the map.
+        std::map<Spec, std::shared_ptr<const Design>>
+            _designs;  ///< Designs by specification.
+    };
+
+    DesignCache<TWindowedSincSpec, std::vector<double>>
+        windowedSincCache;  ///< Cache of windowed-sinc designs.
+    DesignCache<TEquirippleSpec, std::vector<double>>
+        equirippleCache;  ///< Cache of Parks-McClellan designs.
+    DesignCache<TIIRSpec, std::vector<TBiquad>>
+        iirCache;  ///< Cache of IIR designs.
+
+    /*
+     * Parks-McClellan
+     */
+
+    /**
+     * @brief Computes the barycentric weights of interpolation nodes.
+     * @details The weights are only needed up to a common factor, so they are
+     * accumulated as logarithms and scaled to avoid overflow for long filters.
+     *
+     * @param nodes Interpolation nodes.
+     * @return std::vector<double> The weights.
+     */
+    std::vector<double> barycentricWeights(const std::vector<double>& nodes) {
+        const std::size_t   count = nodes.size();
+        std::vector<double> logarithms(count, 0.0);
+        std::vector<bool>   negative(count, false);
+        for (std::size_t j = 0; j < count; ++j) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (i != j) {
+                    const double difference = 2.0 * (nodes[j] - nodes[i]);
+                    logarithms[j] += log(std::abs(difference));
+                    negative[j] = negative[j] != (difference < 0.0);
+                }
+            }
+        }
+        const double smallest =
+            *std::min_element(logarithms.begin(), logarithms.end());
+        std::vector<double> weights(count);
+        for (std::size_t j = 0; j < count; ++j) {
+            const double magnitude = exp(smallest - logarithms[j]);
+            weights[j]             = negative[j] ? -magnitude : magnitude;
+        }
+        return weights;
+    }
+
+    /**
+     * @brief Evaluates the barycentric interpolant at a point.
+     *
+     * @param nodes Interpolation nodes.
+     * @param weights Barycentric weights of the nodes.
+     * @param values Values at the nodes.
+     * @param point The point.
+     * @return double The interpolated value.
+     */
+    double interpolate(const std::vector<double>& nodes,
+                       const std::vector<double>& weights,
+                       const std::vector<double>& values,
+                       const double               point) {
+        double numerator   = 0.0;
+        double denominator = 0.0;
+        for (std::size_t j = 0; j < nodes.size(); ++j) {
+            const double difference = point - nodes[j];
+            if (difference == 0.0) {
+                return values[j];
+            }
+            const double factor = weights[j] / difference;
+            numerator += factor * values[j];
+            denominator += factor;
+        }
+        return numerator / denominator;
+    }
+
+    /**
+     * @brief Selects the alternating extrema of the grid error.
+     *
+     * @param error Weighted error on the grid.
+     * @param bandStarts Index of the first grid point of every band.
+     * @param count Number of extrema required.
+     * @return std::vector<std::size_t> Indices of the extrema (fewer than
+     * `count` if the error does not alternate enough).
+     */
+    std::vector<std::size_t> findExtrema(
+        const std::vector<double>&      error,
+        const std::vector<std::size_t>& bandStarts,
+        const std::size_t               count) {
+        // Local extrema of every band, the band edges included
+        std::vector<std::size_t> candidates;
+        for (std::size_t b = 0; b < bandStarts.size(); ++b) {
+            const std::size_t first = bandStarts[b];
+            const std::size_t last  = b + 1 < bandStarts.size()
+                                          ? bandStarts[b + 1] - 1
+                                          : error.size() - 1;
+            for (std::size_t i = first; i <= last; ++i) {
+                const double value    = std::abs(error[i]);
+                const bool   previous = i == first ||
+                                      value >= std::abs(error[i - 1]) ||
+                                      (error[i] > 0.0) != (error[i - 1] > 0.0);
+                const bool next = i == last || value > std::abs(error[i + 1]) ||
+                                  (error[i] > 0.0) != (error[i + 1] > 0.0);
+                if (previous && next) {
+                    candidates.push_back(i);
+                }
+            }
+        }
+
+        // Consecutive extrema of the same sign are merged into the largest
+        std::vector<std::size_t> extrema;
+        for (const std::size_t index : candidates) {
+            if (!extrema.empty() &&
+                (error[extrema.back()] > 0.0) == (error[index] > 0.0)) {
+                if (std::abs(error[index]) > std::abs(error[extrema.back()])) {
+                    extrema.back() = index;
+                }
+            } else {
+                extrema.push_back(index);
+            }
+        }
+
+        // Superfluous extrema are dropped from the ends, the smaller first
+        std::size_t begin = 0;
+        std::size_t end   = extrema.size();
+        while (end - begin > count) {
+            if (std::abs(error[extrema[begin]]) <
+                std::abs(error[extrema[end - 1]])) {
+                ++begin;
+            } else {
+                --end;
+            }
+        }
+        return {extrema.begin() + static_cast<std::ptrdiff_t>(begin),
+                extrema.begin() + static_cast<std::ptrdiff_t>(end)};
+    }
+
+    /*
+     * IIR
+     */
+
+    /**
+     * @brief Computes the descending Landen sequence of an elliptic modulus.
+     *
+     * @param modulus The modulus `k` within [0, 1).
+     * @return std::vector<double> The moduli `k_1, k_2, ...` down to
+     * negligible ones.
+     */
+    std::vector<double> landen(double modulus) {
+        std::vector<double> moduli;
+        while (modulus > 1e-15 && moduli.size() < 16) {
+            const double complement = sqrt(1.0 - modulus * modulus);
+            modulus                 = modulus / (1.0 + complement);
+            modulus *= modulus;
+            moduli.push_back(modulus);
+        }
+        return moduli;
+    }
+
+    /**
+     * @brief Computes the Jacobi elliptic function `cd(u * K, k)`.
+     *
+     * @param u Argument normalized by the quarter period `K`.
+     * @param modulus The modulus `k`.
+     * @return Complex The function value.
+     */
+    Complex jacobiCd(const Complex u, const double modulus) {
+        const auto moduli = landen(modulus);
+        Complex    value  = std::cos(u * M_PI / 2.0);
+        for (auto it = moduli.rbegin(); it != moduli.rend(); ++it) {
+            value = (1.0 + *it) * value / (1.0 + *it * value * value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Computes the Jacobi elliptic function `sn(u * K, k)`.
+     *
+     * @param u Argument normalized by the quarter period `K`.
+     * @param modulus The modulus `k`.
+     * @return Complex The function value.
+     */
+    Complex jacobiSn(const Complex u, const double modulus) {
+        const auto moduli = landen(modulus);
+        Complex    value  = std::sin(u * M_PI / 2.0);
+        for (auto it = moduli.rbegin(); it != moduli.rend(); ++it) {
+            value = (1.0 + *it) * value / (1.0 + *it * value * value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Inverts `sn(u * K, k) = w` for the normalized argument `u`.
+     *
+     * @param w The function value.
+     * @param modulus The modulus `k`.
+     * @return Complex The normalized argument.
+     */
+    Complex inverseJacobiSn(Complex w, const double modulus) {
+        const auto moduli   = landen(modulus);
+        double     previous = modulus;
+        for (const double current : moduli) {
+            w = w / (1.0 + std::sqrt(1.0 - w * w * previous * previous)) *
+                2.0 / (1.0 + current);
+            previous = current;
+        }
+        // sn = cd shifted by one quarter period
+        return 1.0 - 2.0 / M_PI * std::acos(w);
+    }
+
+    /**
+     * @brief Solves the degree equation of an elliptic filter for the
+     * selectivity modulus.
+     *
+     * @param order Filter order.
+     * @param discrimination The modulus `k1 = eps_p / eps_s`.
+     * @return double The selectivity modulus `k = wp / ws`.
+     */
+    double solveDegree(const std::size_t order, const double discrimination) {
+        const double complement = sqrt(1.0 - discrimination * discrimination);
+        double       product    = 1.0;
+        for (std::size_t i = 1; i <= order / 2; ++i) {
+            const double u = static_cast<double>(2 * i - 1) /
+                             static_cast<double>(order);
+            product *= jacobiSn(u, complement).real();
+        }
+        const double selectivityComplement =
+            std::pow(complement, static_cast<double>(order)) *
+            std::pow(product, 4.0);
+        return sqrt(1.0 - selectivityComplement * selectivityComplement);
+    }
+
+    /**
+     * @brief Creates the normalized analog low-pass prototype.
+     *
+     * @param spec Filter specification.
+     * @return ZeroPoleGain The prototype with the edge at 1 rad/s.
+     */
+    ZeroPoleGain makePrototype(const TIIRSpec& spec) {
+        const std::size_t order = spec.order;
+        const double      n     = static_cast<double>(order);
+        const double      passbandEpsilon =
+            sqrt(pow(10.0, spec.passbandRipple / 10.0) - 1.0);
+        const double stopbandEpsilon =
+            sqrt(pow(10.0, spec.stopbandAttenuation / 10.0) - 1.0);
+
+        ZeroPoleGain prototype;
+        switch (spec.prototype) {
+            case FDES::Prototype::Butterworth:
+            case FDES::Prototype::Chebyshev1:
+            case FDES::Prototype::Chebyshev2: {
+                // Chebyshev II poles are the inverted Chebyshev I poles
+                const bool   inverse = spec.prototype ==
+                                     FDES::Prototype::Chebyshev2;
+                const double mu =
+                    spec.prototype == FDES::Prototype::Chebyshev1
+                        ? asinh(1.0 / passbandEpsilon) / n
+                        : asinh(stopbandEpsilon) / n;
+                for (std::size_t k = 1; k <= order; ++k) {
+                    const double theta =
+                        M_PI * static_cast<double>(2 * k - 1) / (2.0 * n);
+                    Complex pole = {-sin(theta), cos(theta)};
+                    if (spec.prototype != FDES::Prototype::Butterworth) {
+                        pole = {-sinh(mu) * sin(theta), cosh(mu) * cos(theta)};
+                    }
+                    prototype.poles.push_back(inverse ? 1.0 / pole : pole);
+                    if (inverse && 2 * k - 1 != order) {
+                        prototype.zeros.emplace_back(0.0, 1.0 / cos(theta));
+                    }
+                }
+                break;
+            }
+            case FDES::Prototype::Elliptic: {
+                const double discrimination = passbandEpsilon / stopbandEpsilon;
+                const double selectivity = solveDegree(order, discrimination);
+                const Complex offset =
+                    -Complex(0.0, 1.0) *
+                    inverseJacobiSn(Complex(0.0, 1.0 / passbandEpsilon),
+                                    discrimination) /
+                    n;
+                for (std::size_t i = 1; i <= order / 2; ++i) {
+                    const double u = static_cast<double>(2 * i - 1) / n;
+                    const Complex zeta = jacobiCd(u, selectivity);
+                    const Complex zero = Complex(0.0, 1.0) /
+                                         (selectivity * zeta);
+                    const Complex pole =
+                        Complex(0.0, 1.0) *
+                        jacobiCd(u - Complex(0.0, 1.0) * offset, selectivity);
+                    prototype.zeros.push_back(zero);
+                    prototype.zeros.push_back(std::conj(zero));
+                    prototype.poles.push_back(pole);
+                    prototype.poles.push_back(std::conj(pole));
+                }
+                if (order % 2 == 1) {
+                    prototype.poles.emplace_back(
+                        (Complex(0.0, 1.0) *
+                         jacobiSn(Complex(0.0, 1.0) * offset, selectivity))
+                            .real(),
+                        0.0);
+                }
+                break;
+            }
+            default:
+                throw SignalProcessingError("Invalid filter prototype");
+        }
+
+        // Unit gain at zero frequency, or the bottom of the ripple for the
+        // even-order filters with an equiripple passband
+        Complex product = 1.0;
+        for (const auto& pole : prototype.poles) {
+            product *= -pole;
+        }
+        for (const auto& zero : prototype.zeros) {
+            product /= -zero;
+        }
+        prototype.gain = product.real();
+        if (order % 2 == 0 &&
+            (spec.prototype == FDES::Prototype::Chebyshev1 ||
+             spec.prototype == FDES::Prototype::Elliptic)) {
+            prototype.gain /= sqrt(1.0 + passbandEpsilon * passbandEpsilon);
+        }
+        return prototype;
+    }
+
+    /**
+     * @brief Transforms the normalized low-pass prototype to the requested
+     * response at the prewarped analog edges.
+     *
+     * @param prototype The prototype; transformed in place.
+     * @param response Requested response.
+     * @param lower Prewarped (lower) edge, in rad/s.
+     * @param upper Prewarped upper edge of band filters, in rad/s.
+     */
+    void transform(ZeroPoleGain&        prototype,
+                   const FDES::Response response,
+                   const double         lower,
+                   const double         upper) {
+        auto&             zeros  = prototype.zeros;
+        auto&             poles  = prototype.poles;
+        const std::size_t degree = poles.size() - zeros.size();
+
+        Complex ratio = 1.0;  // prod(-z) / prod(-p)
+        for (const auto& zero : zeros) {
+            ratio *= -zero;
+        }
+        for (const auto& pole : poles) {
+            ratio /= -pole;
+        }
+
+        switch (response) {
+            case FDES::Response::LowPass:
+                for (auto& zero : zeros) {
+                    zero *= lower;
+                }
+                for (auto& pole : poles) {
+                    pole *= lower;
+                }
+                prototype.gain *= pow(lower, static_cast<double>(degree));
+                break;
+            case FDES::Response::HighPass:
+                for (auto& zero : zeros) {
+                    zero = lower / zero;
+                }
+                for (auto& pole : poles) {
+                    pole = lower / pole;
+                }
+                zeros.insert(zeros.end(), degree, 0.0);
+                prototype.gain *= ratio.real();
+                break;
+            case FDES::Response::BandPass:
+            case FDES::Response::BandStop: {
+                const bool   stop      = response == FDES::Response::BandStop;
+                const double bandwidth = upper - lower;
+                const double centerSquare = lower * upper;
+                const auto split = [&](const std::vector<Complex>& roots) {
+                    std::vector<Complex> result;
+                    for (const auto& root : roots) {
+                        const Complex scaled = stop ? bandwidth / 2.0 / root
+                                                    : root * bandwidth / 2.0;
+                        const Complex offset =
+                            std::sqrt(scaled * scaled - centerSquare);
+                        result.push_back(scaled + offset);
+                        result.push_back(scaled - offset);
+                    }
+                    return result;
+                };
+                zeros = split(zeros);
+                poles = split(poles);
+                if (stop) {
+                    const double center = sqrt(centerSquare);
+                    for (std::size_t i = 0; i < degree; ++i) {
+                        zeros.emplace_back(0.0, center);
+                        zeros.emplace_back(0.0, -center);
+                    }
+                    prototype.gain *= ratio.real();
+                } else {
+                    zeros.insert(zeros.end(), degree, 0.0);
+                    prototype.gain *=
+                        pow(bandwidth, static_cast<double>(degree));
+                }
+                break;
+            }
+            default:
+                throw SignalProcessingError("Invalid filter response");
+        }
+    }
+
+    /**
+     * @brief Maps an analog filter to a digital one by the bilinear transform
+     * `s = 2 * (z - 1) / (z + 1)` (unit sampling frequency).
+     *
+     * @param filter The filter; mapped in place.
+     */
+    void bilinear(ZeroPoleGain& filter) {
+        const std::size_t degree = filter.poles.size() - filter.zeros.size();
+        Complex           ratio  = 1.0;
+        for (auto& zero : filter.zeros) {
+            ratio *= 2.0 - zero;
+            zero = (2.0 + zero) / (2.0 - zero);
+        }
+        for (auto& pole : filter.poles) {
+            ratio /= 2.0 - pole;
+            pole = (2.0 + pole) / (2.0 - pole);
+        }
+        filter.zeros.insert(filter.zeros.end(), degree, -1.0);
+        filter.gain *= ratio.real();
+    }
+
+    /**
+     * @brief Splits roots into conjugate pairs (one of each) and real roots.
+     *
+     * @param roots The roots of a real polynomial.
+     * @param pairs Receives the roots with a positive imaginary part.
+     * @param reals Receives the real parts of the real roots.
+     */
+    void splitRoots(const std::vector<Complex>& roots,
+                    std::vector<Complex>&       pairs,
+                    std::vector<double>&        reals) {
+        for (const auto& root : roots) {
+            const double tolerance = 1e-10 * std::max(1.0, std::abs(root));
+            if (std::abs(root.imag()) <= tolerance) {
+                reals.push_back(root.real());
+            } else if (root.imag() > 0.0) {
+                pairs.push_back(root);
+            }
+        }
+    }
+
+    /**
+     * @brief Pairs the zeros and poles of a digital filter into sections.
+     *
+     * @param filter The digital filter (as many zeros as poles).
+     * @return std::vector<TBiquad> The sections.
+     */
+    std::vector<TBiquad> makeSections(const ZeroPoleGain& filter) {
+        std::vector<Complex> polePairs;
+        std::vector<double>  realPoles;
+        std::vector<Complex> zeroPairs;
+        std::vector<double>  realZeros;
+        splitRoots(filter.poles, polePairs, realPoles);
+        splitRoots(filter.zeros, zeroPairs, realZeros);
+
+        // Pole groups: conjugate pairs and real poles two by two (the ones
+        // closest to the unit circle together); a single real pole of an odd
+        // order is taken first so that a real zero is left for it
+        std::sort(realPoles.begin(), realPoles.end(),
+                  [](const double a, const double b) {
+                      return std::abs(a) > std::abs(b);
+                  });
+        std::vector<std::vector<Complex>> groups;
+        if (realPoles.size() % 2 == 1) {
+            groups.push_back({realPoles.back()});
+        }
+        for (const auto& pole : polePairs) {
+            groups.push_back({pole, std::conj(pole)});
+        }
+        for (std::size_t i = 0; i + 1 < realPoles.size(); i += 2) {
+            groups.push_back({realPoles[i], realPoles[i + 1]});
+        }
+        std::stable_sort(groups.begin() + (realPoles.size() % 2 == 1 ? 1 : 0),
+                         groups.end(), [](const auto& a, const auto& b) {
+                             return std::abs(a.front()) > std::abs(b.front());
+                         });
+
+        // Every group takes its nearest zeros: a conjugate pair or real ones
+        const auto takeReal = [&](const Complex target) {
+            const auto nearest = std::min_element(
+                realZeros.begin(), realZeros.end(),
+                [&](const double a, const double b) {
+                    return std::abs(a - target) < std::abs(b - target);
+                });
+            const Complex zero = *nearest;
+            realZeros.erase(nearest);
+            return zero;
+        };
+        std::vector<std::pair<double, TBiquad>> sections;
+        for (const auto& group : groups) {
+            const Complex  pole = group.front();
+            std::vector<Complex> zeros;
+            if (group.size() == 1) {
+                zeros.push_back(takeReal(pole));
+            } else {
+                const auto nearestPair = std::min_element(
+                    zeroPairs.begin(), zeroPairs.end(),
+                    [&](const Complex& a, const Complex& b) {
+                        return std::abs(a - pole) < std::abs(b - pole);
+                    });
+                double realDistance = std::numeric_limits<double>::infinity();
+                if (realZeros.size() >= 2) {
+                    for (const double zero : realZeros) {
+                        realDistance =
+                            std::min(realDistance, std::abs(zero - pole));
+                    }
+                }
+                if (nearestPair != zeroPairs.end() &&
+                    std::abs(*nearestPair - pole) <= realDistance) {
+                    zeros = {*nearestPair, std::conj(*nearestPair)};
+                    zeroPairs.erase(nearestPair);
+                } else {
+                    zeros.push_back(takeReal(pole));
+                    zeros.push_back(takeReal(pole));
+                }
+            }
+
+            TBiquad section;
+            if (group.size() == 1) {
+                section.b1 = -zeros[0].real();
+                section.a1 = -pole.real();
+            } else {
+                section.b1 = -(zeros[0] + zeros[1]).real();
+                section.b2 = (zeros[0] * zeros[1]).real();
+                section.a1 = -(group[0] + group[1]).real();
+                section.a2 = (group[0] * group[1]).real();
+            }
+            sections.emplace_back(std::abs(pole), section);
+        }
+
+        // The poles closest to the unit circle go last
+        std::stable_sort(sections.begin(), sections.end(),
+                         [](const auto& a, const auto& b) {
+                             return a.first < b.first;
+                         });
+        std::vector<TBiquad> result;
+        result.reserve(sections.size());
+        for (const auto& [radius, section] : sections) {
+            result.push_back(section);
+        }
+        result.front().b0 *= filter.gain;
+        result.front().b1 *= filter.gain;
+        result.front().b2 *= filter.gain;
+        return result;
+    }
+
+}  // namespace
+
+std::vector<double> FDES::designWindowedSinc(const TWindowedSincSpec& spec) {
+    std::vector<double> taps(spec.tapsCount);
+    fillWindowedSinc(spec, taps);
+    return taps;
+}
+
+double FDES::lanczos(const double distance, const double halfWidth) {
+    if (std::abs(distance) >= halfWidth) {
+        return 0.0;
+    }
+    if (distance == 0.0) {
+        return 1.0;
+    }
+    const double x = M_PI * distance;
+    return std::sin(x) / x * std::sin(x / halfWidth) / (x / halfWidth);
+}
+
+std::vector<double> FDES::designEquiripple(const TEquirippleSpec& spec) {
+    const std::size_t length = spec.tapsCount;
+    if (length < 3) {
+        throw SignalProcessingError("Number of taps should be at least three");
+    }
+    if (spec.bands.empty() || spec.gridDensity == 0) {
+        throw SignalProcessingError("Invalid bands or grid density");
+    }
+    for (std::size_t b = 0; b < spec.bands.size(); ++b) {
+        const TBand& band = spec.bands[b];
+        if (band.lowFrequency < 0.0 || band.highFrequency > 0.5 ||
+            band.lowFrequency > band.highFrequency || band.weight <= 0.0 ||
+            (b > 0 && band.lowFrequency <= spec.bands[b - 1].highFrequency)) {
+            throw SignalProcessingError(
+                "Bands should be ascending and non-overlapping within [0, 0.5] "
+                "with positive weights");
+        }
+    }
+    // An even symmetric filter has a zero at the Nyquist frequency, which is
+    // factored out as cos(pi * f)
+    const bool even = length % 2 == 0;
+    if (even && spec.bands.back().highFrequency == 0.5 &&
+        spec.bands.back().gain != 0.0) {
+        throw SignalProcessingError(
+            "Filters with an even number of taps have zero gain at the Nyquist "
+            "frequency");
+    }
+
+    // H(f) = [cos(pi * f)] * P(cos(2 * pi * f)) with P of degree r - 1
+    const std::size_t r    = even ? length / 2 : (length + 1) / 2;
+    const double      step = 0.5 / static_cast<double>(spec.gridDensity * r);
+    std::vector<double>      frequencies;
+    std::vector<double>      desired;
+    std::vector<double>      weights;
+    std::vector<std::size_t> bandStarts;
+    for (const TBand& band : spec.bands) {
+        double high = band.highFrequency;
+        if (even && high > 0.5 - step) {
+            high = 0.5 - step;
+        }
+        if (high < band.lowFrequency) {
+            continue;
+        }
+        const auto pointsCount = static_cast<std::size_t>(
+            std::ceil((high - band.lowFrequency) / step));
+        bandStarts.push_back(frequencies.size());
+        for (std::size_t i = 0; i <= pointsCount; ++i) {
+            const double frequency =
+                pointsCount == 0
+                    ? band.lowFrequency
+                    : band.lowFrequency + (high - band.lowFrequency) *
+                                              static_cast<double>(i) /
+                                              static_cast<double>(pointsCount);
+            const double factor = even ? cos(M_PI * frequency) : 1.0;
+            frequencies.push_back(frequency);
+            desired.push_back(band.gain / factor);
+            weights.push_back(band.weight * factor);
+        }
+    }
+    const std::size_t gridSize = frequencies.size();
+    if (gridSize < r + 1) {
+        throw SignalProcessingError("Bands are too narrow for the filter");
+    }
+    std::vector<double> abscissas(gridSize);
+    for (std::size_t i = 0; i < gridSize; ++i) {
+        abscissas[i] = cos(TWO_PI * frequencies[i]);
+    }
+
+    // Initial extremal frequencies spread evenly over the grid
+    std::vector<std::size_t> extrema(r + 1);
+    for (std::size_t j = 0; j <= r; ++j) {
+        extrema[j] = j * (gridSize - 1) / r;
+    }
+
+    std::vector<double> nodes(r + 1);
+    std::vector<double> values(r + 1);
+    std::vector<double> nodeWeights;
+    std::vector<double> error(gridSize);
+    double              deviation  = 0.0;
+    bool                alternates = true;
+    for (std::size_t iteration = 0; iteration < MAX_REMEZ_ITERATIONS;
+         ++iteration) {
+        for (std::size_t j = 0; j <= r; ++j) {
+            nodes[j] = abscissas[extrema[j]];
+        }
+        nodeWeights = barycentricWeights(nodes);
+
+        // Deviation of the alternating interpolation
+        double numerator   = 0.0;
+        double denominator = 0.0;
+        for (std::size_t j = 0; j <= r; ++j) {
+            const double sign = j % 2 == 0 ? 1.0 : -1.0;
+            numerator += nodeWeights[j] * desired[extrema[j]];
+            denominator += sign * nodeWeights[j] / weights[extrema[j]];
+        }
+        deviation = numerator / denominator;
+        for (std::size_t j = 0; j <= r; ++j) {
+            const double sign = j % 2 == 0 ? 1.0 : -1.0;
+            values[j] =
+                desired[extrema[j]] - sign * deviation / weights[extrema[j]];
+        }
+
+        PAR::parallelFor(
+            gridSize,
+            [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    const double approximation =
+                        interpolate(nodes, nodeWeights, values, abscissas[i]);
+                    error[i] = weights[i] * (desired[i] - approximation);
+                }
+            },
+            std::nullopt, GRID_POINTS_PER_CHUNK);
+
+        auto next = findExtrema(error, bandStarts, r + 1);
+        if (next.size() < r + 1) {
+            alternates = false;
+            break;
+        }
+        if (next == extrema) {
+            break;
+        }
+        extrema = std::move(next);
+    }
+    if (!alternates) {
+        throw SignalProcessingError(
+            "Remez exchange lost the alternation; the filter cannot be "
+            "designed with the requested taps and bands");
+    }
+
+    // Sample the amplitude response and invert the DFT of the symmetric
+    // impulse response
+    std::vector<double> amplitudes(length);
+    for (std::size_t k = 0; k < length; ++k) {
+        const double frequency =
+            static_cast<double>(k) / static_cast<double>(length);
+        const double factor = even ? cos(M_PI * frequency) : 1.0;
+        amplitudes[k] = factor * interpolate(nodes, nodeWeights, values,
+                                             cos(TWO_PI * frequency));
+    }
+    const double        center = static_cast<double>(length - 1) / 2.0;
+    std::vector<double> taps(length);
+    for (std::size_t n = 0; n < length; ++n) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < length; ++k) {
+            sum += amplitudes[k] * cos(TWO_PI * static_cast<double>(k) *
+                                       (static_cast<double>(n) - center) /
+                                       static_cast<double>(length));
+        }
+        taps[n] = sum / static_cast<double>(length);
+    }
+
+    // The ripple of the actual filter should match the deviation: it does not
+    // if the exchange has not converged or if the deviation is lost to
+    // rounding (the requested attenuation approaches double precision)
+    PAR::parallelFor(
+        gridSize,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                double amplitude = 0.0;
+                for (std::size_t n = 0; n < length; ++n) {
+                    amplitude += taps[n] *
+                                 cos(TWO_PI * frequencies[i] *
+                                     (static_cast<double>(n) - center));
+                }
+                const double factor =
+                    even ? cos(M_PI * frequencies[i]) : 1.0;
+                error[i] = weights[i] * (desired[i] - amplitude / factor);
+            }
+        },
+        std::nullopt, GRID_POINTS_PER_CHUNK);
+    double ripple = 0.0;
+    for (const double value : error) {
+        ripple = std::max(ripple, std::abs(value));
+    }
+    if (!(ripple <= std::abs(deviation) * (1.0 + RIPPLE_TOLERANCE))) {
+        throw SignalProcessingError(
+            "Remez exchange did not converge; the filter cannot be designed "
+            "with the requested taps and bands");
+    }
+    return taps;
+}
+
+std::vector<TBiquad> FDES::designIIR(const TIIRSpec& spec) {
+    if (spec.order == 0) {
+        throw SignalProcessingError("Filter order should be positive");
+    }
+    const bool isBand = spec.response == Response::BandPass ||
+                        spec.response == Response::BandStop;
+    if (spec.cutoff <= 0.0 || spec.cutoff >= 0.5 ||
+        (isBand && (spec.upperCutoff <= spec.cutoff ||
+                    spec.upperCutoff >= 0.5))) {
+        throw SignalProcessingError(
+            "Cutoffs should be ascending within (0, 0.5) of the sampling "
+            "frequency");
+    }
+    // Only the prototypes with an equiripple band read its specification
+    const bool hasPassbandRipple = spec.prototype == Prototype::Chebyshev1 ||
+                                   spec.prototype == Prototype::Elliptic;
+    const bool hasStopbandRipple = spec.prototype == Prototype::Chebyshev2 ||
+                                   spec.prototype == Prototype::Elliptic;
+    if (hasPassbandRipple && spec.passbandRipple <= 0.0) {
+        throw SignalProcessingError("Passband ripple should be positive");
+    }
+    if (hasStopbandRipple && spec.stopbandAttenuation <= 0.0) {
+        throw SignalProcessingError("Stopband attenuation should be positive");
+    }
+    if (hasPassbandRipple && hasStopbandRipple &&
+        spec.stopbandAttenuation <= spec.passbandRipple) {
+        throw SignalProcessingError(
+            "Stopband attenuation should exceed the passband ripple");
+    }
+
+    // Edges prewarped for the bilinear transform with unit sampling frequency
+    const double lower = 2.0 * tan(M_PI * spec.cutoff);
+    const double upper = isBand ? 2.0 * tan(M_PI * spec.upperCutoff) : 0.0;
+
+    ZeroPoleGain filter = makePrototype(spec);
+    transform(filter, spec.response, lower, upper);
+    bilinear(filter);
+    return makeSections(filter);
+}
+
+std::shared_ptr<const std::vector<double>> FDES::getDesign(
+    const TWindowedSincSpec& spec) {
+    return windowedSincCache.get(spec, designWindowedSinc);
+}
+
+std::shared_ptr<const std::vector<double>> FDES::getDesign(
+    const TEquirippleSpec& spec) {
+    return equirippleCache.get(spec, designEquiripple);
+}
+
+std::shared_ptr<const std::vector<TBiquad>> FDES::getDesign(
+    const TIIRSpec& spec) {
+    return iirCache.get(spec, designIIR);
+}
+
+void FDES::clearCache() {
+    windowedSincCache.clear();
+    equirippleCache.clear();
+    iirCache.clear();
+}
+
+std::complex<double> FDES::frequencyResponse(const std::span<const double> taps,
+                                             const double frequency) {
+    Complex response = 0.0;
+    for (std::size_t n = 0; n < taps.size(); ++n) {
+        response += taps[n] * std::polar(1.0, -TWO_PI * frequency *
+                                                   static_cast<double>(n));
+    }
+    return response;
+}
+
+std::complex<double> FDES::frequencyResponse(
+    const std::span<const TBiquad> sections,
+    const double                   frequency) {
+    const Complex z1       = std::polar(1.0, -TWO_PI * frequency);
+    const Complex z2       = z1 * z1;
+    Complex       response = 1.0;
+    for (const TBiquad& section : sections) {
+        response *= (section.b0 + section.b1 * z1 + section.b2 * z2) /
+                    (1.0 + section.a1 * z1 + section.a2 * z2);
+    }
+    return response;
+}
\ No newline at end of file
@@ -0,0 +1,477 @@
+/**
+ * @file TFilterDesign.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains FIR and IIR filter design routines with a design cache and
+ * compile-time designs.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TCore.hpp"
+#include "TWindow.hpp"
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @namespace FDES
+ * @brief Contains filter responses, prototypes and default parameters used for
+ * filter design.
+ */
+namespace FDES {
+
+    /**
+     * @enum Response
+     * @brief Specifies the frequency response of a filter.
+     */
+    enum class Response : std::uint8_t {
+        LowPass,   ///< Passes frequencies below the cutoff.
+        HighPass,  ///< Passes frequencies above the cutoff.
+        BandPass,  ///< Passes frequencies between the two cutoffs.
+        BandStop   ///< Rejects frequencies between the two cutoffs.
+    };
+
+    /**
+     * @enum Prototype
+     * @brief Specifies the analog prototype of an IIR filter.
+     */
+    enum class Prototype : std::uint8_t {
+        Butterworth,  ///< Maximally flat; the cutoff is the -3 dB frequency.
+        Chebyshev1,   ///< Equiripple passband; the cutoff is the passband edge.
+        Chebyshev2,   ///< Equiripple stopband; the cutoff is the stopband edge.
+        Elliptic      ///< Equiripple passband and stopband; the cutoff is the
+                      ///< passband edge.
+    };
+
+    static constexpr std::size_t DEFAULT_TAPS_COUNT =
+        63;  ///< Default number of FIR taps.
+    static constexpr double DEFAULT_CUTOFF =
+        0.25;  ///< Default cutoff, as a fraction of the sampling frequency.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Hamming;  ///< Default window of windowed-sinc designs.
+    static constexpr std::size_t DEFAULT_ORDER =
+        4;  ///< Default order of the analog IIR prototype.
+    static constexpr double DEFAULT_PASSBAND_RIPPLE =
+        1.0;  ///< Default passband ripple, in decibels.
+    static constexpr double DEFAULT_STOPBAND_ATTENUATION =
+        60.0;  ///< Default stopband attenuation, in decibels.
+    static constexpr std::size_t DEFAULT_GRID_DENSITY =
+        16;  ///< Default density of the Parks-McClellan frequency grid.
+
+    // Kernel parameters
+    static constexpr std::size_t MAX_REMEZ_ITERATIONS =
+        40;  ///< Maximal number of Remez exchange iterations.
+    static constexpr double RIPPLE_TOLERANCE =
+        0.01;  ///< Relative excess of the designed ripple over the Remez
+               ///< deviation above which a design is rejected.
+    static constexpr std::size_t GRID_POINTS_PER_CHUNK =
+        512;  ///< Minimal number of grid points evaluated by one thread.
+
+}  // namespace FDES
+
+/**
+ * @struct TBiquad
+ * @brief Contains the coefficients of a second-order section
+ * `(b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)`.
+ */
+struct TBiquad {
+    double b0 = 1.0;  ///< Numerator coefficient of `z^0`.
+    double b1 = 0.0;  ///< Numerator coefficient of `z^-1`.
+    double b2 = 0.0;  ///< Numerator coefficient of `z^-2`.
+    double a1 = 0.0;  ///< Denominator coefficient of `z^-1`.
+    double a2 = 0.0;  ///< Denominator coefficient of `z^-2`.
+};
+
+/**
+ * @struct TWindowedSincSpec
+ * @brief Specifies a linear-phase FIR filter designed by the window method.
+ * @details Frequencies are fractions of the sampling frequency (0 to 0.5).
+ */
+struct TWindowedSincSpec {
+    FDES::Response response =
+        FDES::Response::LowPass;  ///< Frequency response.
+    std::size_t tapsCount =
+        FDES::DEFAULT_TAPS_COUNT;  ///< Number of taps (odd for high-pass and
+                                   ///< band-stop filters).
+    double cutoff =
+        FDES::DEFAULT_CUTOFF;  ///< Cutoff (lower cutoff of band filters).
+    double upperCutoff = 0.0;  ///< Upper cutoff of band filters.
+    WIN::WindowType window = FDES::DEFAULT_WINDOW;  ///< Window function.
+    double          kaiserBeta =
+        WIN::DEFAULT_KAISER_BETA;  ///< Shape parameter of the Kaiser window.
+
+    auto operator<=>(const TWindowedSincSpec&) const = default;
+};
+
+/**
+ * @struct TBand
+ * @brief Specifies one band of a Parks-McClellan design.
+ */
+struct TBand {
+    double lowFrequency = 0.0;   ///< Lower edge, as a fraction of `fs`.
+    double highFrequency = 0.0;  ///< Upper edge, as a fraction of `fs`.
+    double gain = 0.0;           ///< Desired gain within the band.
+    double weight = 1.0;  ///< Relative weight of the error within the band.
+
+    auto operator<=>(const TBand&) const = default;
+};
+
+/**
+ * @struct TEquirippleSpec
+ * @brief Specifies a linear-phase FIR filter designed by the Parks-McClellan
+ * (Remez exchange) algorithm.
+ */
+struct TEquirippleSpec {
+    std::size_t tapsCount =
+        FDES::DEFAULT_TAPS_COUNT;  ///< Number of taps (even only if the gain at
+                                   ///< the Nyquist frequency is zero).
+    std::vector<TBand> bands = {};  ///< Ascending, non-overlapping bands.
+    std::size_t        gridDensity =
+        FDES::DEFAULT_GRID_DENSITY;  ///< Grid points per extremal frequency.
+
+    auto operator<=>(const TEquirippleSpec&) const = default;
+};
+
+/**
+ * @struct TIIRSpec
+ * @brief Specifies an IIR filter designed from an analog prototype by the
+ * bilinear transform.
+ * @details Frequencies are fractions of the sampling frequency (0 to 0.5);
+ * they are prewarped, so the digital filter has its edges exactly there.
+ */
+struct TIIRSpec {
+    FDES::Prototype prototype =
+        FDES::Prototype::Butterworth;  ///< Analog prototype.
+    FDES::Response response =
+        FDES::Response::LowPass;  ///< Frequency response.
+    std::size_t order =
+        FDES::DEFAULT_ORDER;  ///< Order of the prototype (band filters have
+                              ///< twice the order).
+    double cutoff =
+        FDES::DEFAULT_CUTOFF;  ///< Cutoff (lower cutoff of band filters).
+    double upperCutoff = 0.0;  ///< Upper cutoff of band filters.
+    double passbandRipple =
+        FDES::DEFAULT_PASSBAND_RIPPLE;  ///< Passband ripple, in decibels
+                                        ///< (Chebyshev I and elliptic).
+    double stopbandAttenuation =
+        FDES::DEFAULT_STOPBAND_ATTENUATION;  ///< Stopband attenuation, in
+                                             ///< decibels (Chebyshev II and
+                                             ///< elliptic).
+
+    auto operator<=>(const TIIRSpec&) const = default;
+};
+
+namespace FDES {
+
+    // Constant-expression math shared with the window functions
+    using WIN::cosine;
+    using WIN::sine;
+    using WIN::squareRoot;
+
+    /**
+     * @brief Designs a windowed-sinc FIR filter into a buffer; usable in
+     * constant expressions.
+     * @details The ideal response is truncated to `taps.size()` samples and
+     * windowed. The result is scaled to unit gain at zero frequency (low-pass
+     * and band-stop), at the Nyquist frequency (high-pass) or at the band
+     * center (band-pass).
+     *
+     * @param spec Filter specification; its `tapsCount` is ignored.
+     * @param taps Receives the coefficients.
+     *
+     * @throws SignalProcessingError If the buffer is empty, if the cutoffs are
+     * invalid, or if a high-pass or band-stop filter has an even number of
+     * taps.
+     */
+    constexpr void fillWindowedSinc(const TWindowedSincSpec& spec,
+                                    std::span<double>        taps);
+
+    /**
+     * @brief Designs a windowed-sinc FIR filter.
+     *
+     * @param spec Filter specification.
+     * @return std::vector<double> The coefficients.
+     *
+     * @throws SignalProcessingError If the specification is invalid.
+     */
+    [[nodiscard]] std::vector<double> designWindowedSinc(
+        const TWindowedSincSpec& spec);
+
+    /**
+     * @brief Computes the Lanczos-windowed sinc interpolation kernel
+     * `sinc(d) * sinc(d / a)`, zero for `|d| >= a`.
+     *
+     * @param distance Distance to the sample, in samples.
+     * @param halfWidth Half width `a` of the kernel, in samples.
+     * @return double The kernel value.
+     */
+    [[nodiscard]] double lanczos(double distance, double halfWidth);
+
+    /**
+     * @brief Designs an equiripple FIR filter by the Parks-McClellan
+     * algorithm.
+     * @details The weighted Chebyshev approximation is found by the Remez
+     * exchange on a dense grid; the grid error is evaluated by barycentric
+     * interpolation on several threads. The design is rejected unless the
+     * exchange keeps a full alternation set and the ripple of the resulting
+     * taps matches the Remez deviation: this fails if the exchange has not
+     * converged after `FDES::MAX_REMEZ_ITERATIONS` iterations, or if the
+     * requested taps and bands call for a ripple close to double precision.
+     *
+     * @param spec Filter specification.
+     * @return std::vector<double> The coefficients.
+     *
+     * @throws SignalProcessingError If there are fewer than three taps, if the
+     * bands are invalid, if an even number of taps is requested with a
+     * nonzero gain at the Nyquist frequency, or if the exchange fails.
+     */
+    [[nodiscard]] std::vector<double> designEquiripple(
+        const TEquirippleSpec& spec);
+
+    /**
+     * @brief Designs an IIR filter as a cascade of second-order sections.
+     * @details The analog prototype's zeros and poles are transformed to the
+     * requested response, mapped by the bilinear transform and paired into
+     * sections, each pole pair with its nearest zeros; the sections are
+     * ordered with the poles closest to the unit circle last. The overall
+     * gain is put into the first section.
+     *
+     * @param spec Filter specification.
+     * @return std::vector<TBiquad> The sections.
+     *
+     * @throws SignalProcessingError If the order is zero, if the cutoffs are
+     * invalid, or if the ripple or the attenuation read by the prototype are
+     * invalid.
+     */
+    [[nodiscard]] std::vector<TBiquad> designIIR(const TIIRSpec& spec);
+
+    /**
+     * @brief Retrieves a windowed-sinc design, designing it on first use.
+     * @details Designs are cached by specification for the lifetime of the
+     * program (or until clearCache()); concurrent calls are safe.
+     *
+     * @param spec Filter specification.
+     * @return std::shared_ptr<const std::vector<double>> The coefficients.
+     *
+     * @throws SignalProcessingError If the specification is invalid.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<double>> getDesign(
+        const TWindowedSincSpec& spec);
+
+    /**
+     * @brief Retrieves a Parks-McClellan design, designing it on first use.
+     *
+     * @param spec Filter specification.
+     * @return std::shared_ptr<const std::vector<double>> The coefficients.
+     *
+     * @throws SignalProcessingError If the specification is invalid or the
+     * exchange fails (see designEquiripple()).
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<double>> getDesign(
+        const TEquirippleSpec& spec);
+
+    /**
+     * @brief Retrieves an IIR design, designing it on first use.
+     *
+     * @param spec Filter specification.
+     * @return std::shared_ptr<const std::vector<TBiquad>> The sections.
+     *
+     * @throws SignalProcessingError If the specification is invalid.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<TBiquad>> getDesign(
+        const TIIRSpec& spec);
+
+    /**
+     * @brief Removes all cached designs. Designs already retrieved stay valid.
+     */
+    void clearCache();
+
+    /**
+     * @brief Evaluates the frequency response of an FIR filter.
+     *
+     * @param taps Filter coefficients.
+     * @param frequency Frequency, as a fraction of the sampling frequency.
+     * @return std::complex<double> The response.
+     */
+    [[nodiscard]] std::complex<double> frequencyResponse(
+        std::span<const double> taps,
+        double                  frequency);
+
+    /**
+     * @brief Evaluates the frequency response of a cascade of sections.
+     *
+     * @param sections Second-order sections.
+     * @param frequency Frequency, as a fraction of the sampling frequency.
+     * @return std::complex<double> The response.
+     */
+    [[nodiscard]] std::complex<double> frequencyResponse(
+        std::span<const TBiquad> sections,
+        double                   frequency);
+
+    /**
+     * @brief Designs a windowed-sinc FIR filter at compile time.
+     * @details Example:
+     * `constexpr auto taps = FDES::makeFixedWindowedSinc<TWindowedSincSpec{
+     * .tapsCount = 31, .cutoff = 0.1}>();`
+     *
+     * @tparam Spec Filter specification.
+     * @return std::array<double, Spec.tapsCount> The coefficients.
+     */
+    template <TWindowedSincSpec Spec>
+    [[nodiscard]] consteval std::array<double, Spec.tapsCount>
+    makeFixedWindowedSinc();
+
+    /**
+     * @brief Designs a Butterworth low-pass or high-pass IIR filter at compile
+     * time.
+     * @details The sections hold the conjugate pole pairs in the order of
+     * increasing quality factor, followed by the real pole of odd orders.
+     *
+     * @tparam Spec Filter specification (Butterworth, low-pass or high-pass).
+     * @return std::array<TBiquad, (Spec.order + 1) / 2> The sections.
+     */
+    template <TIIRSpec Spec>
+    [[nodiscard]] consteval std::array<TBiquad, (Spec.order + 1) / 2>
+    makeFixedIIR();
+
+}  // namespace FDES
+
+/*
+ * CONSTEXPR IMPLEMENTATION
+ */
+
+constexpr void FDES::fillWindowedSinc(const TWindowedSincSpec& spec,
+                                      const std::span<double>  taps) {
+    const std::size_t length = taps.size();
+    if (length == 0) {
+        throw SignalProcessingError("Number of taps should be positive");
+    }
+    const bool isBand = spec.response == Response::BandPass ||
+                        spec.response == Response::BandStop;
+    if (spec.cutoff <= 0.0 || spec.cutoff >= 0.5 ||
+        (isBand && (spec.upperCutoff <= spec.cutoff ||
+                    spec.upperCutoff >= 0.5))) {
+        throw SignalProcessingError(
+            "Cutoffs should be ascending within (0, 0.5) of the sampling "
+            "frequency");
+    }
+    const bool passesNyquist = spec.response == Response::HighPass ||
+                               spec.response == Response::BandStop;
+    if (passesNyquist && length % 2 == 0) {
+        throw SignalProcessingError(
+            "High-pass and band-stop filters need an odd number of taps");
+    }
+
+    // Ideal low-pass response of the cutoff `f` at the offset `t`
+    const auto lowPass = [](const double frequency, const double offset) {
+        if (offset == 0.0) {
+            return 2.0 * frequency;
+        }
+        return sine(TWO_PI * frequency * offset) / (M_PI * offset);
+    };
+
+    const double center = static_cast<double>(length - 1) / 2.0;
+    for (std::size_t n = 0; n < length; ++n) {
+        const double offset  = static_cast<double>(n) - center;
+        const double impulse = offset == 0.0 ? 1.0 : 0.0;
+        double       value   = 0.0;
+        switch (spec.response) {
+            case Response::LowPass:
+                value = lowPass(spec.cutoff, offset);
+                break;
+            case Response::HighPass:
+                value = impulse - lowPass(spec.cutoff, offset);
+                break;
+            case Response::BandPass:
+                value = lowPass(spec.upperCutoff, offset) -
+                        lowPass(spec.cutoff, offset);
+                break;
+            case Response::BandStop:
+                value = impulse - lowPass(spec.upperCutoff, offset) +
+                        lowPass(spec.cutoff, offset);
+                break;
+            default:
+                throw SignalProcessingError("Invalid filter response");
+        }
+        taps[n] = value *
+                  WIN::windowValue(spec.window, n, length, spec.kaiserBeta);
+    }
+
+    // Unit gain in the middle of the passband
+    double reference = 0.0;
+    if (spec.response == Response::HighPass) {
+        reference = 0.5;
+    } else if (spec.response == Response::BandPass) {
+        reference = (spec.cutoff + spec.upperCutoff) / 2.0;
+    }
+    double gain = 0.0;
+    for (std::size_t n = 0; n < length; ++n) {
+        const double offset = static_cast<double>(n) - center;
+        gain += taps[n] * cosine(TWO_PI * reference * offset);
+    }
+    for (auto& tap : taps) {
+        tap /= gain;
+    }
+}
+
+template <TWindowedSincSpec Spec>
+consteval std::array<double, Spec.tapsCount> FDES::makeFixedWindowedSinc() {
+    std::array<double, Spec.tapsCount> taps{};
+    fillWindowedSinc(Spec, taps);
+    return taps;
+}
+
+template <TIIRSpec Spec>
+consteval std::array<TBiquad, (Spec.order + 1) / 2> FDES::makeFixedIIR() {
+    static_assert(Spec.prototype == Prototype::Butterworth,
+                  "Only Butterworth filters can be designed at compile time");
+    static_assert(Spec.response == Response::LowPass ||
+                      Spec.response == Response::HighPass,
+                  "Only low-pass and high-pass filters can be designed at "
+                  "compile time");
+    static_assert(Spec.order > 0, "Order should be positive");
+    static_assert(Spec.cutoff > 0.0 && Spec.cutoff < 0.5,
+                  "Cutoff should be within (0, 0.5) of the sampling frequency");
+
+    // Prewarped analog cutoff of the bilinear transform with `fs = 1 / 2`
+    const double phase   = M_PI * Spec.cutoff;
+    const double warped  = sine(phase) / cosine(phase);
+    const double square  = warped * warped;
+    const bool   highPass = Spec.response == Response::HighPass;
+
+    std::array<TBiquad, (Spec.order + 1) / 2> sections{};
+    for (std::size_t k = 0; k < Spec.order / 2; ++k) {
+        // Section `s^2 + d * s + 1` of the normalized prototype
+        const double damping =
+            2.0 * sine(M_PI * static_cast<double>(2 * k + 1) /
+                       static_cast<double>(2 * Spec.order));
+        const double norm = 1.0 / (1.0 + damping * warped + square);
+        TBiquad&     section = sections[Spec.order / 2 - 1 - k];
+        section.b0           = highPass ? norm : square * norm;
+        section.b1           = highPass ? -2.0 * section.b0 : 2.0 * section.b0;
+        section.b2           = section.b0;
+        section.a1           = 2.0 * (square - 1.0) * norm;
+        section.a2           = (1.0 - damping * warped + square) * norm;
+    }
+    if (Spec.order % 2 == 1) {
+        const double norm    = 1.0 / (1.0 + warped);
+        TBiquad&     section = sections.back();
+        section.b0           = highPass ? norm : warped * norm;
+        section.b1           = highPass ? -norm : section.b0;
+        section.b2           = 0.0;
+        section.a1           = (warped - 1.0) * norm;
+        section.a2           = 0.0;
+    }
+    return sections;
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ * @file TParallel.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains helpers for splitting signal processing work across
+ * hardware threads.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace PAR
+ * @brief Contains default parameters and helpers for parallel processing.
+ */
+namespace PAR {
+
+    static constexpr std::size_t DEFAULT_MIN_CHUNK_SIZE =
+        1;  ///< Default minimal number of work items handled by one thread.
+
+    /**
+     * @brief Resolves the number of threads used for processing.
+     *
+     * @param threadsCount Requested number of threads. If not set or zero, the
+     * number of hardware threads is used.
+     * @return std::size_t The number of threads (at least one).
+     */
+    [[nodiscard]] inline std::size_t resolveThreadsCount(
+        std::optional<std::size_t> threadsCount = std::nullopt) {
+        if (threadsCount && *threadsCount > 0) {
+            return *threadsCount;
+        }
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief Processes the range [0, count) in contiguous chunks on several
+     * threads.
+     * @details The range is split into at most `threadsCount` chunks of at
+     * least `minChunkSize` items, and `function(begin, end)` is called for
+     * every chunk. The calling thread processes the first chunk itself. If only
+     * one chunk is produced, no thread is started. Exceptions thrown by the
+     * function are rethrown in the calling thread after all chunks have
+     * finished.
+     *
+     * @param count Number of work items.
+     * @param function Callable invoked as `function(begin, end)`.
+     * @param threadsCount Requested number of threads (see
+     * `resolveThreadsCount`).
+     * @param minChunkSize Minimal number of work items per chunk.
+     */
+    template <typename Function>
+    void parallelFor(std::size_t                count,
+                     Function&&                 function,
+                     std::optional<std::size_t> threadsCount = std::nullopt,
+                     std::size_t minChunkSize = DEFAULT_MIN_CHUNK_SIZE) {
+        if (count == 0) {
+            return;
+        }
+
+        const std::size_t maxChunks =
+            std::max<std::size_t>(1, count / std::max<std::size_t>(
+                                                 1, minChunkSize));
+        const std::size_t chunksCount =
+            std::min(resolveThreadsCount(threadsCount), maxChunks);
+        if (chunksCount == 1) {
+            function(std::size_t{0}, count);
+            return;
+        }
+
+        const std::size_t chunkSize = (count + chunksCount - 1) / chunksCount;
+        std::vector<std::exception_ptr> errors(chunksCount);
+        std::vector<std::thread>        threads;
+        threads.reserve(chunksCount - 1);
+
+        for (std::size_t chunk = 1; chunk < chunksCount; ++chunk) {
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end   = std::min(count, begin + chunkSize);
+            if (begin >= end) {
+                break;
+            }
+            threads.emplace_back([&function, &errors, chunk, begin, end]() {
+                try {
+                    function(begin, end);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            });
+        }
+
+        try {
+            function(std::size_t{0}, std::min(count, chunkSize));
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+}  // namespace PAR
\ No newline at end of file
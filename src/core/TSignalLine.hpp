@@ -92,8 +92,7 @@ namespace SL {
  *
  * @todo Consider converting in the future if additional functionality, such as
  * operations on points (e.g., addition, distance calculation), or encapsulation
- * of data is required. --> add getPoints() and setPoints() methods in the
- * TSignalLine class.
+ * of data is required.
  */
 struct Point {
     double x = 0.0;  ///< The x-coordinate of the point (horizontal position).
@@ -348,6 +347,25 @@ class TSignalLine {
      */
     [[nodiscard]] const Point& getPoint(std::size_t index) const;
 
+    /**
+     * @brief Retrieves all points of the signal line.
+     * @details Provides contiguous read-only access to the points, which lets
+     * processing kernels iterate over the signal without the bounds checking
+     * performed by `getPoint()`.
+     *
+     * @return const std::vector<Point>& A constant reference to the points.
+     */
+    [[nodiscard]] const std::vector<Point>& getPoints() const;
+
+    /**
+     * @brief Replaces all points of the signal line.
+     * @details The points count is updated to match the new points, and the
+     * cached minimum and maximum values are reset.
+     *
+     * @param points The new points of the signal line.
+     */
+    void setPoints(std::vector<Point> points);
+
     /**
      * @brief Retrieves the parameters of the signal line.
      *
@@ -408,6 +426,17 @@ class TSignalLine {
     void removeDCComponent(
         std::optional<double> inaccuracy = SL::DEFAULT_INACCURACY);
 
+    /**
+     * @brief Computes the trapezoidal integration weights of the points.
+     * @details The weight of a point is half the distance between its
+     * neighbours (half the distance to the single neighbour at the ends), so
+     * the weighted sum of the y-coordinates is the integral computed by
+     * TIntegrator with the trapezoidal rule.
+     *
+     * @return std::vector<double> The weight of every point.
+     */
+    [[nodiscard]] std::vector<double> getTrapezoidalWeights() const;
+
     /**
      * @brief Checks whether two points are approximately equal in the
      * x-coordinate.
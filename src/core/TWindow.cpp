@@ -0,0 +1,29 @@
+/**
+ * @file TWindow.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the window functions used for filter
+ * design and spectral analysis.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TWindow.hpp"
+#include "TCore.hpp"
+
+#include <cstddef>
+#include <vector>
+
+std::vector<double> WIN::makeWindow(const WindowType  type,
+                                    const std::size_t length,
+                                    const double      kaiserBeta) {
+    if (length == 0) {
+        throw SignalProcessingError("Window length should be positive");
+    }
+
+    std::vector<double> window(length);
+    for (std::size_t i = 0; i < length; ++i) {
+        window[i] = windowValue(type, i, length, kaiserBeta);
+    }
+    return window;
+}
\ No newline at end of file
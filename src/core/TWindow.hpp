@@ -0,0 +1,217 @@
+/**
+ * @file TWindow.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains window functions used for filter design and spectral
+ * analysis.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TCore.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @namespace WIN
+ * @brief Contains window types, their default parameters and the window
+ * generator.
+ */
+namespace WIN {
+
+    /**
+     * @enum WindowType
+     * @brief Enumerates the supported window functions.
+     */
+    enum class WindowType : std::uint8_t {
+        Rectangular,  ///< Rectangular window (no tapering).
+        Hann,         ///< Hann (raised cosine) window.
+        Hamming,      ///< Hamming window.
+        Blackman,     ///< Classic three-term Blackman window.
+        Kaiser        ///< Kaiser window with an adjustable shape parameter.
+    };
+
+    static constexpr double DEFAULT_KAISER_BETA =
+        8.6;  ///< Default shape parameter of the Kaiser window (about 90 dB of
+              ///< side lobe attenuation).
+
+    /**
+     * @brief Generates a symmetric window.
+     *
+     * @param type Window function.
+     * @param length Number of window samples.
+     * @param kaiserBeta Shape parameter of the Kaiser window (ignored by the
+     * other windows).
+     * @return std::vector<double> The window samples.
+     *
+     * @throws SignalProcessingError If the length is zero or the window type
+     * is unknown.
+     */
+    [[nodiscard]] std::vector<double> makeWindow(
+        WindowType  type,
+        std::size_t length,
+        double      kaiserBeta = DEFAULT_KAISER_BETA);
+
+    /**
+     * @brief Computes the sine; usable in constant expressions.
+     * @details At run time `std::sin` is used; in constant expressions the
+     * argument is reduced to `[-pi/4, pi/4]` and a Taylor series is summed.
+     *
+     * @param value The argument, in radians.
+     * @return double sin(value).
+     */
+    [[nodiscard]] constexpr double sine(double value);
+
+    /**
+     * @brief Computes the cosine; usable in constant expressions.
+     *
+     * @param value The argument, in radians.
+     * @return double cos(value).
+     */
+    [[nodiscard]] constexpr double cosine(double value);
+
+    /**
+     * @brief Computes the square root; usable in constant expressions.
+     *
+     * @param value The argument (non-negative).
+     * @return double sqrt(value).
+     */
+    [[nodiscard]] constexpr double squareRoot(double value);
+
+    /**
+     * @brief Computes the zeroth-order modified Bessel function of the first
+     * kind by its power series; usable in constant expressions.
+     *
+     * @param value The argument.
+     * @return double I0(value).
+     */
+    [[nodiscard]] constexpr double besselI0(double value);
+
+    /**
+     * @brief Computes one sample of a symmetric window; usable in constant
+     * expressions.
+     *
+     * @param type Window function.
+     * @param index Index of the sample.
+     * @param length Number of window samples.
+     * @param kaiserBeta Shape parameter of the Kaiser window.
+     * @return double The window sample.
+     *
+     * @throws SignalProcessingError If the window type is unknown.
+     */
+    [[nodiscard]] constexpr double windowValue(WindowType  type,
+                                               std::size_t index,
+                                               std::size_t length,
+                                               double      kaiserBeta);
+
+}  // namespace WIN
+
+/*
+ * CONSTEXPR IMPLEMENTATION
+ */
+
+constexpr double WIN::sine(const double value) {
+    if (!std::is_constant_evaluated()) {
+        return sin(value);
+    }
+    // pi / 2 split into a high and a low part for an accurate reduction
+    constexpr double halfPiHigh = 1.57079632679489655800e+00;
+    constexpr double halfPiLow  = 6.12323399573676603587e-17;
+    const double     ratio      = value / halfPiHigh;
+    const auto       quadrant   = static_cast<long long>(
+        ratio >= 0.0 ? ratio + 0.5 : ratio - 0.5);
+    const double reduced =
+        (value - static_cast<double>(quadrant) * halfPiHigh) -
+        static_cast<double>(quadrant) * halfPiLow;
+    const double square     = reduced * reduced;
+    double       sineTerm   = reduced;
+    double       sineSum    = reduced;
+    double       cosineTerm = 1.0;
+    double       cosineSum  = 1.0;
+    for (int k = 1; k < 16; ++k) {
+        sineTerm *= -square / static_cast<double>((2 * k) * (2 * k + 1));
+        cosineTerm *= -square / static_cast<double>((2 * k - 1) * (2 * k));
+        sineSum += sineTerm;
+        cosineSum += cosineTerm;
+    }
+    switch (((quadrant % 4) + 4) % 4) {
+        case 0:
+            return sineSum;
+        case 1:
+            return cosineSum;
+        case 2:
+            return -sineSum;
+        default:
+            return -cosineSum;
+    }
+}
+
+constexpr double WIN::cosine(const double value) {
+    if (!std::is_constant_evaluated()) {
+        return cos(value);
+    }
+    return sine(value + M_PI / 2.0);
+}
+
+constexpr double WIN::squareRoot(const double value) {
+    if (!std::is_constant_evaluated()) {
+        return sqrt(value);
+    }
+    if (value <= 0.0) {
+        return 0.0;
+    }
+    double root = value > 1.0 ? value : 1.0;
+    for (int i = 0; i < 2048; ++i) {
+        const double next = 0.5 * (root + value / root);
+        if (next >= root) {
+            break;
+        }
+        root = next;
+    }
+    return root;
+}
+
+constexpr double WIN::besselI0(const double value) {
+    const double quarterSquare = value * value / 4.0;
+    double       term          = 1.0;
+    double       sum           = 1.0;
+    for (int k = 1; term > sum * 1e-17; ++k) {
+        term *= quarterSquare / (static_cast<double>(k) * k);
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double WIN::windowValue(const WindowType  type,
+                                  const std::size_t index,
+                                  const std::size_t length,
+                                  const double      kaiserBeta) {
+    if (length <= 1) {
+        return 1.0;
+    }
+    const double last  = static_cast<double>(length - 1);
+    const double phase = TWO_PI * static_cast<double>(index) / last;
+    switch (type) {
+        case WindowType::Rectangular:
+            return 1.0;
+        case WindowType::Hann:
+            return 0.5 - 0.5 * cosine(phase);
+        case WindowType::Hamming:
+            return 0.54 - 0.46 * cosine(phase);
+        case WindowType::Blackman:
+            return 0.42 - 0.5 * cosine(phase) + 0.08 * cosine(2.0 * phase);
+        case WindowType::Kaiser: {
+            const double ratio = 2.0 * static_cast<double>(index) / last - 1.0;
+            return besselI0(kaiserBeta * squareRoot(1.0 - ratio * ratio)) /
+                   besselI0(kaiserBeta);
+        }
+        default:
+            throw SignalProcessingError("Invalid window type");
+    }
+}
\ No newline at end of file
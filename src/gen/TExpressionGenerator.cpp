@@ -0,0 +1,819 @@
+/**
+ * @file TExpressionGenerator.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TExpressionGenerator class
+ * generating signal lines from mathematical expressions of time.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TExpressionGenerator.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using EGEN::Instruction;
+    using EGEN::Opcode;
+
+    /// UTF-8 encoding of the middle dot used as a multiplication sign
+    constexpr std::string_view MIDDLE_DOT = "\xC2\xB7";
+
+    /// UTF-8 encoding of the Greek letter pi
+    constexpr std::string_view GREEK_PI = "\xCF\x80";
+
+    /**
+     * @struct Function
+     * @brief Function callable from the expressions.
+     */
+    struct Function {
+        std::string_view name;     ///< Name of the function.
+        Opcode           opcode;   ///< Instruction computing the function.
+        std::size_t      arity;    ///< Number of arguments.
+    };
+
+    /// Functions callable from the expressions
+    constexpr std::array<Function, 18> FUNCTIONS = {{
+        {"sin", Opcode::Sin, 1},     {"cos", Opcode::Cos, 1},
+        {"tan", Opcode::Tan, 1},     {"asin", Opcode::Asin, 1},
+        {"acos", Opcode::Acos, 1},   {"atan", Opcode::Atan, 1},
+        {"sinh", Opcode::Sinh, 1},   {"cosh", Opcode::Cosh, 1},
+        {"tanh", Opcode::Tanh, 1},   {"exp", Opcode::Exp, 1},
+        {"log", Opcode::Log, 1},     {"log10", Opcode::Log10, 1},
+        {"sqrt", Opcode::Sqrt, 1},   {"abs", Opcode::Abs, 1},
+        {"floor", Opcode::Floor, 1}, {"ceil", Opcode::Ceil, 1},
+        {"min", Opcode::Minimum, 2}, {"max", Opcode::Maximum, 2}}};
+
+    /**
+     * @brief Applies a unary function to every value of a block.
+     *
+     * @param values The block, replaced by the results.
+     * @param count Number of values.
+     * @param function The function.
+     */
+    template <typename UnaryFunction>
+    void transform(double* const     values,
+                   const std::size_t count,
+                   UnaryFunction     function) {
+        for (std::size_t i = 0; i < count; ++i) {
+            values[i] = function(values[i]);
+        }
+    }
+
+    /**
+     * @brief Combines two blocks value by value.
+     *
+     * @param values The left operands, replaced by the results.
+     * @param operands The right operands.
+     * @param count Number of values.
+     * @param function The binary function.
+     */
+    template <typename BinaryFunction>
+    void combine(double* const       values,
+                 const double* const operands,
+                 const std::size_t   count,
+                 BinaryFunction      function) {
+        for (std::size_t i = 0; i < count; ++i) {
+            values[i] = function(values[i], operands[i]);
+        }
+    }
+
+    /**
+     * @brief Runs an instruction other than `Time` and `Constant` over a
+     * block.
+     * @details Every opcode has its own loop, so the loops of the arithmetic
+     * instructions are vectorized. Constant folding runs the same code on a
+     * single value, so folded and evaluated results are identical.
+     *
+     * @param instruction The instruction.
+     * @param values The top block, replaced by the results (the left operand
+     * of the binary instructions).
+     * @param operands The block above it (the right operand of the binary
+     * instructions; unused by the others).
+     * @param count Number of values.
+     */
+    void run(const Instruction&  instruction,
+             double* const       values,
+             const double* const operands,
+             const std::size_t   count) {
+        const double c = instruction.value;
+        switch (instruction.opcode) {
+            case Opcode::Add:
+                combine(values, operands, count,
+                        [](double a, double b) { return a + b; });
+                break;
+            case Opcode::Subtract:
+                combine(values, operands, count,
+                        [](double a, double b) { return a - b; });
+                break;
+            case Opcode::Multiply:
+                combine(values, operands, count,
+                        [](double a, double b) { return a * b; });
+                break;
+            case Opcode::Divide:
+                combine(values, operands, count,
+                        [](double a, double b) { return a / b; });
+                break;
+            case Opcode::Power:
+                combine(values, operands, count,
+                        [](double a, double b) { return std::pow(a, b); });
+                break;
+            case Opcode::Minimum:
+                combine(values, operands, count,
+                        [](double a, double b) { return b < a ? b : a; });
+                break;
+            case Opcode::Maximum:
+                combine(values, operands, count,
+                        [](double a, double b) { return b > a ? b : a; });
+                break;
+            case Opcode::AddConstant:
+                transform(values, count, [c](double a) { return a + c; });
+                break;
+            case Opcode::MultiplyConstant:
+                transform(values, count, [c](double a) { return a * c; });
+                break;
+            case Opcode::DivideConstant:
+                transform(values, count, [c](double a) { return a / c; });
+                break;
+            case Opcode::PowerConstant:
+                if (c == 2.0) {
+                    transform(values, count, [](double a) { return a * a; });
+                } else {
+                    transform(values, count,
+                              [c](double a) { return std::pow(a, c); });
+                }
+                break;
+            case Opcode::MinimumConstant:
+                transform(values, count,
+                          [c](double a) { return c < a ? c : a; });
+                break;
+            case Opcode::MaximumConstant:
+                transform(values, count,
+                          [c](double a) { return c > a ? c : a; });
+                break;
+            case Opcode::ReverseSubtractConstant:
+                transform(values, count, [c](double a) { return c - a; });
+                break;
+            case Opcode::ReverseDivideConstant:
+                transform(values, count, [c](double a) { return c / a; });
+                break;
+            case Opcode::ReversePowerConstant:
+                transform(values, count,
+                          [c](double a) { return std::pow(c, a); });
+                break;
+            case Opcode::Negate:
+                transform(values, count, [](double a) { return -a; });
+                break;
+            case Opcode::Sin:
+                transform(values, count, [](double a) { return std::sin(a); });
+                break;
+            case Opcode::Cos:
+                transform(values, count, [](double a) { return std::cos(a); });
+                break;
+            case Opcode::Tan:
+                transform(values, count, [](double a) { return std::tan(a); });
+                break;
+            case Opcode::Asin:
+                transform(values, count,
+                          [](double a) { return std::asin(a); });
+                break;
+            case Opcode::Acos:
+                transform(values, count,
+                          [](double a) { return std::acos(a); });
+                break;
+            case Opcode::Atan:
+                transform(values, count,
+                          [](double a) { return std::atan(a); });
+                break;
+            case Opcode::Sinh:
+                transform(values, count,
+                          [](double a) { return std::sinh(a); });
+                break;
+            case Opcode::Cosh:
+                transform(values, count,
+                          [](double a) { return std::cosh(a); });
+                break;
+            case Opcode::Tanh:
+                transform(values, count,
+                          [](double a) { return std::tanh(a); });
+                break;
+            case Opcode::Exp:
+                transform(values, count, [](double a) { return std::exp(a); });
+                break;
+            case Opcode::Log:
+                transform(values, count, [](double a) { return std::log(a); });
+                break;
+            case Opcode::Log10:
+                transform(values, count,
+                          [](double a) { return std::log10(a); });
+                break;
+            case Opcode::Sqrt:
+                transform(values, count,
+                          [](double a) { return std::sqrt(a); });
+                break;
+            case Opcode::Abs:
+                transform(values, count,
+                          [](double a) { return std::abs(a); });
+                break;
+            case Opcode::Floor:
+                transform(values, count,
+                          [](double a) { return std::floor(a); });
+                break;
+            case Opcode::Ceil:
+                transform(values, count,
+                          [](double a) { return std::ceil(a); });
+                break;
+            case Opcode::Time:
+            case Opcode::Constant:
+                break;
+        }
+    }
+
+    /**
+     * @class Compiler
+     * @brief Recursive descent parser emitting the bytecode of an expression.
+     *
+     * @details Grammar (`·` is a synonym of `*`, and a primary other than a
+     * number directly following a factor multiplies it):
+     *
+     * - expression: term { ('+' | '-') term }
+     * - term: unary { ('*' | '/' | implicit) unary }
+     * - unary: ('-' | '+') unary | power
+     * - power: primary [ '^' unary ]
+     * - primary: number | identifier [ '(' arguments ')' ] | '(' expression ')'
+     *
+     * Every rule emits the code of its operand right after the code emitted
+     * before it, so an operand is the tail of the code starting at the size
+     * the code had before parsing it.
+     */
+    class Compiler {
+       public:
+        /**
+         * @brief Constructs a compiler of an expression.
+         *
+         * @param source The expression.
+         */
+        explicit Compiler(const std::string_view source) : _source(source) {}
+
+        /**
+         * @brief Compiles the expression.
+         *
+         * @return std::vector<Instruction> The bytecode.
+         *
+         * @throws SignalProcessingError If the expression is invalid.
+         */
+        std::vector<Instruction> compile() {
+            parseExpression();
+            skipSpaces();
+            if (_position < _source.size()) {
+                fail("Unexpected character");
+            }
+            return std::move(_code);
+        }
+
+       private:
+        std::string_view         _source;        ///< The expression.
+        std::size_t              _position = 0;  ///< Current byte offset.
+        std::vector<Instruction> _code     = {};  ///< Emitted bytecode.
+
+        /**
+         * @brief Throws an error pointing at the current position.
+         *
+         * @param message Description of the error.
+         */
+        [[noreturn]] void fail(const std::string& message) const {
+            throw SignalProcessingError(message + " at position " +
+                                        std::to_string(_position + 1) +
+                                        " of the expression");
+        }
+
+        /**
+         * @brief Skips the whitespace at the current position.
+         */
+        void skipSpaces() {
+            while (_position < _source.size() &&
+                   (_source[_position] == ' ' || _source[_position] == '\t' ||
+                    _source[_position] == '\n' || _source[_position] == '\r')) {
+                ++_position;
+            }
+        }
+
+        /**
+         * @brief Consumes a token if it comes next.
+         *
+         * @param token The token.
+         * @return bool True if the token was consumed.
+         */
+        bool match(const std::string_view token) {
+            skipSpaces();
+            if (_source.substr(_position).starts_with(token)) {
+                _position += token.size();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Checks whether a primary comes next (implicit
+         * multiplication).
+         */
+        [[nodiscard]] bool isPrimaryNext() {
+            skipSpaces();
+            if (_position >= _source.size()) {
+                return false;
+            }
+            const char next = _source[_position];
+            return std::isalnum(static_cast<unsigned char>(next)) != 0 ||
+                   next == '.' || next == '(' || next == '_' ||
+                   _source.substr(_position).starts_with(GREEK_PI);
+        }
+
+        /**
+         * @brief Checks whether the code from an offset on is one constant.
+         */
+        [[nodiscard]] bool isConstant(const std::size_t start) const {
+            return _code.size() == start + 1 &&
+                   _code[start].opcode == Opcode::Constant;
+        }
+
+        /**
+         * @brief Emits a function of the operand starting at an offset,
+         * folding a constant operand.
+         */
+        void emitUnary(const Opcode opcode, const std::size_t start) {
+            if (isConstant(start)) {
+                run(Instruction{.opcode = opcode}, &_code.back().value,
+                    nullptr, 1);
+                return;
+            }
+            _code.push_back(Instruction{.opcode = opcode});
+        }
+
+        /**
+         * @brief Emits a binary operation of the operands starting at two
+         * offsets, folding constant operands and fusing a single one into
+         * the instruction.
+         */
+        void emitBinary(const Opcode      opcode,
+                        const std::size_t leftStart,
+                        const std::size_t rightStart) {
+            const bool isLeftConstant =
+                rightStart == leftStart + 1 &&
+                _code[leftStart].opcode == Opcode::Constant;
+            const bool isRightConstant = isConstant(rightStart);
+
+            if (isLeftConstant && isRightConstant) {
+                double       left  = _code[leftStart].value;
+                const double right = _code[rightStart].value;
+                run(Instruction{.opcode = opcode}, &left, &right, 1);
+                _code.resize(leftStart);
+                _code.push_back(
+                    Instruction{.opcode = Opcode::Constant, .value = left});
+            } else if (isRightConstant) {
+                const double right = _code.back().value;
+                _code.pop_back();
+                switch (opcode) {
+                    case Opcode::Add:
+                        _code.push_back({Opcode::AddConstant, right});
+                        break;
+                    case Opcode::Subtract:
+                        _code.push_back({Opcode::AddConstant, -right});
+                        break;
+                    case Opcode::Multiply:
+                        _code.push_back({Opcode::MultiplyConstant, right});
+                        break;
+                    case Opcode::Divide:
+                        _code.push_back({Opcode::DivideConstant, right});
+                        break;
+                    case Opcode::Power:
+                        _code.push_back({Opcode::PowerConstant, right});
+                        break;
+                    case Opcode::Minimum:
+                        _code.push_back({Opcode::MinimumConstant, right});
+                        break;
+                    default:
+                        _code.push_back({Opcode::MaximumConstant, right});
+                        break;
+                }
+            } else if (isLeftConstant) {
+                const double left = _code[leftStart].value;
+                _code.erase(_code.begin() +
+                            static_cast<std::ptrdiff_t>(leftStart));
+                switch (opcode) {
+                    case Opcode::Add:
+                        _code.push_back({Opcode::AddConstant, left});
+                        break;
+                    case Opcode::Subtract:
+                        _code.push_back(
+                            {Opcode::ReverseSubtractConstant, left});
+                        break;
+                    case Opcode::Multiply:
+                        _code.push_back({Opcode::MultiplyConstant, left});
+                        break;
+                    case Opcode::Divide:
+                        _code.push_back({Opcode::ReverseDivideConstant, left});
+                        break;
+                    case Opcode::Power:
+                        _code.push_back({Opcode::ReversePowerConstant, left});
+                        break;
+                    case Opcode::Minimum:
+                        _code.push_back({Opcode::MinimumConstant, left});
+                        break;
+                    default:
+                        _code.push_back({Opcode::MaximumConstant, left});
+                        break;
+                }
+            } else {
+                _code.push_back(Instruction{.opcode = opcode});
+            }
+        }
+
+        /**
+         * @brief Parses a sum or difference of terms.
+         */
+        void parseExpression() {
+            const std::size_t start = _code.size();
+            parseTerm();
+            while (true) {
+                Opcode opcode = Opcode::Add;
+                if (match("-")) {
+                    opcode = Opcode::Subtract;
+                } else if (!match("+")) {
+                    return;
+                }
+                const std::size_t rightStart = _code.size();
+                parseTerm();
+                emitBinary(opcode, start, rightStart);
+            }
+        }
+
+        /**
+         * @brief Parses a product or quotient of factors.
+         */
+        void parseTerm() {
+            const std::size_t start = _code.size();
+            parseUnary();
+            while (true) {
+                Opcode opcode = Opcode::Multiply;
+                if (match("/")) {
+                    opcode = Opcode::Divide;
+                } else if (!match("*") && !match(MIDDLE_DOT)) {
+                    if (!isPrimaryNext()) {
+                        return;
+                    }
+                    // A number never multiplies implicitly: `3 4` lacks an
+                    // operator
+                    const char next = _source[_position];
+                    if (std::isdigit(static_cast<unsigned char>(next)) != 0 ||
+                        next == '.') {
+                        fail("Expected an operator");
+                    }
+                }
+                const std::size_t rightStart = _code.size();
+                parseUnary();
+                emitBinary(opcode, start, rightStart);
+            }
+        }
+
+        /**
+         * @brief Parses a factor with optional signs.
+         */
+        void parseUnary() {
+            if (match("-")) {
+                const std::size_t start = _code.size();
+                parseUnary();
+                emitUnary(Opcode::Negate, start);
+            } else if (match("+")) {
+                parseUnary();
+            } else {
+                parsePower();
+            }
+        }
+
+        /**
+         * @brief Parses a primary with an optional exponent.
+         */
+        void parsePower() {
+            const std::size_t start = _code.size();
+            parsePrimary();
+            if (match("^")) {
+                const std::size_t rightStart = _code.size();
+                parseUnary();
+                emitBinary(Opcode::Power, start, rightStart);
+            }
+        }
+
+        /**
+         * @brief Parses a number, identifier, call or parenthesized
+         * expression.
+         */
+        void parsePrimary() {
+            skipSpaces();
+            if (_position >= _source.size()) {
+                fail("Unexpected end");
+            }
+            const char next = _source[_position];
+            if (match("(")) {
+                parseExpression();
+                if (!match(")")) {
+                    fail("Expected ')'");
+                }
+            } else if (std::isdigit(static_cast<unsigned char>(next)) != 0 ||
+                       next == '.') {
+                parseNumber();
+            } else if (match(GREEK_PI)) {
+                _code.push_back({Opcode::Constant, std::numbers::pi});
+            } else if (std::isalpha(static_cast<unsigned char>(next)) != 0 ||
+                       next == '_') {
+                parseIdentifier();
+            } else {
+                fail("Unexpected character");
+            }
+        }
+
+        /**
+         * @brief Parses a numeric literal.
+         */
+        void parseNumber() {
+            // Digits, an optional fraction and an optional exponent; an `e`
+            // that does not start an exponent is the constant `e`
+            const auto isDigit = [this](const std::size_t position) {
+                return position < _source.size() &&
+                       std::isdigit(static_cast<unsigned char>(
+                           _source[position])) != 0;
+            };
+            std::size_t end = _position;
+            while (isDigit(end)) {
+                ++end;
+            }
+            if (end < _source.size() && _source[end] == '.') {
+                ++end;
+                while (isDigit(end)) {
+                    ++end;
+                }
+            }
+            if (end < _source.size() &&
+                (_source[end] == 'e' || _source[end] == 'E')) {
+                std::size_t exponent = end + 1;
+                if (exponent < _source.size() &&
+                    (_source[exponent] == '+' || _source[exponent] == '-')) {
+                    ++exponent;
+                }
+                if (isDigit(exponent)) {
+                    end = exponent;
+                    while (isDigit(end)) {
+                        ++end;
+                    }
+                }
+            }
+
+            double      value = 0.0;
+            const char* first = _source.data() + _position;
+            const char* last  = _source.data() + end;
+            const auto [pointer, error] = std::from_chars(first, last, value);
+            if (error != std::errc() || pointer != last ||
+                (end < _source.size() &&
+                 (_source[end] == '.' || isDigit(end)))) {
+                fail("Invalid number");
+            }
+            _position = end;
+            _code.push_back({Opcode::Constant, value});
+        }
+
+        /**
+         * @brief Parses a function call, the time or a named constant.
+         */
+        void parseIdentifier() {
+            std::size_t end = _position;
+            while (end < _source.size() &&
+                   (std::isalnum(static_cast<unsigned char>(_source[end])) !=
+                        0 ||
+                    _source[end] == '_')) {
+                ++end;
+            }
+            const std::string_view name =
+                _source.substr(_position, end - _position);
+
+            const auto function =
+                std::ranges::find_if(FUNCTIONS, [name](const Function& entry) {
+                    return entry.name == name;
+                });
+            if (function != FUNCTIONS.end()) {
+                _position = end;
+                if (!match("(")) {
+                    fail("Expected '(' after '" + std::string(name) + "'");
+                }
+                const std::size_t start = _code.size();
+                parseExpression();
+                if (function->arity == 2) {
+                    if (!match(",")) {
+                        fail("Expected ','");
+                    }
+                    const std::size_t rightStart = _code.size();
+                    parseExpression();
+                    emitBinary(function->opcode, start, rightStart);
+                } else {
+                    emitUnary(function->opcode, start);
+                }
+                if (!match(")")) {
+                    fail("Expected ')'");
+                }
+            } else if (name == "t") {
+                _position = end;
+                _code.push_back({Opcode::Time, 0.0});
+            } else if (name == "pi") {
+                _position = end;
+                _code.push_back({Opcode::Constant, std::numbers::pi});
+            } else if (name == "e") {
+                _position = end;
+                _code.push_back({Opcode::Constant, std::numbers::e});
+            } else {
+                fail("Unknown identifier '" + std::string(name) + "'");
+            }
+        }
+    };
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TExpressionGenerator::TExpressionGenerator(
+    std::string                expression,
+    const double               samplingFrequency,
+    const double               duration,
+    std::optional<std::string> xLabel,
+    std::optional<std::string> yLabel,
+    std::optional<std::string> graphLabel)
+    : _params{.samplingFreq = samplingFrequency,
+              .duration     = duration,
+              .expression   = std::move(expression),
+              .xLabel       = std::move(xLabel),
+              .yLabel       = std::move(yLabel),
+              .graphLabel   = std::move(graphLabel)} {
+    compile();
+}
+
+TExpressionGenerator::TExpressionGenerator(TExpressionGeneratorParams params)
+    : _params(std::move(params)) {
+    compile();
+}
+
+TExpressionGenerator::TExpressionGenerator(
+    const TExpressionGenerator& generator)
+    : _sl(generator._sl ? std::make_unique<TSignalLine>(*generator._sl)
+                        : nullptr),
+      _params(generator._params),
+      _program(generator._program),
+      _stackDepth(generator._stackDepth),
+      _isExecuted(generator._isExecuted) {}
+
+TExpressionGenerator& TExpressionGenerator::operator=(
+    const TExpressionGenerator& generator) {
+    if (this == &generator) {
+        return *this;
+    }
+    _sl =
+        generator._sl ? std::make_unique<TSignalLine>(*generator._sl) : nullptr;
+    _params     = generator._params;
+    _program    = generator._program;
+    _stackDepth = generator._stackDepth;
+    _isExecuted = generator._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TExpressionGenerator::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Expression Generator not executed");
+    }
+    return _sl.get();
+}
+
+const TExpressionGeneratorParams& TExpressionGenerator::getParams() const {
+    return _params;
+}
+
+const std::vector<EGEN::Instruction>& TExpressionGenerator::getProgram() const {
+    return _program;
+}
+
+bool TExpressionGenerator::isExecuted() const {
+    return _isExecuted;
+}
+
+void TExpressionGenerator::execute() {
+    TSignalLineParams slParams;
+    slParams.samplingFrequency = _params.samplingFreq;
+    slParams.duration          = _params.duration;
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+
+    // TSignalLine constructor has a check of input parameters, so we can safely
+    // use them
+    _sl = std::make_unique<TSignalLine>(slParams);
+
+    const std::size_t pointsCount = _sl->getParams().pointsCount;
+    const std::size_t blocksCount =
+        (pointsCount + EGEN::BLOCK_SIZE - 1) / EGEN::BLOCK_SIZE;
+
+    std::vector<Point> points(pointsCount);
+    PAR::parallelFor(
+        blocksCount,
+        [this, &points, pointsCount](const std::size_t begin,
+                                     const std::size_t end) {
+            std::vector<double> stack(_stackDepth * EGEN::BLOCK_SIZE);
+            for (std::size_t block = begin; block < end; ++block) {
+                const std::size_t first = block * EGEN::BLOCK_SIZE;
+                evaluateBlock(points, first,
+                              std::min(pointsCount, first + EGEN::BLOCK_SIZE),
+                              stack);
+            }
+        },
+        _params.threadsCount);
+    _sl->setPoints(std::move(points));
+
+    _isExecuted = true;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TExpressionGenerator::compile() {
+    if (_params.expression.find_first_not_of(" \t\r\n") == std::string::npos) {
+        throw SignalProcessingError("Expression should not be empty");
+    }
+    _program = Compiler(_params.expression).compile();
+
+    std::size_t depth = 0;
+    _stackDepth       = 0;
+    for (const EGEN::Instruction& instruction : _program) {
+        if (instruction.opcode == EGEN::Opcode::Time ||
+            instruction.opcode == EGEN::Opcode::Constant) {
+            _stackDepth = std::max(_stackDepth, ++depth);
+        } else if (instruction.opcode <= EGEN::Opcode::Maximum) {
+            --depth;
+        }
+    }
+}
+
+void TExpressionGenerator::evaluateBlock(std::vector<Point>&  points,
+                                         const std::size_t    begin,
+                                         const std::size_t    end,
+                                         std::vector<double>& stack) const {
+    const std::size_t count        = end - begin;
+    const double      samplingFreq = _params.samplingFreq;
+    std::size_t       depth        = 0;
+    double*           top          = stack.data();
+    for (const EGEN::Instruction& instruction : _program) {
+        switch (instruction.opcode) {
+            case EGEN::Opcode::Time:
+                top = stack.data() + (depth++) * EGEN::BLOCK_SIZE;
+                for (std::size_t i = 0; i < count; ++i) {
+                    top[i] = static_cast<double>(begin + i) / samplingFreq;
+                }
+                break;
+            case EGEN::Opcode::Constant:
+                top = stack.data() + (depth++) * EGEN::BLOCK_SIZE;
+                std::fill(top, top + count, instruction.value);
+                break;
+            case EGEN::Opcode::Add:
+            case EGEN::Opcode::Subtract:
+            case EGEN::Opcode::Multiply:
+            case EGEN::Opcode::Divide:
+            case EGEN::Opcode::Power:
+            case EGEN::Opcode::Minimum:
+            case EGEN::Opcode::Maximum:
+                top = stack.data() + (--depth - 1) * EGEN::BLOCK_SIZE;
+                run(instruction, top, top + EGEN::BLOCK_SIZE, count);
+                break;
+            default:
+                run(instruction, top, nullptr, count);
+                break;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        points[begin + i] = Point{
+            .x = static_cast<double>(begin + i) / samplingFreq, .y = top[i]};
+    }
+}
\ No newline at end of file
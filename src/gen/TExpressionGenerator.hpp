@@ -0,0 +1,284 @@
+/**
+ * @file TExpressionGenerator.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TExpressionGenerator class generating
+ * signal lines from mathematical expressions of time.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace EGEN
+ * @brief Contains the bytecode and default parameters used in expression-based
+ * signal generation.
+ */
+namespace EGEN {
+
+    /**
+     * @enum Opcode
+     * @brief Enumerates the instructions of the compiled expressions.
+     *
+     * @details The bytecode runs on a stack of sample blocks. `Time` and
+     * `Constant` push a block; the binary instructions pop the top block and
+     * combine it with the new top (`a op b`, where `b` was on top); the
+     * `...Constant` instructions combine the top block with the constant of
+     * the instruction (`a op c`, or `c op a` for the `Reverse...` ones;
+     * `a - c` is `a + (-c)`); the functions replace the top block.
+     */
+    enum class Opcode : std::uint8_t {
+        Time,                     ///< Pushes the sample times, in seconds.
+        Constant,                 ///< Pushes the constant.
+        Add,                      ///< `a + b`.
+        Subtract,                 ///< `a - b`.
+        Multiply,                 ///< `a * b`.
+        Divide,                   ///< `a / b`.
+        Power,                    ///< `a ^ b`.
+        Minimum,                  ///< `min(a, b)`.
+        Maximum,                  ///< `max(a, b)`.
+        AddConstant,              ///< `a + c`.
+        MultiplyConstant,         ///< `a * c`.
+        DivideConstant,           ///< `a / c`.
+        PowerConstant,            ///< `a ^ c`.
+        MinimumConstant,          ///< `min(a, c)`.
+        MaximumConstant,          ///< `max(a, c)`.
+        ReverseSubtractConstant,  ///< `c - a`.
+        ReverseDivideConstant,    ///< `c / a`.
+        ReversePowerConstant,     ///< `c ^ a`.
+        Negate,                   ///< `-a`.
+        Sin,                      ///< `sin(a)`.
+        Cos,                      ///< `cos(a)`.
+        Tan,                      ///< `tan(a)`.
+        Asin,                     ///< `asin(a)`.
+        Acos,                     ///< `acos(a)`.
+        Atan,                     ///< `atan(a)`.
+        Sinh,                     ///< `sinh(a)`.
+        Cosh,                     ///< `cosh(a)`.
+        Tanh,                     ///< `tanh(a)`.
+        Exp,                      ///< `exp(a)`.
+        Log,                      ///< Natural logarithm `log(a)`.
+        Log10,                    ///< `log10(a)`.
+        Sqrt,                     ///< `sqrt(a)`.
+        Abs,                      ///< `abs(a)`.
+        Floor,                    ///< `floor(a)`.
+        Ceil                      ///< `ceil(a)`.
+    };
+
+    /**
+     * @struct Instruction
+     * @brief One instruction of a compiled expression.
+     */
+    struct Instruction {
+        Opcode opcode = Opcode::Constant;  ///< Operation.
+        double value  = 0.0;  ///< Constant operand (`Constant` and the
+                              ///< `...Constant` instructions).
+    };
+
+    // Graphical parameters
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Expression";  ///< Default label for the graph.
+
+    // Kernel parameters
+    static constexpr std::size_t BLOCK_SIZE =
+        512;  ///< Number of samples evaluated by every instruction at once.
+
+}  // namespace EGEN
+
+/**
+ * @struct TExpressionGeneratorParams
+ * @brief Contains parameters for generating a signal line from an expression.
+ *
+ * @note Some parameters are optional and represented by std::optional. These
+ * can be set by the user or remain unset, in which case default values or
+ * behaviors are applied.
+ */
+struct TExpressionGeneratorParams {
+    // Signal parameters
+    double samplingFreq =
+        SL::DEFAULT_SAMPLING_FREQ_HZ;  ///< Sampling frequency of the signal, in
+                                       ///< Hz.
+    double duration =
+        SL::DEFAULT_DURATION_SECONDS;  ///< Duration of the signal, in seconds.
+
+    // Generation parameters
+    std::string expression = {};  ///< Expression of the time `t`, in seconds.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of generation threads. If not set, the number
+                       ///< of hardware threads is used.
+
+    // Graphical parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        EGEN::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TExpressionGenerator
+ * @brief Class for generating a signal line from a mathematical expression of
+ * the time `t`, such as `3*sin(2*pi*50*t) + 0.2*sin(2π·150t)·exp(-t)`.
+ *
+ * @details The expression supports numbers, the time `t`, the constants `pi`
+ * (or `π`) and `e`, the operators `+`, `-`, `*` (or `·`), `/` and `^` (right
+ * associative and binding tighter than the unary minus), parentheses,
+ * implicit multiplication (`2pi`, `50t`, `3(t + 1)`; a number never follows
+ * an operand without an operator), the functions `sin`, `cos`, `tan`,
+ * `asin`, `acos`, `atan`, `sinh`, `cosh`, `tanh`, `exp`, `log` (natural),
+ * `log10`, `sqrt`, `abs`, `floor` and `ceil`, and the two-argument `min` and
+ * `max`.
+ *
+ * The expression is compiled once, on construction, into a compact stack
+ * bytecode: constant subexpressions are folded, and operations with a
+ * constant operand are fused into one instruction, so `2π·50t` becomes two
+ * instructions. The bytecode is evaluated on blocks of `EGEN::BLOCK_SIZE`
+ * samples: every instruction runs one tight loop over the whole block, which
+ * the compiler vectorizes, instead of interpreting the expression per sample.
+ * The blocks are split across threads, and the samples are written straight
+ * into the signal line without intermediate lines.
+ */
+class TExpressionGenerator {
+   public:
+    /**
+     * @brief Constructs a TExpressionGenerator with an expression.
+     *
+     * @param expression Expression of the time `t`, in seconds.
+     * @param samplingFrequency The sampling frequency of the signal.
+     * @param duration The total duration of the signal.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     *
+     * @throws SignalProcessingError if the expression is invalid.
+     */
+    explicit TExpressionGenerator(
+        std::string expression,
+        double      samplingFrequency         = SL::DEFAULT_SAMPLING_FREQ_HZ,
+        double      duration                  = SL::DEFAULT_DURATION_SECONDS,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = EGEN::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TExpressionGenerator using a
+     * TExpressionGeneratorParams object.
+     *
+     * @param params A structure containing the parameters for the signal
+     * generation.
+     *
+     * @throws SignalProcessingError if the expression is invalid.
+     */
+    explicit TExpressionGenerator(TExpressionGeneratorParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TExpressionGenerator() = default;
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param generator A constant reference to the generator to copy.
+     */
+    TExpressionGenerator(const TExpressionGenerator& generator);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TExpressionGenerator(TExpressionGenerator&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param generator A constant reference to the generator to copy.
+     */
+    TExpressionGenerator& operator=(const TExpressionGenerator& generator);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TExpressionGenerator& operator=(TExpressionGenerator&&) noexcept = default;
+
+    /**
+     * @brief Retrieves a pointer to the generated signal line.
+     *
+     * @return const TSignalLine* A pointer to the generated signal line.
+     *
+     * @throws SignalProcessingError if the signal line is not generated.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters used for signal generation.
+     *
+     * @return const TExpressionGeneratorParams& A constant reference to the
+     * signal generation parameters.
+     */
+    [[nodiscard]] const TExpressionGeneratorParams& getParams() const;
+
+    /**
+     * @brief Retrieves the compiled bytecode of the expression.
+     *
+     * @return const std::vector<EGEN::Instruction>& A constant reference to
+     * the instructions.
+     */
+    [[nodiscard]] const std::vector<EGEN::Instruction>& getProgram() const;
+
+    /**
+     * @brief Checks if the signal has been generated.
+     *
+     * @return bool True if the signal has been generated, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Executes the signal generation process.
+     *
+     * @throws SignalProcessingError if the sampling parameters are invalid.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the generated signal line.
+    TExpressionGeneratorParams _params =
+        {};  ///< Parameters for generating the signal line.
+    std::vector<EGEN::Instruction> _program =
+        {};  ///< Compiled bytecode of the expression.
+    std::size_t _stackDepth = 0;  ///< Number of blocks the bytecode needs.
+    bool        _isExecuted =
+        false;  ///< Flag indicating whether the signal has been generated.
+
+    /**
+     * @brief Compiles the expression of the parameters into the bytecode.
+     *
+     * @throws SignalProcessingError if the expression is invalid.
+     */
+    void compile();
+
+    /**
+     * @brief Evaluates the bytecode over one block of samples.
+     *
+     * @param points Signal points to fill.
+     * @param begin First index of the block.
+     * @param end Index past the last one of the block.
+     * @param stack Scratch blocks (`_stackDepth * EGEN::BLOCK_SIZE` values).
+     */
+    void evaluateBlock(std::vector<Point>&  points,
+                       std::size_t          begin,
+                       std::size_t          end,
+                       std::vector<double>& stack) const;
+};
\ No newline at end of file
@@ -0,0 +1,302 @@
+/**
+ * @file TModulatedGenerator.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TModulatedGenerator class for
+ * modulated waveform generation.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TModulatedGenerator.hpp"
+#include "TCore.hpp"
+#include "TGenerator.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TModulatedGenerator::TModulatedGenerator(
+    const double               samplingFrequency,
+    const double               duration,
+    const double               carrierFrequency,
+    const MGEN::Modulation     modulation,
+    const double               modulatingFrequency,
+    const double               modulationIndex,
+    const double               freqDeviation,
+    const double               amplitude,
+    std::optional<std::string> xLabel,
+    std::optional<std::string> yLabel,
+    std::optional<std::string> graphLabel)
+    : _params{.samplingFreq    = samplingFrequency,
+              .duration        = duration,
+              .carrierFreq     = carrierFrequency,
+              .amplitude       = amplitude,
+              .modulation      = modulation,
+              .modulatingFreq  = modulatingFrequency,
+              .modulationIndex = modulationIndex,
+              .freqDeviation   = freqDeviation,
+              .xLabel          = std::move(xLabel),
+              .yLabel          = std::move(yLabel),
+              .graphLabel      = std::move(graphLabel)} {}
+
+TModulatedGenerator::TModulatedGenerator(TModulatedGeneratorParams params)
+    : _params(std::move(params)) {}
+
+TModulatedGenerator::TModulatedGenerator(const TModulatedGenerator& generator)
+    : _sl(generator._sl ? std::make_unique<TSignalLine>(*generator._sl)
+                        : nullptr),
+      _params(generator._params),
+      _isExecuted(generator._isExecuted) {}
+
+TModulatedGenerator& TModulatedGenerator::operator=(
+    const TModulatedGenerator& generator) {
+    if (this == &generator) {
+        return *this;
+    }
+    _sl =
+        generator._sl ? std::make_unique<TSignalLine>(*generator._sl) : nullptr;
+    _params     = generator._params;
+    _isExecuted = generator._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TModulatedGenerator::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Modulated Generator not executed");
+    }
+    return _sl.get();
+}
+
+const TModulatedGeneratorParams& TModulatedGenerator::getParams() const {
+    return _params;
+}
+
+bool TModulatedGenerator::isExecuted() const {
+    return _isExecuted;
+}
+
+void TModulatedGenerator::execute() {
+    const bool isDigital = _params.modulation == MGEN::Modulation::FSK ||
+                           _params.modulation == MGEN::Modulation::PSK ||
+                           _params.modulation == MGEN::Modulation::QAM;
+    if (_params.modulation == MGEN::Modulation::FM &&
+        _params.modulatingFreq <= 0.0) {
+        throw SignalProcessingError("Modulating frequency should be positive");
+    }
+    if (isDigital) {
+        if (_params.symbols.empty()) {
+            throw SignalProcessingError("Symbol stream should not be empty");
+        }
+        if (_params.symbolRate <= 0.0) {
+            throw SignalProcessingError("Symbol rate should be positive");
+        }
+        if (_params.constellationSize < 2) {
+            throw SignalProcessingError(
+                "Constellation size should be at least 2");
+        }
+        if (_params.modulation == MGEN::Modulation::QAM) {
+            const auto side = static_cast<std::size_t>(std::lround(
+                sqrt(static_cast<double>(_params.constellationSize))));
+            if (side * side != _params.constellationSize) {
+                throw SignalProcessingError(
+                    "Constellation size should be a perfect square for QAM");
+            }
+        }
+        for (const std::size_t symbol : _params.symbols) {
+            if (symbol >= _params.constellationSize) {
+                throw SignalProcessingError(
+                    "Symbol should be less than the constellation size");
+            }
+        }
+    }
+
+    TSignalLineParams slParams;
+    slParams.samplingFrequency    = _params.samplingFreq;
+    slParams.duration             = _params.duration;
+    slParams.oscillationFrequency = _params.carrierFreq;
+    slParams.initPhase            = _params.initPhase;
+    slParams.offsetY              = _params.offsetY;
+    slParams.amplitude            = _params.amplitude;
+    slParams.xLabel               = _params.xLabel;
+    slParams.yLabel               = _params.yLabel;
+    slParams.graphLabel           = _params.graphLabel;
+    slParams.normalizeFactor      = GEN::DEFAULT_NORMALIZE_FACTOR_SIN;
+
+    // TSignalLine constructor has a check of input parameters, so we can safely
+    // use them
+    _sl = std::make_unique<TSignalLine>(slParams);
+
+    const std::size_t pointsCount = _sl->getParams().pointsCount;
+
+    // Continuous-phase FSK needs the accumulated phase at every symbol start;
+    // the table is short, so it is built sequentially.
+    std::vector<double> symbolPhases;
+    if (_params.modulation == MGEN::Modulation::FSK && pointsCount > 0) {
+        const auto symbolsCount =
+            static_cast<std::size_t>(
+                floor(static_cast<double>(pointsCount - 1) *
+                      _params.symbolRate / _params.samplingFreq)) +
+            1;
+        const double spread =
+            static_cast<double>(_params.constellationSize - 1);
+        symbolPhases.resize(symbolsCount + 1);
+        symbolPhases[0] = 0.0;
+        for (std::size_t j = 0; j < symbolsCount; ++j) {
+            const double symbol = static_cast<double>(
+                _params.symbols[j % _params.symbols.size()]);
+            const double deviation =
+                _params.freqDeviation * (2.0 * symbol - spread);
+            symbolPhases[j + 1] = std::remainder(
+                symbolPhases[j] + TWO_PI * deviation / _params.symbolRate,
+                TWO_PI);
+        }
+    }
+
+    std::vector<Point> points(pointsCount);
+    PAR::parallelFor(
+        pointsCount,
+        [this, &points, &symbolPhases](const std::size_t begin,
+                                       const std::size_t end) {
+            generateRange(points, begin, end, symbolPhases);
+        },
+        _params.threadsCount, MGEN::SAMPLES_PER_CHUNK);
+    _sl->setPoints(std::move(points));
+
+    _isExecuted = true;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TModulatedGenerator::generateRange(
+    std::vector<Point>&        points,
+    const std::size_t          begin,
+    const std::size_t          end,
+    const std::vector<double>& symbolPhases) const {
+    const double samplingFreq    = _params.samplingFreq;
+    const double amplitude       = _params.amplitude;
+    const double offsetY         = _params.offsetY;
+    const double initPhase       = _params.initPhase;
+    const double carrierOmega    = TWO_PI * _params.carrierFreq;
+    const double modulatingOmega = TWO_PI * _params.modulatingFreq;
+    const double index           = _params.modulationIndex;
+    const double symbolRate      = _params.symbolRate;
+    const auto&  symbols         = _params.symbols;
+    const double constellation =
+        static_cast<double>(_params.constellationSize);
+
+    // Position of the symbol sent at the given time within the signal
+    const auto positionAt = [symbolRate](const double time) {
+        return static_cast<std::size_t>(time * symbolRate);
+    };
+
+    switch (_params.modulation) {
+        case MGEN::Modulation::AM:
+            for (std::size_t i = begin; i < end; ++i) {
+                const double time = static_cast<double>(i) / samplingFreq;
+                const double envelope =
+                    amplitude * (1.0 + index * cos(modulatingOmega * time));
+                points[i] = Point{
+                    .x = time,
+                    .y = envelope * cos(carrierOmega * time + initPhase) +
+                         offsetY};
+            }
+            break;
+
+        case MGEN::Modulation::FM: {
+            const double deviationRatio =
+                _params.freqDeviation / _params.modulatingFreq;
+            for (std::size_t i = begin; i < end; ++i) {
+                const double time  = static_cast<double>(i) / samplingFreq;
+                const double phase =
+                    carrierOmega * time + initPhase +
+                    deviationRatio * sin(modulatingOmega * time);
+                points[i] =
+                    Point{.x = time, .y = amplitude * cos(phase) + offsetY};
+            }
+            break;
+        }
+
+        case MGEN::Modulation::PM:
+            for (std::size_t i = begin; i < end; ++i) {
+                const double time  = static_cast<double>(i) / samplingFreq;
+                const double phase = carrierOmega * time + initPhase +
+                                     index * sin(modulatingOmega * time);
+                points[i] =
+                    Point{.x = time, .y = amplitude * cos(phase) + offsetY};
+            }
+            break;
+
+        case MGEN::Modulation::FSK: {
+            const double spread = constellation - 1.0;
+            for (std::size_t i = begin; i < end; ++i) {
+                const double      time = static_cast<double>(i) / samplingFreq;
+                const std::size_t position = positionAt(time);
+                const double      symbol   = static_cast<double>(
+                    symbols[position % symbols.size()]);
+                const double deviation =
+                    _params.freqDeviation * (2.0 * symbol - spread);
+                const double elapsed =
+                    time - static_cast<double>(position) / symbolRate;
+                const double phase = carrierOmega * time + initPhase +
+                                     symbolPhases[position] +
+                                     TWO_PI * deviation * elapsed;
+                points[i] =
+                    Point{.x = time, .y = amplitude * cos(phase) + offsetY};
+            }
+            break;
+        }
+
+        case MGEN::Modulation::PSK:
+            for (std::size_t i = begin; i < end; ++i) {
+                const double time   = static_cast<double>(i) / samplingFreq;
+                const double symbol = static_cast<double>(
+                    symbols[positionAt(time) % symbols.size()]);
+                const double phase = carrierOmega * time + initPhase +
+                                     TWO_PI * symbol / constellation;
+                points[i] =
+                    Point{.x = time, .y = amplitude * cos(phase) + offsetY};
+            }
+            break;
+
+        case MGEN::Modulation::QAM: {
+            const auto side =
+                static_cast<std::size_t>(std::lround(sqrt(constellation)));
+            const double levelOffset = static_cast<double>(side - 1);
+            // The corner points (+-(L - 1), +-(L - 1)) get the amplitude A
+            const double scale =
+                side > 1 ? amplitude / (levelOffset * sqrt(2.0)) : 0.0;
+            for (std::size_t i = begin; i < end; ++i) {
+                const double time = static_cast<double>(i) / samplingFreq;
+                const std::size_t symbol =
+                    symbols[positionAt(time) % symbols.size()];
+                const double inPhase =
+                    2.0 * static_cast<double>(symbol % side) - levelOffset;
+                const double quadrature =
+                    2.0 * static_cast<double>(symbol / side) - levelOffset;
+                const double phase = carrierOmega * time + initPhase;
+                points[i]          = Point{
+                             .x = time,
+                             .y = scale * (inPhase * cos(phase) -
+                                           quadrature * sin(phase)) +
+                                  offsetY};
+            }
+            break;
+        }
+
+        default:
+            throw SignalProcessingError("Unknown modulation");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+/**
+ * @file TModulatedGenerator.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TModulatedGenerator class for
+ * modulated waveform generation.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace MGEN
+ * @brief Contains default parameters used in modulated signal generation.
+ */
+namespace MGEN {
+
+    /**
+     * @enum Modulation
+     * @brief Specifies the kind of modulation applied to the carrier.
+     *
+     * @details Analog modulations use a sinusoidal modulating tone of
+     * frequency `fm`; digital modulations use a stream of symbols from
+     * `[0, constellationSize)` with rectangular pulses of `1 / symbolRate`
+     * seconds:
+     *
+     * - **AM**: `A * (1 + m * cos(2*pi*fm*t)) * cos(2*pi*fc*t + phi)`, where
+     *   `m` is the modulation index (depth).
+     *
+     * - **FM**: `A * cos(2*pi*fc*t + phi + (df / fm) * sin(2*pi*fm*t))`, where
+     *   `df` is the peak frequency deviation.
+     *
+     * - **PM**: `A * cos(2*pi*fc*t + phi + m * sin(2*pi*fm*t))`, where `m` is
+     *   the peak phase deviation in radians.
+     *
+     * - **FSK**: continuous-phase frequency-shift keying; symbol `s` is sent at
+     *   `fc + df * (2s - (M - 1))`, so adjacent tones are `2 * df` apart.
+     *
+     * - **PSK**: phase-shift keying; symbol `s` is sent with the phase offset
+     *   `2*pi*s / M`.
+     *
+     * - **QAM**: square quadrature amplitude modulation; symbol `s` is sent as
+     *   `I * cos(2*pi*fc*t + phi) - Q * sin(2*pi*fc*t + phi)` with `I` and `Q`
+     *   from the odd levels `-(L - 1) ... L - 1` (`L = sqrt(M)`, column
+     *   `s % L`, row `s / L`), scaled so that the corner points have the
+     *   amplitude `A`.
+     *
+     * @note The symbol mapping is natural (not Gray coded). If the signal
+     * lasts longer than the symbol stream, the stream is repeated.
+     */
+    enum class Modulation : std::uint8_t {
+        AM,   ///< Amplitude modulation.
+        FM,   ///< Frequency modulation.
+        PM,   ///< Phase modulation.
+        FSK,  ///< Frequency-shift keying.
+        PSK,  ///< Phase-shift keying.
+        QAM   ///< Quadrature amplitude modulation.
+    };
+
+    // Graphical parameters
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Modulated Signal";  ///< Default label for the graph.
+
+    // Generation parameters
+    static constexpr auto DEFAULT_MODULATION =
+        Modulation::AM;  ///< Default kind of modulation.
+    static constexpr double DEFAULT_CARRIER_FREQ_HZ =
+        100.0;  ///< Default carrier frequency, in Hertz.
+    static constexpr double DEFAULT_MODULATING_FREQ_HZ =
+        SL::DEFAULT_FREQ_HZ;  ///< Default frequency of the modulating tone, in
+                              ///< Hertz.
+    static constexpr double DEFAULT_MODULATION_INDEX =
+        0.5;  ///< Default AM depth or PM phase deviation (radians).
+    static constexpr double DEFAULT_FREQ_DEVIATION_HZ =
+        10.0;  ///< Default FM peak deviation or FSK half tone spacing, in
+               ///< Hertz.
+    static constexpr double DEFAULT_SYMBOL_RATE_HZ =
+        10.0;  ///< Default number of symbols per second.
+    static constexpr std::size_t DEFAULT_CONSTELLATION_SIZE =
+        4;  ///< Default number of distinct symbols.
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_CHUNK =
+        4096;  ///< Minimal number of samples generated by one thread.
+
+}  // namespace MGEN
+
+/**
+ * @struct TModulatedGeneratorParams
+ * @brief Contains parameters for generating a modulated signal line.
+ *
+ * @note Some parameters are optional and represented by std::optional. These
+ * can be set by the user or remain unset, in which case default values or
+ * behaviors are applied.
+ */
+struct TModulatedGeneratorParams {
+    // Signal parameters
+    double samplingFreq =
+        SL::DEFAULT_SAMPLING_FREQ_HZ;  ///< Sampling frequency of the signal, in
+                                       ///< Hz.
+    double duration =
+        SL::DEFAULT_DURATION_SECONDS;  ///< Duration of the signal, in seconds.
+    double carrierFreq =
+        MGEN::DEFAULT_CARRIER_FREQ_HZ;  ///< Carrier frequency, in Hz.
+    double initPhase =
+        SL::DEFAULT_INIT_PHASE;  ///< Initial phase of the carrier.
+    double offsetY   = SL::DEFAULT_OFFSET_Y;    ///< Vertical offset.
+    double amplitude = SL::DEFAULT_AMPLITUDE;  ///< Carrier amplitude.
+
+    // Modulation parameters
+    MGEN::Modulation modulation =
+        MGEN::DEFAULT_MODULATION;  ///< Kind of modulation.
+    double modulatingFreq =
+        MGEN::DEFAULT_MODULATING_FREQ_HZ;  ///< Frequency of the modulating
+                                           ///< tone (AM, FM, PM), in Hz.
+    double modulationIndex =
+        MGEN::DEFAULT_MODULATION_INDEX;  ///< AM depth or PM peak phase
+                                         ///< deviation, in radians.
+    double freqDeviation =
+        MGEN::DEFAULT_FREQ_DEVIATION_HZ;  ///< FM peak deviation or FSK half
+                                          ///< tone spacing, in Hz.
+    std::vector<std::size_t> symbols =
+        {};  ///< Symbol stream (FSK, PSK, QAM).
+    double symbolRate =
+        MGEN::DEFAULT_SYMBOL_RATE_HZ;  ///< Symbols per second (FSK, PSK,
+                                       ///< QAM).
+    std::size_t constellationSize =
+        MGEN::DEFAULT_CONSTELLATION_SIZE;  ///< Number of distinct symbols
+                                           ///< (a perfect square for QAM).
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of generation threads. If not set, the number
+                       ///< of hardware threads is used.
+
+    // Graphical parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        MGEN::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TModulatedGenerator
+ * @brief Class for generating a modulated signal line with specified
+ * parameters.
+ *
+ * @details Every sample is computed in closed form from its index (the phase of
+ * continuous-phase FSK is taken from a table of symbol start phases), so the
+ * whole waveform is produced in a single pass without intermediate signal
+ * lines, and the pass is split across threads.
+ */
+class TModulatedGenerator {
+   public:
+    /**
+     * @brief Constructs a TModulatedGenerator for an analog modulation.
+     *
+     * @param samplingFrequency The sampling frequency of the signal.
+     * @param duration The total duration of the signal.
+     * @param carrierFrequency The carrier frequency.
+     * @param modulation The kind of modulation.
+     * @param modulatingFrequency The frequency of the modulating tone.
+     * @param modulationIndex AM depth or PM peak phase deviation.
+     * @param freqDeviation FM peak deviation or FSK half tone spacing.
+     * @param amplitude The carrier amplitude.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TModulatedGenerator(
+        double           samplingFrequency   = SL::DEFAULT_SAMPLING_FREQ_HZ,
+        double           duration            = SL::DEFAULT_DURATION_SECONDS,
+        double           carrierFrequency    = MGEN::DEFAULT_CARRIER_FREQ_HZ,
+        MGEN::Modulation modulation          = MGEN::DEFAULT_MODULATION,
+        double           modulatingFrequency = MGEN::DEFAULT_MODULATING_FREQ_HZ,
+        double           modulationIndex     = MGEN::DEFAULT_MODULATION_INDEX,
+        double           freqDeviation       = MGEN::DEFAULT_FREQ_DEVIATION_HZ,
+        double           amplitude           = SL::DEFAULT_AMPLITUDE,
+        std::optional<std::string> xLabel    = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel    = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = MGEN::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TModulatedGenerator using a
+     * TModulatedGeneratorParams object.
+     *
+     * @param params A structure containing the parameters for the signal
+     * generation.
+     */
+    explicit TModulatedGenerator(TModulatedGeneratorParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TModulatedGenerator() = default;
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param generator A constant reference to the generator to copy.
+     */
+    TModulatedGenerator(const TModulatedGenerator& generator);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TModulatedGenerator(TModulatedGenerator&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param generator A constant reference to the generator to copy.
+     */
+    TModulatedGenerator& operator=(const TModulatedGenerator& generator);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TModulatedGenerator& operator=(TModulatedGenerator&&) noexcept = default;
+
+    /**
+     * @brief Retrieves a pointer to the generated signal line.
+     *
+     * @return const TSignalLine* A pointer to the generated signal line.
+     *
+     * @throws SignalProcessingError if the signal line is not generated.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters used for signal generation.
+     *
+     * @return const TModulatedGeneratorParams& A constant reference to the
+     * signal generation parameters.
+     */
+    [[nodiscard]] const TModulatedGeneratorParams& getParams() const;
+
+    /**
+     * @brief Checks if the signal has been generated.
+     *
+     * @return bool True if the signal has been generated, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Executes the signal generation process.
+     *
+     * @throws SignalProcessingError if the sampling parameters are invalid, if
+     * the modulating frequency is not positive for FM, or if the symbol
+     * stream, symbol rate or constellation size is invalid for FSK, PSK and
+     * QAM.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the generated signal line.
+    TModulatedGeneratorParams _params =
+        {};  ///< Parameters for generating the signal line.
+    bool _isExecuted =
+        false;  ///< Flag indicating whether the signal has been generated.
+
+    /**
+     * @brief Computes the samples of a range of indices.
+     *
+     * @param points Signal points to fill.
+     * @param begin First index of the range.
+     * @param end Index past the last one of the range.
+     * @param symbolPhases Carrier phase offsets at the symbol starts (FSK).
+     */
+    void generateRange(std::vector<Point>&        points,
+                       std::size_t                begin,
+                       std::size_t                end,
+                       const std::vector<double>& symbolPhases) const;
+};
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+ * @file TAdaptiveFilter.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TAdaptiveFilter class cancelling
+ * reference-correlated interference from a signal line.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TAdaptiveFilter.hpp"
+#include "TAdaptiveFilterBank.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TAdaptiveFilter::TAdaptiveFilter(const TSignalLine* primaryLine,
+                                 const TSignalLine* referenceLine,
+                                 const std::optional<ADF::Algorithm> algorithm,
+                                 const std::optional<std::size_t>    tapsCount,
+                                 const std::optional<double>         stepSize,
+                                 std::optional<std::string>          xLabel,
+                                 std::optional<std::string>          yLabel,
+                                 std::optional<std::string> graphLabel)
+    : TAdaptiveFilter(TAdaptiveFilterParams{
+          .primaryLine   = primaryLine,
+          .referenceLine = referenceLine,
+          .algorithm     = algorithm,
+          .tapsCount     = tapsCount,
+          .stepSize      = stepSize,
+          .xLabel        = std::move(xLabel),
+          .yLabel        = std::move(yLabel),
+          .graphLabel    = std::move(graphLabel)}) {}
+
+TAdaptiveFilter::TAdaptiveFilter(TAdaptiveFilterParams params)
+    : _params(std::move(params)), _bank(makeBankParams(_params)) {}
+
+const TSignalLine* TAdaptiveFilter::getSignalLine() const {
+    if (!_bank.isExecuted()) {
+        throw SignalProcessingError("Adaptive filter not executed");
+    }
+    return _bank.getSignalLine(0);
+}
+
+const std::vector<double>& TAdaptiveFilter::getCoefficients() const {
+    if (!_bank.isExecuted()) {
+        throw SignalProcessingError("Adaptive filter not executed");
+    }
+    return _bank.getCoefficients(0);
+}
+
+const TAdaptiveFilterParams& TAdaptiveFilter::getParams() const {
+    return _params;
+}
+
+bool TAdaptiveFilter::isExecuted() const {
+    return _bank.isExecuted();
+}
+
+void TAdaptiveFilter::execute() {
+    // We're ensuring that the signal lines are not null here because they may
+    // be set after the TAdaptiveFilter object creation.
+    if (_params.primaryLine == nullptr || _params.referenceLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    _bank.execute();
+}
+
+std::vector<double> TAdaptiveFilter::processBlock(
+    const std::span<const double> primary,
+    const std::span<const double> reference) {
+    auto errors = _bank.processBlock(reference, {primary});
+    return std::move(errors.front());
+}
+
+std::vector<double> TAdaptiveFilter::getStreamCoefficients() const {
+    return _bank.getStreamCoefficients(0);
+}
+
+void TAdaptiveFilter::reset() {
+    _bank.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TAdaptiveFilterBankParams TAdaptiveFilter::makeBankParams(
+    const TAdaptiveFilterParams& params) {
+    return TAdaptiveFilterBankParams{
+        .primaryLines     = {params.primaryLine},
+        .referenceLine    = params.referenceLine,
+        .algorithm        = params.algorithm,
+        .tapsCount        = params.tapsCount,
+        .stepSize         = params.stepSize,
+        .regularization   = params.regularization,
+        .forgettingFactor = params.forgettingFactor,
+        .initialInverse   = params.initialInverse,
+        .threadsCount     = params.threadsCount,
+        .xLabel           = params.xLabel,
+        .yLabel           = params.yLabel,
+        .graphLabel       = params.graphLabel};
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+/**
+ * @file TAdaptiveFilter.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TAdaptiveFilter class cancelling
+ * reference-correlated interference from a signal line.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TAdaptiveFilterBank.hpp"
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TAdaptiveFilterParams
+ * @brief Contains parameters used for adaptive filtering.
+ */
+struct TAdaptiveFilterParams {
+    // Signal Parameters
+    const TSignalLine* primaryLine =
+        nullptr;  ///< Pointer to the primary signal line (not needed for
+                  ///< streaming).
+    const TSignalLine* referenceLine =
+        nullptr;  ///< Pointer to the reference signal line (same points count;
+                  ///< not needed for streaming).
+
+    // Calculation Parameters
+    std::optional<ADF::Algorithm> algorithm =
+        ADF::DEFAULT_ALGORITHM;  ///< Coefficient update rule.
+    std::optional<std::size_t> tapsCount =
+        ADF::DEFAULT_TAPS_COUNT;  ///< Number of filter taps.
+    std::optional<double> stepSize =
+        ADF::DEFAULT_STEP_SIZE;  ///< Step size (LMS and NLMS).
+    std::optional<double> regularization =
+        ADF::DEFAULT_REGULARIZATION;  ///< Regularization of the NLMS
+                                      ///< normalization (positive).
+    std::optional<double> forgettingFactor =
+        ADF::DEFAULT_FORGETTING_FACTOR;  ///< RLS forgetting factor within
+                                         ///< (0, 1].
+    std::optional<double> initialInverse =
+        ADF::DEFAULT_INITIAL_INVERSE;  ///< Initial diagonal of the RLS inverse
+                                       ///< correlation matrix.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads used for the NLMS regressor norms.
+                       ///< If not set, the number of hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        ADF::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TAdaptiveFilter
+ * @brief Class for cancelling the interference correlated with a reference
+ * from a primary signal line.
+ *
+ * @details A single-channel TAdaptiveFilterBank: an FIR filter of `tapsCount`
+ * taps is adapted with the LMS, NLMS or RLS rule so that the filtered
+ * reference matches the primary line, and the output is the error, i.e. the
+ * primary line with the interference removed. See TAdaptiveFilterBank for the
+ * details; to clean several lines with the same reference use the bank
+ * directly, which shares the reference-only work between the channels.
+ */
+class TAdaptiveFilter {
+   public:
+    /**
+     * @brief Constructs a TAdaptiveFilter with a primary line and a reference.
+     *
+     * @param primaryLine Pointer to the primary signal line.
+     * @param referenceLine Pointer to the reference signal line.
+     * @param algorithm Coefficient update rule.
+     * @param tapsCount Number of filter taps.
+     * @param stepSize Step size (LMS and NLMS).
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    TAdaptiveFilter(
+        const TSignalLine*            primaryLine,
+        const TSignalLine*            referenceLine,
+        std::optional<ADF::Algorithm> algorithm  = ADF::DEFAULT_ALGORITHM,
+        std::optional<std::size_t>    tapsCount  = ADF::DEFAULT_TAPS_COUNT,
+        std::optional<double>         stepSize   = ADF::DEFAULT_STEP_SIZE,
+        std::optional<std::string>    xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string>    yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string>    graphLabel = ADF::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TAdaptiveFilter with filter parameters.
+     *
+     * @param params Structure containing the parameters of the filter.
+     */
+    explicit TAdaptiveFilter(TAdaptiveFilterParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TAdaptiveFilter() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TAdaptiveFilter(const TAdaptiveFilter&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TAdaptiveFilter(TAdaptiveFilter&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TAdaptiveFilter& operator=(const TAdaptiveFilter&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TAdaptiveFilter& operator=(TAdaptiveFilter&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the error signal line.
+     *
+     * @return const TSignalLine* A pointer to the error signal line.
+     *
+     * @throw SignalProcessingError If the filter has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the final filter coefficients.
+     *
+     * @return const std::vector<double>& The coefficients; `w[k]` weights the
+     * reference sample delayed by `k`.
+     *
+     * @throw SignalProcessingError If the filter has not been executed.
+     */
+    [[nodiscard]] const std::vector<double>& getCoefficients() const;
+
+    /**
+     * @brief Retrieves the parameters of the filter.
+     *
+     * @return const TAdaptiveFilterParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TAdaptiveFilterParams& getParams() const;
+
+    /**
+     * @brief Determines if the filter has been executed.
+     *
+     * @return bool True if the filter has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Adapts the filter over the whole signal lines.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If a line is null, if the points counts
+     * differ, or if the parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param primary Next primary samples.
+     * @param reference Next reference samples (as many as primary samples).
+     * @return std::vector<double> Errors of the block.
+     *
+     * @throws SignalProcessingError If the block sizes differ or if the
+     * parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> primary,
+        std::span<const double> reference);
+
+    /**
+     * @brief Retrieves the current filter coefficients of the stream.
+     *
+     * @return std::vector<double> The coefficients; `w[k]` weights the
+     * reference sample delayed by `k`.
+     *
+     * @throw SignalProcessingError If no block has been processed.
+     */
+    [[nodiscard]] std::vector<double> getStreamCoefficients() const;
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    TAdaptiveFilterParams _params = {};  ///< Parameters of the filter.
+    TAdaptiveFilterBank _bank;  ///< Single-channel bank doing the work.
+
+    /**
+     * @brief Converts the parameters into single-channel bank parameters.
+     *
+     * @param params Parameters of the filter.
+     * @return TAdaptiveFilterBankParams The bank parameters.
+     */
+    [[nodiscard]] static TAdaptiveFilterBankParams makeBankParams(
+        const TAdaptiveFilterParams& params);
+};
\ No newline at end of file
@@ -0,0 +1,350 @@
+/**
+ * @file TAdaptiveFilterBank.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TAdaptiveFilterBank class
+ * cancelling reference-correlated interference from several signal lines at
+ * once.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TAdaptiveFilterBank.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TAdaptiveFilterBank::TAdaptiveFilterBank(
+    std::vector<const TSignalLine*>     primaryLines,
+    const TSignalLine*                  referenceLine,
+    const std::optional<ADF::Algorithm> algorithm,
+    const std::optional<std::size_t>    tapsCount,
+    const std::optional<double>         stepSize,
+    std::optional<std::string>          xLabel,
+    std::optional<std::string>          yLabel,
+    std::optional<std::string>          graphLabel)
+    : _params{.primaryLines  = std::move(primaryLines),
+              .referenceLine = referenceLine,
+              .algorithm     = algorithm,
+              .tapsCount     = tapsCount,
+              .stepSize      = stepSize,
+              .xLabel        = std::move(xLabel),
+              .yLabel        = std::move(yLabel),
+              .graphLabel    = std::move(graphLabel)} {}
+
+TAdaptiveFilterBank::TAdaptiveFilterBank(TAdaptiveFilterBankParams params)
+    : _params(std::move(params)) {}
+
+const TSignalLine* TAdaptiveFilterBank::getSignalLine(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Adaptive filter bank not executed");
+    }
+    if (channel >= _lines.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return &_lines[channel];
+}
+
+const std::vector<double>& TAdaptiveFilterBank::getCoefficients(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Adaptive filter bank not executed");
+    }
+    if (channel >= _coefficients.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return _coefficients[channel];
+}
+
+const TAdaptiveFilterBankParams& TAdaptiveFilterBank::getParams() const {
+    return _params;
+}
+
+bool TAdaptiveFilterBank::isExecuted() const {
+    return _isExecuted;
+}
+
+void TAdaptiveFilterBank::execute() {
+    // We're ensuring that the signal lines are not null here because they may
+    // be set after the TAdaptiveFilterBank object creation.
+    if (_params.primaryLines.empty()) {
+        throw SignalProcessingError("No primary signal lines");
+    }
+    if (_params.referenceLine == nullptr ||
+        std::ranges::any_of(_params.primaryLines, [](const auto* line) {
+            return line == nullptr;
+        })) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       referencePoints = _params.referenceLine->getPoints();
+    const std::size_t pointsCount     = referencePoints.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    for (const auto* line : _params.primaryLines) {
+        if (line->getPoints().size() != pointsCount) {
+            throw SignalProcessingError(
+                "Primary and reference lines should have the same points "
+                "count");
+        }
+    }
+
+    const std::size_t channelsCount = _params.primaryLines.size();
+    State             state         = makeState(channelsCount);
+
+    std::vector<double> reference(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        reference[i] = referencePoints[i].y;
+    }
+    std::vector<std::vector<double>> primaries(channelsCount);
+    std::vector<std::span<const double>> primarySpans(channelsCount);
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        const auto& points = _params.primaryLines[c]->getPoints();
+        primaries[c].resize(pointsCount);
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            primaries[c][i] = points[i].y;
+        }
+        primarySpans[c] = primaries[c];
+    }
+
+    std::vector<std::vector<double>> errors;
+    adapt(state, reference, primarySpans, errors);
+
+    _lines.clear();
+    _lines.reserve(channelsCount);
+    _coefficients.assign(channelsCount, {});
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        const auto&        points = _params.primaryLines[c]->getPoints();
+        std::vector<Point> outputPoints(pointsCount);
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            outputPoints[i] = Point{.x = points[i].x, .y = errors[c][i]};
+        }
+
+        TSignalLineParams slParams = _params.primaryLines[c]->getParams();
+        slParams.xLabel            = _params.xLabel;
+        slParams.yLabel            = _params.yLabel;
+        slParams.graphLabel        = _params.graphLabel;
+        slParams.pointsCount       = pointsCount;
+        _lines.emplace_back(slParams, SL::Preference::PreferPointsCount);
+        _lines.back().setPoints(std::move(outputPoints));
+
+        _coefficients[c].assign(state.weights[c].rbegin(),
+                                state.weights[c].rend());
+    }
+
+    _isExecuted = true;
+}
+
+std::vector<std::vector<double>> TAdaptiveFilterBank::processBlock(
+    const std::span<const double>               reference,
+    const std::vector<std::span<const double>>& primaries) {
+    if (primaries.empty()) {
+        throw SignalProcessingError("No primary channels");
+    }
+    for (const auto& primary : primaries) {
+        if (primary.size() != reference.size()) {
+            throw SignalProcessingError(
+                "Primary and reference blocks should have the same size");
+        }
+    }
+    if (!_stream) {
+        _stream = makeState(primaries.size());
+    } else if (_stream->weights.size() != primaries.size()) {
+        throw SignalProcessingError(
+            "Number of channels differs from the first block");
+    }
+
+    std::vector<std::vector<double>> errors;
+    adapt(*_stream, reference, primaries, errors);
+    return errors;
+}
+
+std::vector<double> TAdaptiveFilterBank::getStreamCoefficients(
+    const std::size_t channel) const {
+    if (!_stream) {
+        throw SignalProcessingError("No block has been processed");
+    }
+    if (channel >= _stream->weights.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    const auto& weights = _stream->weights[channel];
+    return {weights.rbegin(), weights.rend()};
+}
+
+void TAdaptiveFilterBank::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TAdaptiveFilterBank::State TAdaptiveFilterBank::makeState(
+    const std::size_t channelsCount) const {
+    const std::size_t tapsCount =
+        _params.tapsCount.value_or(ADF::DEFAULT_TAPS_COUNT);
+    if (tapsCount == 0) {
+        throw SignalProcessingError("Number of taps should be positive");
+    }
+    if (_params.stepSize.value_or(ADF::DEFAULT_STEP_SIZE) <= 0.0) {
+        throw SignalProcessingError("Step size should be positive");
+    }
+    if (_params.regularization.value_or(ADF::DEFAULT_REGULARIZATION) <= 0.0) {
+        throw SignalProcessingError("Regularization should be positive");
+    }
+    const double forgettingFactor =
+        _params.forgettingFactor.value_or(ADF::DEFAULT_FORGETTING_FACTOR);
+    if (forgettingFactor <= 0.0 || forgettingFactor > 1.0) {
+        throw SignalProcessingError(
+            "Forgetting factor should be within (0, 1]");
+    }
+    const double initialInverse =
+        _params.initialInverse.value_or(ADF::DEFAULT_INITIAL_INVERSE);
+    if (initialInverse <= 0.0) {
+        throw SignalProcessingError("Initial inverse should be positive");
+    }
+
+    State state{
+        .weights = std::vector<std::vector<double>>(
+            channelsCount, std::vector<double>(tapsCount, 0.0)),
+        .history = std::vector<double>(tapsCount - 1, 0.0)};
+    if (_params.algorithm.value_or(ADF::DEFAULT_ALGORITHM) ==
+        ADF::Algorithm::RLS) {
+        state.inverse.assign(tapsCount * tapsCount, 0.0);
+        for (std::size_t i = 0; i < tapsCount; ++i) {
+            state.inverse[i * tapsCount + i] = initialInverse;
+        }
+    }
+    return state;
+}
+
+void TAdaptiveFilterBank::adapt(
+    State&                                      state,
+    const std::span<const double>               reference,
+    const std::vector<std::span<const double>>& primaries,
+    std::vector<std::vector<double>>&           errors) const {
+    const std::size_t channelsCount = primaries.size();
+    const std::size_t count         = reference.size();
+    const std::size_t taps          = state.history.size() + 1;
+
+    // The regressor of sample n is buffer[n] ... buffer[n + taps - 1], the
+    // newest sample last; the weights are stored in the same order
+    const std::size_t   historyLength = state.history.size();
+    std::vector<double> buffer(historyLength + count);
+    std::copy(state.history.begin(), state.history.end(), buffer.begin());
+    std::copy(reference.begin(), reference.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    errors.assign(channelsCount, std::vector<double>(count));
+    const ADF::Algorithm algorithm =
+        _params.algorithm.value_or(ADF::DEFAULT_ALGORITHM);
+
+    if (algorithm == ADF::Algorithm::RLS) {
+        const double lambda =
+            _params.forgettingFactor.value_or(ADF::DEFAULT_FORGETTING_FACTOR);
+        std::vector<double>& inverse = state.inverse;
+        std::vector<double>  product(taps);
+        std::vector<double>  gain(taps);
+        for (std::size_t n = 0; n < count; ++n) {
+            const double* x = buffer.data() + n;
+
+            // Gain vector, shared by all channels
+            double denominator = lambda;
+            for (std::size_t i = 0; i < taps; ++i) {
+                const double* row = inverse.data() + i * taps;
+                double        sum = 0.0;
+                for (std::size_t j = 0; j < taps; ++j) {
+                    sum += row[j] * x[j];
+                }
+                product[i] = sum;
+                denominator += x[i] * sum;
+            }
+            for (std::size_t i = 0; i < taps; ++i) {
+                gain[i] = product[i] / denominator;
+            }
+
+            for (std::size_t c = 0; c < channelsCount; ++c) {
+                double* w        = state.weights[c].data();
+                double  estimate = 0.0;
+                for (std::size_t j = 0; j < taps; ++j) {
+                    estimate += w[j] * x[j];
+                }
+                const double error = primaries[c][n] - estimate;
+                errors[c][n]       = error;
+                for (std::size_t j = 0; j < taps; ++j) {
+                    w[j] += gain[j] * error;
+                }
+            }
+
+            for (std::size_t i = 0; i < taps; ++i) {
+                double*      row    = inverse.data() + i * taps;
+                const double factor = gain[i];
+                for (std::size_t j = 0; j < taps; ++j) {
+                    row[j] = (row[j] - factor * product[j]) / lambda;
+                }
+            }
+        }
+    } else {
+        // Step of every sample; for NLMS it is normalized by the regressor
+        // energy, computed once for all channels
+        const double stepSize =
+            _params.stepSize.value_or(ADF::DEFAULT_STEP_SIZE);
+        std::vector<double> steps(count, stepSize);
+        if (algorithm == ADF::Algorithm::NLMS) {
+            const double regularization =
+                _params.regularization.value_or(ADF::DEFAULT_REGULARIZATION);
+            PAR::parallelFor(
+                count,
+                [&](const std::size_t begin, const std::size_t end) {
+                    for (std::size_t n = begin; n < end; ++n) {
+                        const double* x      = buffer.data() + n;
+                        double        energy = 0.0;
+                        for (std::size_t j = 0; j < taps; ++j) {
+                            energy += x[j] * x[j];
+                        }
+                        steps[n] = stepSize / (regularization + energy);
+                    }
+                },
+                _params.threadsCount, ADF::SAMPLES_PER_CHUNK);
+        }
+
+        PAR::parallelFor(
+            channelsCount,
+            [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t c = begin; c < end; ++c) {
+                    double*       w       = state.weights[c].data();
+                    const double* primary = primaries[c].data();
+                    double*       error   = errors[c].data();
+                    for (std::size_t n = 0; n < count; ++n) {
+                        const double* x        = buffer.data() + n;
+                        double        estimate = 0.0;
+                        for (std::size_t j = 0; j < taps; ++j) {
+                            estimate += w[j] * x[j];
+                        }
+                        error[n]           = primary[n] - estimate;
+                        const double scale = steps[n] * error[n];
+                        for (std::size_t j = 0; j < taps; ++j) {
+                            w[j] += scale * x[j];
+                        }
+                    }
+                }
+            },
+            _params.threadsCount, 1);
+    }
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), state.history.begin());
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+/**
+ * @file TAdaptiveFilterBank.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TAdaptiveFilterBank class cancelling
+ * reference-correlated interference from several signal lines at once.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace ADF
+ * @brief Contains algorithms and default parameters used for adaptive
+ * filtering.
+ */
+namespace ADF {
+
+    /**
+     * @enum Algorithm
+     * @brief Specifies the coefficient update rule.
+     */
+    enum class Algorithm : std::uint8_t {
+        LMS,   ///< Least mean squares: `w += mu * e * x`.
+        NLMS,  ///< Normalized LMS: `w += mu * e * x / (eps + |x|^2)`.
+        RLS    ///< Recursive least squares with exponential forgetting.
+    };
+
+    static constexpr auto DEFAULT_ALGORITHM =
+        Algorithm::NLMS;  ///< Default update rule.
+    static constexpr std::size_t DEFAULT_TAPS_COUNT =
+        32;  ///< Default number of filter taps.
+    static constexpr double DEFAULT_STEP_SIZE =
+        0.5;  ///< Default step size (LMS and NLMS).
+    static constexpr double DEFAULT_REGULARIZATION =
+        1e-6;  ///< Default regularization of the NLMS normalization.
+    static constexpr double DEFAULT_FORGETTING_FACTOR =
+        0.999;  ///< Default RLS forgetting factor.
+    static constexpr double DEFAULT_INITIAL_INVERSE =
+        100.0;  ///< Default initial diagonal of the RLS inverse correlation
+                ///< matrix.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Adaptive Filter Error";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_CHUNK =
+        4096;  ///< Minimal number of regressor norms computed by one thread.
+
+}  // namespace ADF
+
+/**
+ * @struct TAdaptiveFilterBankParams
+ * @brief Contains parameters used for adaptive filtering of several signal
+ * lines with a shared reference.
+ */
+struct TAdaptiveFilterBankParams {
+    // Signal Parameters
+    std::vector<const TSignalLine*>
+        primaryLines;  ///< Pointers to the primary signal lines (not needed for
+                       ///< streaming).
+    const TSignalLine* referenceLine =
+        nullptr;  ///< Pointer to the reference signal line (same points count;
+                  ///< not needed for streaming).
+
+    // Calculation Parameters
+    std::optional<ADF::Algorithm> algorithm =
+        ADF::DEFAULT_ALGORITHM;  ///< Coefficient update rule.
+    std::optional<std::size_t> tapsCount =
+        ADF::DEFAULT_TAPS_COUNT;  ///< Number of filter taps.
+    std::optional<double> stepSize =
+        ADF::DEFAULT_STEP_SIZE;  ///< Step size (LMS and NLMS). NLMS is stable
+                                 ///< within (0, 2); for LMS it should be below
+                                 ///< `2 / (taps * reference power)`.
+    std::optional<double> regularization =
+        ADF::DEFAULT_REGULARIZATION;  ///< Regularization of the NLMS
+                                      ///< normalization (positive, so that a
+                                      ///< silent reference gives a finite
+                                      ///< step).
+    std::optional<double> forgettingFactor =
+        ADF::DEFAULT_FORGETTING_FACTOR;  ///< RLS forgetting factor within
+                                         ///< (0, 1].
+    std::optional<double> initialInverse =
+        ADF::DEFAULT_INITIAL_INVERSE;  ///< Initial diagonal of the RLS inverse
+                                       ///< correlation matrix.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        ADF::DEFAULT_GRAPH_LABEL;  ///< Label for the graphs.
+};
+
+/**
+ * @class TAdaptiveFilterBank
+ * @brief Class for cancelling the interference correlated with one reference
+ * from several primary signal lines.
+ *
+ * @details Every channel adapts an FIR filter `w` of `tapsCount` taps so that
+ * the filtered reference `y[n] = sum_k w[k] * r[n - k]` matches its primary
+ * line `d`; the output is the a priori error `e[n] = d[n] - y[n]`, i.e. the
+ * primary line with the interference removed. Reference samples before the
+ * start are zero.
+ *
+ * The regressor `r[n - M + 1] ... r[n]` of all channels is the same window of
+ * the reference, so the coefficients are stored in reversed order and every
+ * update is a contiguous dot product followed by a contiguous
+ * `w += g * e * x`, both vectorized by the compiler. The rest of the work is
+ * shared as well:
+ *
+ * - NLMS: the regressor norms are computed once for all channels (in
+ *   parallel) and the channels are then adapted on several threads;
+ * - LMS: the channels are adapted on several threads;
+ * - RLS: the gain vector and the inverse correlation matrix depend only on
+ *   the reference, so the `O(M^2)` update is done once per sample and every
+ *   channel costs `O(M)`.
+ *
+ * `processBlock()` processes a stream block by block and yields exactly the
+ * same errors as `execute()` for the concatenated blocks.
+ */
+class TAdaptiveFilterBank {
+   public:
+    /**
+     * @brief Constructs a TAdaptiveFilterBank with primary lines and a
+     * reference.
+     *
+     * @param primaryLines Pointers to the primary signal lines.
+     * @param referenceLine Pointer to the reference signal line.
+     * @param algorithm Coefficient update rule.
+     * @param tapsCount Number of filter taps.
+     * @param stepSize Step size (LMS and NLMS).
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graphs.
+     */
+    TAdaptiveFilterBank(
+        std::vector<const TSignalLine*> primaryLines,
+        const TSignalLine*              referenceLine,
+        std::optional<ADF::Algorithm>   algorithm  = ADF::DEFAULT_ALGORITHM,
+        std::optional<std::size_t>      tapsCount  = ADF::DEFAULT_TAPS_COUNT,
+        std::optional<double>           stepSize   = ADF::DEFAULT_STEP_SIZE,
+        std::optional<std::string>      xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string>      yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string>      graphLabel = ADF::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TAdaptiveFilterBank with filter parameters.
+     *
+     * @param params Structure containing the parameters of the bank.
+     */
+    explicit TAdaptiveFilterBank(TAdaptiveFilterBankParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TAdaptiveFilterBank() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TAdaptiveFilterBank(const TAdaptiveFilterBank&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TAdaptiveFilterBank(TAdaptiveFilterBank&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TAdaptiveFilterBank& operator=(const TAdaptiveFilterBank&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TAdaptiveFilterBank& operator=(TAdaptiveFilterBank&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the error signal line of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const TSignalLine* A pointer to the error signal line.
+     *
+     * @throw SignalProcessingError If the bank has not been executed or if the
+     * index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine(std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the final filter coefficients of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const std::vector<double>& The coefficients; `w[k]` weights the
+     * reference sample delayed by `k`.
+     *
+     * @throw SignalProcessingError If the bank has not been executed or if the
+     * index is out of bounds.
+     */
+    [[nodiscard]] const std::vector<double>& getCoefficients(
+        std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the parameters of the bank.
+     *
+     * @return const TAdaptiveFilterBankParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TAdaptiveFilterBankParams& getParams() const;
+
+    /**
+     * @brief Determines if the bank has been executed.
+     *
+     * @return bool True if the bank has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Adapts the filters over the whole signal lines.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If there are no primary lines, if a line
+     * is null, if the points counts differ, or if the parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param reference Next reference samples.
+     * @param primaries Next primary samples of every channel (as many as
+     * reference samples).
+     * @return std::vector<std::vector<double>> Errors of every channel.
+     *
+     * @throws SignalProcessingError If there are no channels, if the number of
+     * channels differs from the first block, if a block size does not match,
+     * or if the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<std::vector<double>> processBlock(
+        std::span<const double>                     reference,
+        const std::vector<std::span<const double>>& primaries);
+
+    /**
+     * @brief Retrieves the current filter coefficients of a streamed channel.
+     *
+     * @param channel Index of the channel.
+     * @return std::vector<double> The coefficients; `w[k]` weights the
+     * reference sample delayed by `k`.
+     *
+     * @throw SignalProcessingError If the index is out of bounds or no block
+     * has been processed.
+     */
+    [[nodiscard]] std::vector<double> getStreamCoefficients(
+        std::size_t channel) const;
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Adaptation state shared by whole-line and streaming processing.
+     */
+    struct State {
+        std::vector<std::vector<double>> weights =
+            {};  ///< Coefficients of every channel in reversed order.
+        std::vector<double> history =
+            {};  ///< Last `M - 1` reference samples.
+        std::vector<double> inverse =
+            {};  ///< RLS inverse correlation matrix (`M * M` values).
+    };
+
+    std::vector<TSignalLine> _lines = {};  ///< Error lines of the channels.
+    std::vector<std::vector<double>> _coefficients =
+        {};  ///< Final coefficients of the channels.
+    TAdaptiveFilterBankParams _params = {};  ///< Parameters of the bank.
+    std::optional<State>      _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the bank has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh state.
+     *
+     * @param channelsCount Number of channels.
+     * @return State The initial state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState(std::size_t channelsCount) const;
+
+    /**
+     * @brief Adapts all channels over a run of samples.
+     *
+     * @param state State to continue from; updated in place.
+     * @param reference Reference samples.
+     * @param primaries Primary samples of every channel.
+     * @param errors Receives the errors of every channel.
+     */
+    void adapt(State&                                      state,
+               std::span<const double>                     reference,
+               const std::vector<std::span<const double>>& primaries,
+               std::vector<std::vector<double>>&           errors) const;
+};
\ No newline at end of file
@@ -0,0 +1,384 @@
+/**
+ * @file TCICFilter.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TCICFilter class implementing the
+ * cascaded integrator-comb decimator and interpolator.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TCICFilter.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TCICFilter::TCICFilter(const TSignalLine*               signalLine,
+                       const std::optional<CIC::Mode>   mode,
+                       const std::optional<std::size_t> rate,
+                       const std::optional<std::size_t> order,
+                       const std::optional<std::size_t> differentialDelay,
+                       const std::optional<double>      fullScale,
+                       const std::optional<bool>        compensate)
+    : _params{.signalLine        = signalLine,
+              .mode              = mode,
+              .rate              = rate,
+              .order             = order,
+              .differentialDelay = differentialDelay,
+              .fullScale         = fullScale,
+              .compensate        = compensate} {}
+
+TCICFilter::TCICFilter(TCICFilterParams params) : _params(std::move(params)) {}
+
+TCICFilter::TCICFilter(const TCICFilter& filter)
+    : _sl(filter._sl ? std::make_unique<TSignalLine>(*filter._sl) : nullptr),
+      _params(filter._params),
+      _stream(filter._stream),
+      _isExecuted(filter._isExecuted) {}
+
+TCICFilter& TCICFilter::operator=(const TCICFilter& filter) {
+    if (this == &filter) {
+        return *this;
+    }
+    _sl = filter._sl ? std::make_unique<TSignalLine>(*filter._sl) : nullptr;
+    _params     = filter._params;
+    _stream     = filter._stream;
+    _isExecuted = filter._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TCICFilter::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("CIC filter not executed");
+    }
+    return _sl.get();
+}
+
+const TCICFilterParams& TCICFilter::getParams() const {
+    return _params;
+}
+
+bool TCICFilter::isExecuted() const {
+    return _isExecuted;
+}
+
+void TCICFilter::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TCICFilter object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    double fullScale = 0.0;
+    if (_params.fullScale) {
+        fullScale = *_params.fullScale;
+    } else {
+        fullScale = std::max(std::abs(_params.signalLine->findMax()),
+                             std::abs(_params.signalLine->findMin()));
+        if (fullScale == 0.0) {
+            fullScale = CIC::DEFAULT_FULL_SCALE;
+        }
+    }
+    State state = makeState(fullScale);
+
+    std::vector<double> samples(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        samples[i] = points[i].y;
+    }
+    const auto output = process(state, samples);
+
+    const std::size_t rate = _params.rate.value_or(CIC::DEFAULT_RATE);
+    const bool        decimate =
+        _params.mode.value_or(CIC::DEFAULT_MODE) == CIC::Mode::Decimator;
+    std::vector<Point> outputPoints(output.size());
+    for (std::size_t j = 0; j < output.size(); ++j) {
+        double x = 0.0;
+        if (decimate) {
+            // Output sample m is computed at the input sample m * rate
+            x = points[j * rate].x;
+        } else {
+            // Interpolated samples are evenly spaced between the input ones
+            const std::size_t i = j / rate;
+            double            step = 0.0;
+            if (i + 1 < pointsCount) {
+                step = points[i + 1].x - points[i].x;
+            } else if (i > 0) {
+                step = points[i].x - points[i - 1].x;
+            }
+            x = points[i].x + step * static_cast<double>(j % rate) /
+                                  static_cast<double>(rate);
+        }
+        outputPoints[j] = Point{.x = x, .y = output[j]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    if (slParams.samplingFrequency) {
+        slParams.samplingFrequency =
+            decimate ? *slParams.samplingFrequency / static_cast<double>(rate)
+                     : *slParams.samplingFrequency * static_cast<double>(rate);
+    }
+    slParams.xLabel      = _params.xLabel;
+    slParams.yLabel      = _params.yLabel;
+    slParams.graphLabel  = _params.graphLabel;
+    slParams.pointsCount = output.size();
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+std::vector<double> TCICFilter::processBlock(
+    const std::span<const double> samples) {
+    if (!_stream) {
+        if (!_params.fullScale) {
+            throw SignalProcessingError(
+                "Full scale should be set for streaming");
+        }
+        _stream = makeState(*_params.fullScale);
+    }
+    return process(*_stream, samples);
+}
+
+void TCICFilter::reset() {
+    _stream.reset();
+}
+
+std::vector<double> TCICFilter::designCompensator(
+    const std::size_t length,
+    const std::size_t order,
+    const std::size_t rate,
+    const std::size_t differentialDelay,
+    const double      passband,
+    const std::size_t followingDecimation) {
+    if (length % 2 == 0) {
+        throw SignalProcessingError("Compensator taps count should be odd");
+    }
+    if (passband <= 0.0 || passband >= 1.0) {
+        throw SignalProcessingError("Passband should be within (0, 1)");
+    }
+
+    const double cutoff = passband / 2.0;  // cycles per low-rate sample
+    const double step =
+        cutoff / static_cast<double>(CIC::COMPENSATOR_GRID_SIZE);
+    const double span =
+        static_cast<double>(rate) * static_cast<double>(differentialDelay);
+
+    std::vector<double> desired(CIC::COMPENSATOR_GRID_SIZE);
+    for (std::size_t g = 0; g < CIC::COMPENSATOR_GRID_SIZE; ++g) {
+        // Frequency in cycles per high-rate sample
+        const double frequency =
+            (static_cast<double>(g) + 0.5) * step /
+            (static_cast<double>(rate) *
+             static_cast<double>(followingDecimation));
+        const double response =
+            sin(M_PI * frequency * span) / (span * sin(M_PI * frequency));
+        desired[g] = 1.0 / std::pow(std::abs(response),
+                                    static_cast<double>(order));
+    }
+
+    const auto   window = WIN::makeWindow(WIN::WindowType::Hamming, length);
+    const double center = static_cast<double>(length - 1) / 2.0;
+    std::vector<double> taps(length);
+    double              gain = 0.0;
+    for (std::size_t n = 0; n < length; ++n) {
+        const double offset = static_cast<double>(n) - center;
+        double       sum    = 0.0;
+        for (std::size_t g = 0; g < CIC::COMPENSATOR_GRID_SIZE; ++g) {
+            const double frequency = (static_cast<double>(g) + 0.5) * step;
+            sum += desired[g] * cos(TWO_PI * frequency * offset);
+        }
+        taps[n] = window[n] * 2.0 * sum * step;
+        gain += taps[n];
+    }
+    for (auto& tap : taps) {
+        tap /= gain;
+    }
+    return taps;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TCICFilter::State TCICFilter::makeState(const double fullScale) const {
+    const auto        mode  = _params.mode.value_or(CIC::DEFAULT_MODE);
+    const std::size_t rate  = _params.rate.value_or(CIC::DEFAULT_RATE);
+    const std::size_t order = _params.order.value_or(CIC::DEFAULT_ORDER);
+    const std::size_t differentialDelay =
+        _params.differentialDelay.value_or(CIC::DEFAULT_DIFFERENTIAL_DELAY);
+    if (mode != CIC::Mode::Decimator && mode != CIC::Mode::Interpolator) {
+        throw SignalProcessingError("Invalid CIC mode");
+    }
+    if (rate == 0 || order == 0 || differentialDelay == 0) {
+        throw SignalProcessingError(
+            "CIC rate, order and differential delay should be positive");
+    }
+    if (fullScale <= 0.0) {
+        throw SignalProcessingError("Full scale should be positive");
+    }
+
+    // The widest input that keeps the bit growth within the accumulators
+    const double span =
+        static_cast<double>(rate) * static_cast<double>(differentialDelay);
+    const auto growth = static_cast<std::size_t>(
+        ceil(static_cast<double>(order) * std::log2(span)));
+    if (growth + CIC::MIN_INPUT_BITS + 1 > CIC::ACCUMULATOR_BITS) {
+        throw SignalProcessingError(
+            "CIC bit growth exceeds the accumulator width");
+    }
+    const std::size_t inputBits =
+        std::min(CIC::MAX_INPUT_BITS, CIC::ACCUMULATOR_BITS - 1 - growth);
+
+    State state;
+    state.integrators.assign(order, 0);
+    state.combDelays.assign(order * differentialDelay, 0);
+
+    double gain = std::pow(span, static_cast<double>(order));
+    if (mode == CIC::Mode::Interpolator) {
+        gain /= static_cast<double>(rate);
+    }
+    if (_params.compensate.value_or(CIC::DEFAULT_COMPENSATE)) {
+        state.compensator = designCompensator(
+            _params.compensatorTaps.value_or(CIC::DEFAULT_COMPENSATOR_TAPS),
+            order, rate, differentialDelay,
+            _params.passband.value_or(CIC::DEFAULT_PASSBAND));
+        state.compensatorHistory.assign(state.compensator.size() - 1, 0.0);
+    }
+
+    // The interpolator quantizes the compensator output, which may overshoot
+    // the full scale by up to the sum of the tap magnitudes
+    double peak = fullScale;
+    if (mode == CIC::Mode::Interpolator) {
+        double overshoot = 0.0;
+        for (const double tap : state.compensator) {
+            overshoot += std::abs(tap);
+        }
+        peak *= std::max(1.0, overshoot);
+    }
+    const double inputRange =
+        std::ldexp(1.0, static_cast<int>(inputBits) - 1) - 1.0;
+    state.fullScale   = fullScale;
+    state.inputScale  = inputRange / peak;
+    state.inputLimit  = inputRange;
+    state.outputScale = peak / (inputRange * gain);
+    return state;
+}
+
+std::vector<double> TCICFilter::process(
+    State&                        state,
+    const std::span<const double> samples) const {
+    for (const double sample : samples) {
+        if (!(std::abs(sample) <= state.fullScale)) {
+            throw SignalProcessingError("Input sample exceeds the full scale");
+        }
+    }
+
+    const std::size_t rate  = _params.rate.value_or(CIC::DEFAULT_RATE);
+    // The clamp only absorbs rounding at the edges of the range
+    const auto quantize = [&](const double value) {
+        const double scaled = std::clamp(value * state.inputScale,
+                                         -state.inputLimit, state.inputLimit);
+        return static_cast<CIC::Accumulator>(
+            static_cast<CIC::SignedAccumulator>(std::llround(scaled)));
+    };
+    const auto toDouble = [&](const CIC::Accumulator value) {
+        return static_cast<double>(static_cast<CIC::SignedAccumulator>(value)) *
+               state.outputScale;
+    };
+
+    std::vector<double> output;
+    if (_params.mode.value_or(CIC::DEFAULT_MODE) == CIC::Mode::Decimator) {
+        output.reserve(samples.size() / rate + 1);
+        for (const double sample : samples) {
+            CIC::Accumulator value = quantize(sample);
+            for (auto& integrator : state.integrators) {
+                integrator += value;
+                value = integrator;
+            }
+            // Outputs are taken at the input samples whose index is a
+            // multiple of the rate.
+            if (state.samplesCount % rate == 0) {
+                output.push_back(toDouble(comb(state, value)));
+            }
+            ++state.samplesCount;
+        }
+        compensate(state, output);
+    } else {
+        std::vector<double> input(samples.begin(), samples.end());
+        compensate(state, input);
+
+        output.reserve(input.size() * rate);
+        for (const double sample : input) {
+            const CIC::Accumulator combed = comb(state, quantize(sample));
+            for (std::size_t r = 0; r < rate; ++r) {
+                // Zero stuffing between the low-rate samples
+                CIC::Accumulator value = r == 0 ? combed : 0;
+                for (auto& integrator : state.integrators) {
+                    integrator += value;
+                    value = integrator;
+                }
+                output.push_back(toDouble(value));
+            }
+            ++state.samplesCount;
+        }
+    }
+    return output;
+}
+
+void TCICFilter::compensate(State& state, std::vector<double>& data) {
+    if (state.compensator.empty()) {
+        return;
+    }
+
+    const std::size_t   historyLength = state.compensatorHistory.size();
+    std::vector<double> buffer(historyLength + data.size());
+    std::copy(state.compensatorHistory.begin(), state.compensatorHistory.end(),
+              buffer.begin());
+    std::copy(data.begin(), data.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const double* current = buffer.data() + historyLength + i;
+        double        sum     = 0.0;
+        for (std::size_t t = 0; t < state.compensator.size(); ++t) {
+            sum += state.compensator[t] * *(current - t);
+        }
+        data[i] = sum;
+    }
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), state.compensatorHistory.begin());
+}
+
+CIC::Accumulator TCICFilter::comb(State& state, CIC::Accumulator value) {
+    const std::size_t order = state.integrators.size();
+    const std::size_t delay = state.combDelays.size() / order;
+    for (std::size_t k = 0; k < order; ++k) {
+        CIC::Accumulator& delayed =
+            state.combDelays[k * delay + state.combPosition];
+        const CIC::Accumulator input = value;
+        value -= delayed;
+        delayed = input;
+    }
+    state.combPosition = (state.combPosition + 1) % delay;
+    return value;
+}
\ No newline at end of file
@@ -0,0 +1,361 @@
+/**
+ * @file TCICFilter.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TCICFilter class implementing the
+ * cascaded integrator-comb decimator and interpolator.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace CIC
+ * @brief Contains default parameters used by CIC filters.
+ */
+namespace CIC {
+
+    /**
+     * @enum Mode
+     * @brief Enumerates the directions of the sampling rate change.
+     */
+    enum class Mode : std::uint8_t {
+        Decimator,    ///< Integrators at the input rate, combs at the output
+                      ///< rate.
+        Interpolator  ///< Combs at the input rate, integrators at the output
+                      ///< rate.
+    };
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ using Int128  = __int128;  ///< Signed 128-bit integer.
+    __extension__ using UInt128 = unsigned __int128;  ///< Unsigned 128-bit
+                                                      ///< integer.
+    using Accumulator       = UInt128;  ///< Modular accumulator type.
+    using SignedAccumulator = Int128;   ///< Signed counterpart of the
+                                        ///< accumulator type.
+#else
+    using Accumulator       = std::uint64_t;  ///< Modular accumulator type.
+    using SignedAccumulator = std::int64_t;   ///< Signed counterpart of the
+                                              ///< accumulator type.
+#endif
+
+    static constexpr auto DEFAULT_MODE =
+        Mode::Decimator;  ///< Default direction of the rate change.
+    static constexpr std::size_t DEFAULT_RATE =
+        100;  ///< Default rate change factor.
+    static constexpr std::size_t DEFAULT_ORDER =
+        4;  ///< Default number of integrator and comb sections.
+    static constexpr std::size_t DEFAULT_DIFFERENTIAL_DELAY =
+        1;  ///< Default differential delay of the combs.
+    static constexpr double DEFAULT_FULL_SCALE =
+        1.0;  ///< Full scale used when none is set and the signal line is all
+              ///< zeros, so that no magnitude can be derived from it.
+    static constexpr bool DEFAULT_COMPENSATE =
+        true;  ///< Default flag enabling the droop compensation filter.
+    static constexpr std::size_t DEFAULT_COMPENSATOR_TAPS =
+        33;  ///< Default number of taps of the compensation filter (odd).
+    static constexpr double DEFAULT_PASSBAND =
+        0.8;  ///< Default passband edge of the compensator as a fraction of the
+              ///< Nyquist frequency of the low rate.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "CIC Filter";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t ACCUMULATOR_BITS =
+        sizeof(Accumulator) * 8;  ///< Width of the accumulators, in bits.
+    static constexpr std::size_t MAX_INPUT_BITS =
+        52;  ///< Maximal width of the quantized input samples, in bits.
+    static constexpr std::size_t MIN_INPUT_BITS =
+        16;  ///< Minimal acceptable width of the quantized input samples.
+    static constexpr std::size_t COMPENSATOR_GRID_SIZE =
+        512;  ///< Number of frequency samples used to design the compensator.
+
+}  // namespace CIC
+
+/**
+ * @struct TCICFilterParams
+ * @brief Contains parameters used by CIC filters.
+ */
+struct TCICFilterParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the input signal line (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<CIC::Mode> mode =
+        CIC::DEFAULT_MODE;  ///< Direction of the rate change.
+    std::optional<std::size_t> rate =
+        CIC::DEFAULT_RATE;  ///< Rate change factor.
+    std::optional<std::size_t> order =
+        CIC::DEFAULT_ORDER;  ///< Number of integrator and comb sections.
+    std::optional<std::size_t> differentialDelay =
+        CIC::DEFAULT_DIFFERENTIAL_DELAY;  ///< Differential delay of the combs.
+    std::optional<double> fullScale =
+        std::nullopt;  ///< Largest input magnitude, mapped to the full integer
+                       ///< input range; larger samples are rejected. If not
+                       ///< set, the largest magnitude of the signal line is
+                       ///< used (required for streaming).
+    std::optional<bool> compensate =
+        CIC::DEFAULT_COMPENSATE;  ///< Flag enabling the droop compensation
+                                  ///< filter.
+    std::optional<std::size_t> compensatorTaps =
+        CIC::DEFAULT_COMPENSATOR_TAPS;  ///< Number of compensator taps.
+    std::optional<double> passband =
+        CIC::DEFAULT_PASSBAND;  ///< Passband edge of the compensator as a
+                                ///< fraction of the low-rate Nyquist frequency.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        CIC::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TCICFilter
+ * @brief Class for changing the sampling rate of a signal line by large
+ * factors with a cascaded integrator-comb (CIC) filter.
+ *
+ * @details A CIC filter of order `N`, rate factor `R` and differential delay
+ * `M` has the response
+ *
+ * `H(z) = ((1 - z^-(R*M)) / (1 - z^-1))^N`
+ *
+ * and needs only additions: `N` integrators run at the high rate and `N` combs
+ * at the low rate, so the cost per sample does not depend on `R`. The
+ * decimator places the integrators before the rate change, the interpolator
+ * after it.
+ *
+ * The input samples are quantized to integers (`fullScale` maps to the
+ * largest input value, leaving headroom for the overshoot of the interpolator
+ * compensator) and all sections use modular integer accumulators of
+ * `CIC::ACCUMULATOR_BITS` bits (128 where the compiler supports it, 64
+ * otherwise). The wrap-arounds of the integrators are cancelled exactly by the
+ * combs, so the integrators never drift, however long the stream. The input
+ * width is chosen so that the bit growth `N * log2(R * M)` fits into the
+ * accumulators.
+ *
+ * The output is scaled to unit DC gain. The optional compensation FIR filter
+ * runs at the low rate (after the decimator or before the interpolator),
+ * flattens the `sinc^N` passband droop up to `passband` of the low-rate
+ * Nyquist frequency and suppresses the band above it.
+ */
+class TCICFilter {
+   public:
+    /**
+     * @brief Constructs a TCICFilter with a signal line and filter parameters.
+     *
+     * @param signalLine Pointer to the input signal line.
+     * @param mode Direction of the rate change.
+     * @param rate Rate change factor.
+     * @param order Number of integrator and comb sections.
+     * @param differentialDelay Differential delay of the combs.
+     * @param fullScale Largest input magnitude. If not set, the largest
+     * magnitude of the signal line is used.
+     * @param compensate Flag enabling the droop compensation filter.
+     */
+    explicit TCICFilter(
+        const TSignalLine*         signalLine,
+        std::optional<CIC::Mode>   mode  = CIC::DEFAULT_MODE,
+        std::optional<std::size_t> rate  = CIC::DEFAULT_RATE,
+        std::optional<std::size_t> order = CIC::DEFAULT_ORDER,
+        std::optional<std::size_t> differentialDelay =
+            CIC::DEFAULT_DIFFERENTIAL_DELAY,
+        std::optional<double> fullScale  = std::nullopt,
+        std::optional<bool>   compensate = CIC::DEFAULT_COMPENSATE);
+
+    /**
+     * @brief Constructs a TCICFilter with filter parameters.
+     *
+     * @param params Structure containing the parameters of the filter.
+     */
+    explicit TCICFilter(TCICFilterParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TCICFilter() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TCICFilter(const TCICFilter& filter);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TCICFilter(TCICFilter&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TCICFilter& operator=(const TCICFilter& filter);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TCICFilter& operator=(TCICFilter&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the filtered signal line.
+     *
+     * @return const TSignalLine* A pointer to the filtered signal line.
+     *
+     * @throw SignalProcessingError If the filter has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the filter.
+     *
+     * @return const TCICFilterParams& A constant reference to the parameters.
+     */
+    [[nodiscard]] const TCICFilterParams& getParams() const;
+
+    /**
+     * @brief Determines if the filter has been executed.
+     *
+     * @return bool True if the filter has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Filters the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected. If
+     * the full scale is not set, the largest magnitude of the signal line is
+     * used.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, if the parameters are invalid, or if a sample exceeds the full
+     * scale.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<double> Output samples completed by the block.
+     *
+     * @throws SignalProcessingError If the parameters are invalid, if the
+     * full scale is not set, or if a sample exceeds it.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+    /**
+     * @brief Designs a linear-phase FIR filter compensating the passband droop
+     * of a CIC filter.
+     * @details The desired response is the inverse of the CIC response up to
+     * the passband edge and zero above it. The coefficients are obtained by
+     * integrating the desired response numerically and windowing the result.
+     *
+     * @param length Number of taps (odd).
+     * @param order Number of CIC sections.
+     * @param rate Rate change factor of the CIC filter.
+     * @param differentialDelay Differential delay of the combs.
+     * @param passband Passband edge as a fraction of the Nyquist frequency of
+     * the rate the compensator runs at.
+     * @param followingDecimation Decimation factor of the stages between the
+     * CIC decimator and the compensator.
+     * @return std::vector<double> The filter coefficients with unit DC gain.
+     *
+     * @throws SignalProcessingError If the length is even or the passband is
+     * not within (0, 1).
+     */
+    [[nodiscard]] static std::vector<double> designCompensator(
+        std::size_t length,
+        std::size_t order,
+        std::size_t rate,
+        std::size_t differentialDelay,
+        double      passband,
+        std::size_t followingDecimation = 1);
+
+   private:
+    /**
+     * @struct State
+     * @brief Stream state of the filter.
+     */
+    struct State {
+        std::vector<CIC::Accumulator> integrators =
+            {};  ///< Integrator accumulators.
+        std::vector<CIC::Accumulator> combDelays =
+            {};  ///< Delay lines of the combs (`M` values per comb).
+        std::size_t combPosition = 0;  ///< Current slot of the delay lines.
+        std::vector<double> compensator = {};  ///< Compensator coefficients.
+        std::vector<double> compensatorHistory =
+            {};  ///< Last samples entering the compensator.
+        std::size_t samplesCount = 0;  ///< Number of processed input samples.
+        double      fullScale    = 1.0;  ///< Largest accepted input magnitude.
+        double      inputScale   = 1.0;  ///< Quantization scale of the input.
+        double      inputLimit   = 1.0;  ///< Largest quantized input magnitude.
+        double      outputScale  = 1.0;  ///< Scale of the integer output.
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the filtered signal line.
+    TCICFilterParams     _params = {};  ///< Parameters of the filter.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the filter has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh stream state.
+     *
+     * @param fullScale Magnitude mapped to the full integer input range.
+     * @return State The initial stream state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState(double fullScale) const;
+
+    /**
+     * @brief Filters a block of samples.
+     *
+     * @param state Stream state to advance.
+     * @param samples Input samples.
+     * @return std::vector<double> Output samples.
+     *
+     * @throws SignalProcessingError If a sample exceeds the full scale.
+     */
+    [[nodiscard]] std::vector<double> process(
+        State&                  state,
+        std::span<const double> samples) const;
+
+    /**
+     * @brief Passes a block of samples through the compensator.
+     *
+     * @param state Stream state holding the compensator.
+     * @param data Samples, replaced by the filtered samples.
+     */
+    static void compensate(State& state, std::vector<double>& data);
+
+    /**
+     * @brief Passes one low-rate sample through the combs.
+     *
+     * @param state Stream state holding the combs.
+     * @param value Input of the first comb.
+     * @return CIC::Accumulator Output of the last comb.
+     */
+    [[nodiscard]] static CIC::Accumulator comb(State&           state,
+                                               CIC::Accumulator value);
+};
\ No newline at end of file
@@ -0,0 +1,294 @@
+/**
+ * @file TCepstrum.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TCepstrum class computing real and
+ * power cepstra of signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TCepstrum.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    const std::string SPECTRUM_X_LABEL = "Frequency";  ///< Spectrum x-axis.
+    const std::string SPECTRUM_Y_LABEL = "Log Magnitude";  ///< Spectrum y-axis.
+
+    /**
+     * @brief Checks whether a quefrency index is removed by the lifter.
+     *
+     * @param lifter Lifter.
+     * @param index Quefrency index within [0, M / 2].
+     * @param cutoff Cutoff quefrency index.
+     * @return bool True if the quefrency is zeroed.
+     */
+    bool isLiftered(const CEP::Lifter lifter,
+                    const std::size_t index,
+                    const std::size_t cutoff) {
+        switch (lifter) {
+            case CEP::Lifter::LowPass:
+                return index >= cutoff;
+            case CEP::Lifter::HighPass:
+                return index < cutoff;
+            default:
+                return false;
+        }
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TCepstrum::TCepstrum(const TSignalLine*               signalLine,
+                     const std::optional<std::size_t> frameLength,
+                     const std::optional<CEP::Type>   type,
+                     const std::optional<CEP::Lifter> lifter,
+                     const std::optional<double>      lifterCutoff,
+                     std::optional<std::string>       xLabel,
+                     std::optional<std::string>       yLabel,
+                     std::optional<std::string>       graphLabel)
+    : _params{.signalLine   = signalLine,
+              .frameLength  = frameLength,
+              .type         = type,
+              .lifter       = lifter,
+              .lifterCutoff = lifterCutoff,
+              .xLabel       = std::move(xLabel),
+              .yLabel       = std::move(yLabel),
+              .graphLabel   = std::move(graphLabel)} {}
+
+TCepstrum::TCepstrum(TCepstrumParams params) : _params(std::move(params)) {}
+
+TCepstrum::TCepstrum(const TCepstrum& cepstrum)
+    : _sl(cepstrum._sl ? std::make_unique<TSignalLine>(*cepstrum._sl)
+                       : nullptr),
+      _spectrum(cepstrum._spectrum
+                    ? std::make_unique<TSignalLine>(*cepstrum._spectrum)
+                    : nullptr),
+      _frames(cepstrum._frames),
+      _framesCount(cepstrum._framesCount),
+      _params(cepstrum._params),
+      _isExecuted(cepstrum._isExecuted) {}
+
+TCepstrum& TCepstrum::operator=(const TCepstrum& cepstrum) {
+    if (this == &cepstrum) {
+        return *this;
+    }
+    _sl = cepstrum._sl ? std::make_unique<TSignalLine>(*cepstrum._sl)
+                       : nullptr;
+    _spectrum = cepstrum._spectrum
+                    ? std::make_unique<TSignalLine>(*cepstrum._spectrum)
+                    : nullptr;
+    _frames      = cepstrum._frames;
+    _framesCount = cepstrum._framesCount;
+    _params      = cepstrum._params;
+    _isExecuted  = cepstrum._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TCepstrum::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cepstrum not executed");
+    }
+    return _sl.get();
+}
+
+const TSignalLine* TCepstrum::getSpectrumLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cepstrum not executed");
+    }
+    return _spectrum.get();
+}
+
+const std::vector<double>& TCepstrum::getFrames() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cepstrum not executed");
+    }
+    return _frames;
+}
+
+std::size_t TCepstrum::getFramesCount() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cepstrum not executed");
+    }
+    return _framesCount;
+}
+
+const TCepstrumParams& TCepstrum::getParams() const {
+    return _params;
+}
+
+bool TCepstrum::isExecuted() const {
+    return _isExecuted;
+}
+
+void TCepstrum::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TCepstrum object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    const auto        samplingFrequency =
+        _params.signalLine->getParams().samplingFrequency;
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Signal line should have a positive sampling frequency");
+    }
+
+    const std::size_t length = _params.frameLength.value_or(pointsCount);
+    if (length < 2 || pointsCount < length) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    const double overlap = _params.overlap.value_or(CEP::DEFAULT_OVERLAP);
+    if (overlap < 0.0 || overlap >= 1.0) {
+        throw SignalProcessingError("Overlap should be within [0, 1)");
+    }
+    const CEP::Lifter lifter = _params.lifter.value_or(CEP::DEFAULT_LIFTER);
+    const double      lifterCutoff =
+        _params.lifterCutoff.value_or(CEP::DEFAULT_LIFTER_CUTOFF);
+    if (lifter != CEP::Lifter::None && lifterCutoff < 0.0) {
+        throw SignalProcessingError("Lifter cutoff should not be negative");
+    }
+
+    const std::size_t hop = std::max<std::size_t>(
+        1, length - static_cast<std::size_t>(
+                        std::lround(overlap * static_cast<double>(length))));
+    const std::size_t framesCount = 1 + (pointsCount - length) / hop;
+    const std::size_t size        = TFFT::nextPowerOfTwo(length);
+    const std::size_t binsCount   = size / 2 + 1;
+    const auto        cutoff      = static_cast<std::size_t>(
+        std::lround(lifterCutoff * *samplingFrequency));
+    const bool isPower =
+        _params.type.value_or(CEP::DEFAULT_TYPE) == CEP::Type::Power;
+    const auto window =
+        WIN::makeWindow(_params.window.value_or(CEP::DEFAULT_WINDOW), length);
+    const TFFT fft(size);
+
+    // Liftered real cepstra (non-negative quefrencies) of every frame
+    std::vector<double> real(framesCount * binsCount);
+    const std::size_t   batchesCount =
+        (framesCount + CEP::FRAMES_PER_BATCH - 1) / CEP::FRAMES_PER_BATCH;
+    PAR::parallelFor(
+        batchesCount,
+        [&](const std::size_t batchBegin, const std::size_t batchEnd) {
+            // Scratch buffers are shared by all batches of the thread
+            std::vector<double>               frames;
+            std::vector<std::complex<double>> spectra;
+            std::vector<double>               cepstra;
+            for (std::size_t batch = batchBegin; batch < batchEnd; ++batch) {
+                const std::size_t first = batch * CEP::FRAMES_PER_BATCH;
+                const std::size_t count =
+                    std::min(CEP::FRAMES_PER_BATCH, framesCount - first);
+
+                frames.assign(count * size, 0.0);
+                for (std::size_t f = 0; f < count; ++f) {
+                    const std::size_t start = (first + f) * hop;
+                    for (std::size_t i = 0; i < length; ++i) {
+                        frames[f * size + i] = points[start + i].y * window[i];
+                    }
+                }
+                fft.forwardRealBatch(frames, count, spectra);
+
+                for (std::size_t f = 0; f < count; ++f) {
+                    std::complex<double>* spectrum =
+                        spectra.data() + f * binsCount;
+                    double peak = 0.0;
+                    for (std::size_t k = 0; k < binsCount; ++k) {
+                        peak = std::max(peak, std::abs(spectrum[k]));
+                    }
+                    const double floor =
+                        std::max(peak * CEP::MAGNITUDE_FLOOR,
+                                 std::numeric_limits<double>::min());
+                    for (std::size_t k = 0; k < binsCount; ++k) {
+                        spectrum[k] = std::log(
+                            std::max(std::abs(spectrum[k]), floor));
+                    }
+                }
+                fft.inverseRealBatch(spectra, count, cepstra);
+
+                for (std::size_t f = 0; f < count; ++f) {
+                    double* output = real.data() + (first + f) * binsCount;
+                    for (std::size_t n = 0; n < binsCount; ++n) {
+                        output[n] = isLiftered(lifter, n, cutoff)
+                                        ? 0.0
+                                        : cepstra[f * size + n];
+                    }
+                }
+            }
+        },
+        _params.threadsCount, 1);
+
+    // The power cepstrum of a real signal is 4 * c^2 of its real cepstrum
+    if (isPower) {
+        _frames.resize(real.size());
+        for (std::size_t i = 0; i < real.size(); ++i) {
+            _frames[i] = 4.0 * real[i] * real[i];
+        }
+    } else {
+        _frames = real;
+    }
+
+    std::vector<double> average(binsCount, 0.0);
+    std::vector<double> averageReal(binsCount, 0.0);
+    for (std::size_t f = 0; f < framesCount; ++f) {
+        for (std::size_t n = 0; n < binsCount; ++n) {
+            average[n] += _frames[f * binsCount + n];
+            averageReal[n] += real[f * binsCount + n];
+        }
+    }
+    for (std::size_t n = 0; n < binsCount; ++n) {
+        average[n] /= static_cast<double>(framesCount);
+        averageReal[n] /= static_cast<double>(framesCount);
+    }
+
+    // The real cepstrum is even, so the log-magnitude spectrum is the forward
+    // transform of its symmetric extension
+    std::vector<double> symmetric(size);
+    for (std::size_t n = 0; n < size; ++n) {
+        symmetric[n] = averageReal[std::min(n, size - n)];
+    }
+    std::vector<std::complex<double>> logSpectrum;
+    fft.forwardReal(symmetric, logSpectrum);
+
+    std::vector<Point> cepstrumPoints(binsCount);
+    std::vector<Point> spectrumPoints(binsCount);
+    for (std::size_t n = 0; n < binsCount; ++n) {
+        cepstrumPoints[n] =
+            Point{.x = static_cast<double>(n) / *samplingFrequency,
+                  .y = average[n]};
+        spectrumPoints[n] =
+            Point{.x = static_cast<double>(n) * *samplingFrequency /
+                       static_cast<double>(size),
+                  .y = logSpectrum[n].real()};
+    }
+
+    _sl = std::make_unique<TSignalLine>(binsCount, _params.xLabel,
+                                        _params.yLabel, _params.graphLabel);
+    _sl->setPoints(std::move(cepstrumPoints));
+    _spectrum = std::make_unique<TSignalLine>(
+        binsCount, SPECTRUM_X_LABEL, SPECTRUM_Y_LABEL, _params.graphLabel);
+    _spectrum->setPoints(std::move(spectrumPoints));
+    _framesCount = framesCount;
+
+    _isExecuted = true;
+}
\ No newline at end of file
@@ -0,0 +1,260 @@
+/**
+ * @file TCepstrum.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TCepstrum class computing real and
+ * power cepstra of signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace CEP
+ * @brief Contains default parameters used for cepstral analysis.
+ */
+namespace CEP {
+
+    /**
+     * @enum Type
+     * @brief Specifies the kind of cepstrum.
+     */
+    enum class Type : std::uint8_t {
+        Real,  ///< `IFFT(ln|X|)`.
+        Power  ///< `|IFFT(ln|X|^2)|^2`.
+    };
+
+    /**
+     * @enum Lifter
+     * @brief Specifies which quefrencies are kept.
+     */
+    enum class Lifter : std::uint8_t {
+        None,     ///< All quefrencies are kept.
+        LowPass,  ///< Quefrencies below the cutoff are kept (envelope).
+        HighPass  ///< Quefrencies from the cutoff on are kept (harmonics,
+                  ///< echoes).
+    };
+
+    static constexpr double DEFAULT_OVERLAP =
+        0.5;  ///< Default fraction of overlap between adjacent frames.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Hann;  ///< Default frame window.
+    static constexpr auto DEFAULT_TYPE =
+        Type::Real;  ///< Default kind of cepstrum.
+    static constexpr auto DEFAULT_LIFTER =
+        Lifter::None;  ///< Default lifter.
+    static constexpr double DEFAULT_LIFTER_CUTOFF =
+        0.0;  ///< Default lifter cutoff quefrency, in seconds.
+    static constexpr double MAGNITUDE_FLOOR =
+        1e-10;  ///< Smallest magnitude relative to the frame maximum, keeps
+                ///< the logarithm finite.
+    static const std::string DEFAULT_X_LABEL =
+        "Quefrency";  ///< Default label for the x-axis.
+    static const std::string DEFAULT_Y_LABEL =
+        "Cepstrum";  ///< Default label for the y-axis.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Cepstrum";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t FRAMES_PER_BATCH =
+        16;  ///< Number of frames transformed together.
+
+}  // namespace CEP
+
+/**
+ * @struct TCepstrumParams
+ * @brief Contains parameters used for cepstral analysis.
+ */
+struct TCepstrumParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to analyze.
+
+    // Calculation Parameters
+    std::optional<std::size_t> frameLength =
+        std::nullopt;  ///< Samples per frame. If not set, the whole line is a
+                       ///< single frame.
+    std::optional<double> overlap =
+        CEP::DEFAULT_OVERLAP;  ///< Fraction of overlap within [0, 1).
+    std::optional<WIN::WindowType> window =
+        CEP::DEFAULT_WINDOW;  ///< Frame window.
+    std::optional<CEP::Type> type = CEP::DEFAULT_TYPE;  ///< Kind of cepstrum.
+    std::optional<CEP::Lifter> lifter = CEP::DEFAULT_LIFTER;  ///< Lifter.
+    std::optional<double> lifterCutoff =
+        CEP::DEFAULT_LIFTER_CUTOFF;  ///< Lifter cutoff quefrency, in seconds.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        CEP::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        CEP::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        CEP::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TCepstrum
+ * @brief Class for computing the real or power cepstrum of a signal line.
+ *
+ * @details The line is cut into frames of `frameLength` samples overlapping by
+ * `overlap`; every frame is windowed, zero-padded to the next power of two
+ * `M` and transformed. The real cepstrum of a frame is the inverse transform
+ * of its log-magnitude spectrum; the power cepstrum of a real signal is
+ * `4 * c^2` of the same values. Periodic structures of the spectrum (echoes,
+ * harmonic families, sidebands) appear as peaks at their quefrency, in
+ * seconds.
+ *
+ * Liftering zeroes the quefrencies above (low-pass) or below (high-pass) the
+ * cutoff before the power cepstrum and the averaging. The forward transform of
+ * the averaged liftered real cepstrum is available as a log-magnitude
+ * spectrum: the spectral envelope for the low-pass lifter, the harmonic
+ * content with the envelope removed for the high-pass one.
+ *
+ * Frames are processed in batches of `CEP::FRAMES_PER_BATCH` on several
+ * threads. All frames share one FFT plan and every thread reuses its scratch
+ * buffers for all its batches. The cepstra of the individual frames are kept
+ * (`M / 2 + 1` quefrencies each) and their average is the output line.
+ */
+class TCepstrum {
+   public:
+    /**
+     * @brief Constructs a TCepstrum with a signal line.
+     *
+     * @param signalLine Pointer to the signal line to analyze.
+     * @param frameLength Samples per frame (the whole line if not set).
+     * @param type Kind of cepstrum.
+     * @param lifter Lifter.
+     * @param lifterCutoff Lifter cutoff quefrency, in seconds.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TCepstrum(
+        const TSignalLine*         signalLine,
+        std::optional<std::size_t> frameLength  = std::nullopt,
+        std::optional<CEP::Type>   type         = CEP::DEFAULT_TYPE,
+        std::optional<CEP::Lifter> lifter       = CEP::DEFAULT_LIFTER,
+        std::optional<double>      lifterCutoff = CEP::DEFAULT_LIFTER_CUTOFF,
+        std::optional<std::string> xLabel       = CEP::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel       = CEP::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel   = CEP::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TCepstrum with cepstrum parameters.
+     *
+     * @param params Structure containing the parameters of the cepstrum.
+     */
+    explicit TCepstrum(TCepstrumParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TCepstrum() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TCepstrum(const TCepstrum& cepstrum);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TCepstrum(TCepstrum&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TCepstrum& operator=(const TCepstrum& cepstrum);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TCepstrum& operator=(TCepstrum&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the cepstrum averaged over all frames.
+     *
+     * @return const TSignalLine* A pointer to the cepstrum signal line.
+     *
+     * @throw SignalProcessingError If the cepstrum has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the log-magnitude spectrum of the averaged liftered real
+     * cepstrum.
+     *
+     * @return const TSignalLine* A pointer to the spectrum signal line
+     * (`M / 2 + 1` points up to the Nyquist frequency).
+     *
+     * @throw SignalProcessingError If the cepstrum has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSpectrumLine() const;
+
+    /**
+     * @brief Retrieves the cepstra of the individual frames.
+     *
+     * @return const std::vector<double>& Consecutive cepstra of `M / 2 + 1`
+     * values each, in frame order.
+     *
+     * @throw SignalProcessingError If the cepstrum has not been executed.
+     */
+    [[nodiscard]] const std::vector<double>& getFrames() const;
+
+    /**
+     * @brief Retrieves the number of frames.
+     *
+     * @return std::size_t The number of frames.
+     *
+     * @throw SignalProcessingError If the cepstrum has not been executed.
+     */
+    [[nodiscard]] std::size_t getFramesCount() const;
+
+    /**
+     * @brief Retrieves the parameters of the cepstrum.
+     *
+     * @return const TCepstrumParams& A constant reference to the parameters.
+     */
+    [[nodiscard]] const TCepstrumParams& getParams() const;
+
+    /**
+     * @brief Determines if the cepstrum has been executed.
+     *
+     * @return bool True if the cepstrum has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Computes the cepstra of all frames and their average.
+     *
+     * @throws SignalProcessingError If the signal line is null, has no
+     * sampling frequency or fewer points than a frame, or if the parameters
+     * are invalid.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the averaged cepstrum.
+    std::unique_ptr<TSignalLine> _spectrum =
+        nullptr;  ///< A unique pointer to the liftered log-magnitude spectrum.
+    std::vector<double> _frames      = {};  ///< Cepstra of the frames.
+    std::size_t         _framesCount = 0;   ///< Number of frames.
+    TCepstrumParams     _params      = {};  ///< Parameters of the cepstrum.
+    bool _isExecuted = false;  ///< Flag indicating if the cepstrum has been
+                               ///< executed.
+};
\ No newline at end of file
@@ -0,0 +1,326 @@
+/**
+ * @file TChannelizer.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TChannelizer class splitting a
+ * signal line into equally spaced decimated subbands with a polyphase FFT
+ * filter bank.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TChannelizer.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TFilterDesign.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TChannelizer::TChannelizer(const TSignalLine*                   signalLine,
+                           const std::optional<std::size_t>     channelsCount,
+                           const std::optional<bool>            oversampled,
+                           const std::optional<std::size_t>     tapsPerChannel,
+                           const std::optional<WIN::WindowType> window,
+                           const std::optional<std::size_t>     threadsCount)
+    : _params{.signalLine     = signalLine,
+              .channelsCount  = channelsCount,
+              .tapsPerChannel = tapsPerChannel,
+              .oversampled    = oversampled,
+              .window         = window,
+              .threadsCount   = threadsCount} {}
+
+TChannelizer::TChannelizer(TChannelizerParams params)
+    : _params(std::move(params)) {}
+
+const TSignalLine* TChannelizer::getInPhaseLine(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Channelizer not executed");
+    }
+    if (channel >= _inPhaseLines.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return &_inPhaseLines[channel];
+}
+
+const TSignalLine* TChannelizer::getQuadratureLine(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Channelizer not executed");
+    }
+    if (channel >= _quadratureLines.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return &_quadratureLines[channel];
+}
+
+double TChannelizer::getCenterFrequency(const std::size_t channel,
+                                        const double samplingFrequency) const {
+    const std::size_t channelsCount =
+        _params.channelsCount.value_or(CHAN::DEFAULT_CHANNELS_COUNT);
+    const double index = channel <= channelsCount / 2
+                             ? static_cast<double>(channel)
+                             : static_cast<double>(channel) -
+                                   static_cast<double>(channelsCount);
+    return index * samplingFrequency / static_cast<double>(channelsCount);
+}
+
+std::size_t TChannelizer::getDecimation() const {
+    const std::size_t channelsCount =
+        _params.channelsCount.value_or(CHAN::DEFAULT_CHANNELS_COUNT);
+    return _params.oversampled.value_or(CHAN::DEFAULT_OVERSAMPLED)
+               ? std::max<std::size_t>(1, channelsCount / 2)
+               : channelsCount;
+}
+
+const TChannelizerParams& TChannelizer::getParams() const {
+    return _params;
+}
+
+bool TChannelizer::isExecuted() const {
+    return _isExecuted;
+}
+
+void TChannelizer::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TChannelizer object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    prepare();
+
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    const std::size_t channelsCount =
+        _params.channelsCount.value_or(CHAN::DEFAULT_CHANNELS_COUNT);
+    const std::size_t historyLength = _branches.size() - 1;
+    const std::size_t decimation    = getDecimation();
+    const std::size_t framesCount =
+        (pointsCount + decimation - 1) / decimation;
+
+    // The samples before the start of the line are treated as zeros
+    std::vector<double> samples(historyLength + pointsCount, 0.0);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        samples[historyLength + i] = points[i].y;
+    }
+    std::vector<std::complex<double>> frames;
+    analyze(samples, historyLength, 0, framesCount, frames);
+
+    // Deinterleaving the frames into per-channel lines
+    std::vector<std::vector<Point>> inPhasePoints(channelsCount);
+    std::vector<std::vector<Point>> quadraturePoints(channelsCount);
+    PAR::parallelFor(
+        channelsCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t k = begin; k < end; ++k) {
+                inPhasePoints[k].resize(framesCount);
+                quadraturePoints[k].resize(framesCount);
+                for (std::size_t m = 0; m < framesCount; ++m) {
+                    const double                x = points[m * decimation].x;
+                    const std::complex<double>& value =
+                        frames[m * channelsCount + k];
+                    inPhasePoints[k][m]    = Point{.x = x, .y = value.real()};
+                    quadraturePoints[k][m] = Point{.x = x, .y = value.imag()};
+                }
+            }
+        },
+        _params.threadsCount);
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    if (slParams.samplingFrequency) {
+        slParams.samplingFrequency =
+            *slParams.samplingFrequency / static_cast<double>(decimation);
+    }
+    slParams.xLabel      = _params.xLabel;
+    slParams.pointsCount = framesCount;
+
+    _inPhaseLines.clear();
+    _quadratureLines.clear();
+    _inPhaseLines.reserve(channelsCount);
+    _quadratureLines.reserve(channelsCount);
+    const std::string graphLabel =
+        _params.graphLabel.value_or(CHAN::DEFAULT_GRAPH_LABEL);
+    for (std::size_t k = 0; k < channelsCount; ++k) {
+        slParams.graphLabel = graphLabel + " " + std::to_string(k);
+        slParams.yLabel     = CHAN::DEFAULT_IN_PHASE_Y_LABEL;
+        _inPhaseLines.emplace_back(slParams,
+                                   SL::Preference::PreferPointsCount);
+        _inPhaseLines.back().setPoints(std::move(inPhasePoints[k]));
+
+        slParams.yLabel = CHAN::DEFAULT_QUADRATURE_Y_LABEL;
+        _quadratureLines.emplace_back(slParams,
+                                      SL::Preference::PreferPointsCount);
+        _quadratureLines.back().setPoints(std::move(quadraturePoints[k]));
+    }
+
+    _isExecuted = true;
+}
+
+std::vector<std::complex<double>> TChannelizer::processBlock(
+    const std::span<const double> samples) {
+    prepare();
+
+    const std::size_t historyLength = _history.size();
+    const std::size_t decimation    = getDecimation();
+
+    std::vector<double> buffer(historyLength + samples.size());
+    std::copy(_history.begin(), _history.end(), buffer.begin());
+    std::copy(samples.begin(), samples.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    // Frames are taken at the stream samples whose index is a multiple of the
+    // decimation factor.
+    const std::size_t firstOffset =
+        (decimation - _streamSamplesCount % decimation) % decimation;
+    const std::size_t framesCount =
+        samples.size() > firstOffset
+            ? (samples.size() - firstOffset + decimation - 1) / decimation
+            : 0;
+
+    std::vector<std::complex<double>> frames;
+    analyze(buffer, historyLength + firstOffset, _streamFramesCount,
+            framesCount, frames);
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), _history.begin());
+    _streamSamplesCount += samples.size();
+    _streamFramesCount += framesCount;
+    return frames;
+}
+
+void TChannelizer::reset() {
+    std::fill(_history.begin(), _history.end(), 0.0);
+    _streamSamplesCount = 0;
+    _streamFramesCount  = 0;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TChannelizer::prepare() {
+    if (!_branches.empty()) {
+        return;
+    }
+
+    const std::size_t channelsCount =
+        _params.channelsCount.value_or(CHAN::DEFAULT_CHANNELS_COUNT);
+    const std::size_t tapsPerChannel =
+        _params.tapsPerChannel.value_or(CHAN::DEFAULT_TAPS_PER_CHANNEL);
+    if (channelsCount < 2 || !TFFT::isPowerOfTwo(channelsCount)) {
+        throw SignalProcessingError(
+            "Channels count should be a power of two not less than two");
+    }
+    if (tapsPerChannel == 0) {
+        throw SignalProcessingError(
+            "Taps per channel count should be positive");
+    }
+
+    // Windowed-sinc prototype with the cutoff at half the channel spacing,
+    // shared by all channelizers of the same configuration
+    const std::size_t       length = channelsCount * tapsPerChannel;
+    const TWindowedSincSpec spec   = {
+        .tapsCount = length,
+        .cutoff    = 0.5 / static_cast<double>(channelsCount),
+        .window    = _params.window.value_or(CHAN::DEFAULT_WINDOW)};
+    const auto prototype = FDES::getDesign(spec);
+
+    _branches.resize(length);
+    for (std::size_t r = 0; r < channelsCount; ++r) {
+        for (std::size_t p = 0; p < tapsPerChannel; ++p) {
+            _branches[r * tapsPerChannel + p] =
+                (*prototype)[r + p * channelsCount];
+        }
+    }
+    _history.assign(length - 1, 0.0);
+}
+
+void TChannelizer::analyze(const std::vector<double>&         samples,
+                           const std::size_t                  firstPosition,
+                           const std::size_t                  firstFrame,
+                           const std::size_t                  framesCount,
+                           std::vector<std::complex<double>>& output) const {
+    const std::size_t channelsCount =
+        _params.channelsCount.value_or(CHAN::DEFAULT_CHANNELS_COUNT);
+    const std::size_t tapsPerChannel =
+        _params.tapsPerChannel.value_or(CHAN::DEFAULT_TAPS_PER_CHANNEL);
+    const std::size_t spectrumSize   = channelsCount / 2 + 1;
+    const std::size_t decimation     = getDecimation();
+    const bool        halfDecimation = decimation != channelsCount;
+    const TFFT        fft(channelsCount);
+
+    output.resize(framesCount * channelsCount);
+    PAR::parallelFor(
+        framesCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            std::vector<double>               branchOutputs;
+            std::vector<std::complex<double>> spectra;
+            for (std::size_t batchBegin = begin; batchBegin < end;
+                 batchBegin += CHAN::FRAMES_PER_BATCH) {
+                const std::size_t batchCount =
+                    std::min(CHAN::FRAMES_PER_BATCH, end - batchBegin);
+
+                // u[r] = sum(h[r + p*K] * x[n - r - p*K]) for every branch
+                branchOutputs.assign(batchCount * channelsCount, 0.0);
+                for (std::size_t f = 0; f < batchCount; ++f) {
+                    const double* current =
+                        samples.data() + firstPosition +
+                        (batchBegin + f) * decimation;
+                    double* outputs = branchOutputs.data() + f * channelsCount;
+                    for (std::size_t r = 0; r < channelsCount; ++r) {
+                        const double* branch =
+                            _branches.data() + r * tapsPerChannel;
+                        const double* sample = current - r;
+                        double        sum    = 0.0;
+                        for (std::size_t p = 0; p < tapsPerChannel; ++p) {
+                            sum += branch[p] *
+                                   *(sample - static_cast<std::ptrdiff_t>(
+                                                  p * channelsCount));
+                        }
+                        outputs[r] = sum;
+                    }
+                }
+                fft.forwardRealBatch(branchOutputs, batchCount, spectra);
+
+                // y_k = sum(u[r] * exp(2*pi*i*k*r/K)) = conj(U[k]) for real u,
+                // and conj(U[k]) = U[K - k] for the upper channels. With the
+                // decimation by K/2 the frames alternate the phase of the odd
+                // channels by pi.
+                for (std::size_t f = 0; f < batchCount; ++f) {
+                    const std::size_t frame = batchBegin + f;
+                    const auto* spectrum = spectra.data() + f * spectrumSize;
+                    auto* values = output.data() + frame * channelsCount;
+                    const bool alternate =
+                        halfDecimation && (firstFrame + frame) % 2 == 1;
+                    for (std::size_t k = 0; k < channelsCount; ++k) {
+                        std::complex<double> value =
+                            k < spectrumSize
+                                ? std::conj(spectrum[k])
+                                : spectrum[channelsCount - k];
+                        if (alternate && k % 2 == 1) {
+                            value = -value;
+                        }
+                        values[k] = value;
+                    }
+                }
+            }
+        },
+        _params.threadsCount, CHAN::FRAMES_PER_BATCH);
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+/**
+ * @file TChannelizer.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TChannelizer class splitting a signal
+ * line into equally spaced decimated subbands with a polyphase FFT filter
+ * bank.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace CHAN
+ * @brief Contains default parameters used by the polyphase channelizer.
+ */
+namespace CHAN {
+
+    static constexpr std::size_t DEFAULT_CHANNELS_COUNT =
+        16;  ///< Default number of channels (must be a power of two).
+    static constexpr std::size_t DEFAULT_TAPS_PER_CHANNEL =
+        8;  ///< Default number of prototype filter taps per polyphase branch.
+    static constexpr bool DEFAULT_OVERSAMPLED =
+        false;  ///< Default flag selecting the 2x oversampled bank (decimation
+                ///< by half the channels count) instead of the critically
+                ///< sampled one.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Blackman;  ///< Default window of the prototype
+                                    ///< low-pass filter.
+    static const std::string DEFAULT_IN_PHASE_Y_LABEL =
+        "In-Phase";  ///< Default label for the y-axis of in-phase lines.
+    static const std::string DEFAULT_QUADRATURE_Y_LABEL =
+        "Quadrature";  ///< Default label for the y-axis of quadrature lines.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Channelizer";  ///< Default graph label (the channel index is
+                        ///< appended).
+
+    // Kernel parameters
+    static constexpr std::size_t FRAMES_PER_BATCH =
+        32;  ///< Number of output frames whose FFTs are computed in one batch.
+
+}  // namespace CHAN
+
+/**
+ * @struct TChannelizerParams
+ * @brief Contains parameters used by the polyphase channelizer.
+ */
+struct TChannelizerParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the wideband signal line (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<std::size_t> channelsCount =
+        CHAN::DEFAULT_CHANNELS_COUNT;  ///< Number of channels (a power of two).
+    std::optional<std::size_t> tapsPerChannel =
+        CHAN::DEFAULT_TAPS_PER_CHANNEL;  ///< Number of prototype filter taps
+                                         ///< per polyphase branch.
+    std::optional<bool> oversampled =
+        CHAN::DEFAULT_OVERSAMPLED;  ///< Flag selecting the 2x oversampled
+                                    ///< bank.
+    std::optional<WIN::WindowType> window =
+        CHAN::DEFAULT_WINDOW;  ///< Window of the prototype low-pass filter.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads (hardware concurrency if not set).
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> graphLabel =
+        CHAN::DEFAULT_GRAPH_LABEL;  ///< Label for the graphs.
+};
+
+/**
+ * @class TChannelizer
+ * @brief Class for splitting a signal line into equally spaced subbands.
+ *
+ * @details Channel `k` of a `K`-channel bank is centered at `k * fs / K`
+ * (channels above `K / 2` represent negative frequencies) and has the
+ * bandwidth `fs / K`. Its output is the complex baseband signal
+ *
+ * `y_k[m] = sum(h[l] * x[n - l] * exp(-2*pi*i*k*(n - l) / K)), n = m * D`,
+ *
+ * where `h` is a windowed-sinc prototype low-pass filter of
+ * `K * tapsPerChannel` taps with unit DC gain and `D` is the decimation
+ * factor (`K`, or `K / 2` for the oversampled bank). All channels are produced
+ * at once by the polyphase decomposition of `h` followed by one real FFT of
+ * size `K` per output frame, so the cost per input sample is about
+ * `tapsPerChannel + log2(K)` instead of `K * K * tapsPerChannel` for separate
+ * filters. Since the input is real, channels `k` and `K - k` are complex
+ * conjugates. The filter is causal, so the outputs are delayed by
+ * `(K * tapsPerChannel - 1) / 2` input samples.
+ *
+ * `execute()` splits the output frames across threads and batches their FFTs.
+ * `processBlock()` processes a stream block by block and yields exactly the
+ * same frames as `execute()` for the concatenated blocks.
+ */
+class TChannelizer {
+   public:
+    /**
+     * @brief Constructs a TChannelizer with a signal line and bank parameters.
+     *
+     * @param signalLine Pointer to the wideband signal line.
+     * @param channelsCount Number of channels (a power of two).
+     * @param oversampled Flag selecting the 2x oversampled bank.
+     * @param tapsPerChannel Number of prototype filter taps per branch.
+     * @param window Window of the prototype low-pass filter.
+     * @param threadsCount Number of threads (hardware concurrency if not set).
+     */
+    explicit TChannelizer(
+        const TSignalLine*         signalLine,
+        std::optional<std::size_t> channelsCount = CHAN::DEFAULT_CHANNELS_COUNT,
+        std::optional<bool>        oversampled   = CHAN::DEFAULT_OVERSAMPLED,
+        std::optional<std::size_t> tapsPerChannel =
+            CHAN::DEFAULT_TAPS_PER_CHANNEL,
+        std::optional<WIN::WindowType> window       = CHAN::DEFAULT_WINDOW,
+        std::optional<std::size_t>     threadsCount = std::nullopt);
+
+    /**
+     * @brief Constructs a TChannelizer with channelizer parameters.
+     *
+     * @param params Structure containing the parameters of the channelizer.
+     */
+    explicit TChannelizer(TChannelizerParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TChannelizer() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TChannelizer(const TChannelizer&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TChannelizer(TChannelizer&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TChannelizer& operator=(const TChannelizer&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TChannelizer& operator=(TChannelizer&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the in-phase (real) part of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const TSignalLine* A pointer to the in-phase signal line.
+     *
+     * @throw SignalProcessingError If the channelizer has not been executed or
+     * if the index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getInPhaseLine(std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the quadrature (imaginary) part of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const TSignalLine* A pointer to the quadrature signal line.
+     *
+     * @throw SignalProcessingError If the channelizer has not been executed or
+     * if the index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getQuadratureLine(
+        std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the center frequency of a channel.
+     *
+     * @param channel Index of the channel.
+     * @param samplingFrequency Sampling frequency of the input, in Hertz.
+     * @return double The center frequency, in Hertz (negative for the channels
+     * above `K / 2`).
+     */
+    [[nodiscard]] double getCenterFrequency(std::size_t channel,
+                                            double samplingFrequency) const;
+
+    /**
+     * @brief Retrieves the decimation factor of the bank.
+     *
+     * @return std::size_t The number of input samples per output frame.
+     */
+    [[nodiscard]] std::size_t getDecimation() const;
+
+    /**
+     * @brief Retrieves the parameters of the channelizer.
+     *
+     * @return const TChannelizerParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TChannelizerParams& getParams() const;
+
+    /**
+     * @brief Determines if the channelizer has been executed.
+     *
+     * @return bool True if the channelizer has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Splits the whole signal line into channels.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, or if the bank parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     * @details The filter history is kept between calls, so a stream can be
+     * split into blocks of any size.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<std::complex<double>> Output frames completed by the
+     * block, `K` channel values per frame.
+     *
+     * @throws SignalProcessingError If the bank parameters are invalid.
+     */
+    [[nodiscard]] std::vector<std::complex<double>> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    std::vector<TSignalLine> _inPhaseLines =
+        {};  ///< In-phase signal lines of the channels.
+    std::vector<TSignalLine> _quadratureLines =
+        {};  ///< Quadrature signal lines of the channels.
+    TChannelizerParams _params = {};  ///< Parameters of the channelizer.
+    std::vector<double> _branches =
+        {};  ///< Polyphase branches of the prototype filter; branch r holds
+             ///< h[r], h[r + K], ... contiguously.
+    std::vector<double> _history =
+        {};  ///< Last input samples of the stream (filter length - 1).
+    std::size_t _streamSamplesCount = 0;  ///< Number of streamed samples.
+    std::size_t _streamFramesCount  = 0;  ///< Number of streamed frames.
+    bool        _isExecuted = false;  ///< Flag indicating if the channelizer
+                                      ///< has been executed.
+
+    /**
+     * @brief Validates the bank parameters and designs the polyphase branches
+     * if this has not been done yet.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    void prepare();
+
+    /**
+     * @brief Computes output frames of the bank.
+     *
+     * @param samples Input samples preceded by `filter length - 1` history
+     * samples.
+     * @param firstPosition Position in `samples` of the input sample of the
+     * first frame.
+     * @param firstFrame Stream index of the first frame.
+     * @param framesCount Number of frames to compute.
+     * @param output Receives `framesCount * K` channel values.
+     */
+    void analyze(const std::vector<double>&         samples,
+                 std::size_t                        firstPosition,
+                 std::size_t                        firstFrame,
+                 std::size_t                        framesCount,
+                 std::vector<std::complex<double>>& output) const;
+};
\ No newline at end of file
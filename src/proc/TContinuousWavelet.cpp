@@ -0,0 +1,170 @@
+/**
+ * @file TContinuousWavelet.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TContinuousWavelet class computing
+ * Morlet scalograms of signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TContinuousWavelet.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TContinuousWavelet::TContinuousWavelet(
+    const TSignalLine*               signalLine,
+    const std::optional<double>      minFrequency,
+    const std::optional<double>      maxFrequency,
+    const std::optional<std::size_t> scalesCount,
+    const std::optional<double>      omega0)
+    : _params{.signalLine   = signalLine,
+              .minFrequency = minFrequency,
+              .maxFrequency = maxFrequency,
+              .scalesCount  = scalesCount,
+              .omega0       = omega0} {}
+
+TContinuousWavelet::TContinuousWavelet(TContinuousWaveletParams params)
+    : _params(std::move(params)) {}
+
+double TContinuousWavelet::getValue(const std::size_t scale,
+                                    const std::size_t sample) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Continuous wavelet not executed");
+    }
+    const std::size_t samplesCount = _scalogram.times.size();
+    if (scale >= _scalogram.frequencies.size() || sample >= samplesCount) {
+        throw SignalProcessingError("Scale or sample index is out of range");
+    }
+    return _scalogram.magnitudes[scale * samplesCount + sample];
+}
+
+const TScalogram& TContinuousWavelet::getScalogram() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Continuous wavelet not executed");
+    }
+    return _scalogram;
+}
+
+const TContinuousWaveletParams& TContinuousWavelet::getParams() const {
+    return _params;
+}
+
+bool TContinuousWavelet::isExecuted() const {
+    return _isExecuted;
+}
+
+void TContinuousWavelet::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TContinuousWavelet object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount < 2) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    const auto samplingFrequency =
+        _params.signalLine->getParams().samplingFrequency;
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Signal line should have a positive sampling frequency");
+    }
+    if (!_params.minFrequency || !_params.maxFrequency ||
+        *_params.minFrequency <= 0.0 ||
+        *_params.minFrequency > *_params.maxFrequency ||
+        *_params.maxFrequency > *samplingFrequency / 2.0) {
+        throw SignalProcessingError(
+            "Frequency range should be within (0, samplingFrequency / 2]");
+    }
+    const std::size_t scalesCount =
+        _params.scalesCount.value_or(CWT::DEFAULT_SCALES_COUNT);
+    if (scalesCount == 0) {
+        throw SignalProcessingError("Number of scales should be positive");
+    }
+    const double omega0 = _params.omega0.value_or(CWT::DEFAULT_OMEGA0);
+    if (omega0 <= 0.0) {
+        throw SignalProcessingError("Omega0 should be positive");
+    }
+
+    const double        minFrequency = *_params.minFrequency;
+    const double        maxFrequency = *_params.maxFrequency;
+    std::vector<double> frequencies(scalesCount, minFrequency);
+    for (std::size_t s = 1; s < scalesCount; ++s) {
+        frequencies[s] =
+            minFrequency *
+            std::pow(maxFrequency / minFrequency,
+                     static_cast<double>(s) /
+                         static_cast<double>(scalesCount - 1));
+    }
+
+    // Zero padding keeps the largest wavelet from wrapping around
+    const double largestScale = omega0 / (TWO_PI * minFrequency);
+    const auto   padding      = std::min(
+        pointsCount,
+        static_cast<std::size_t>(std::ceil(CWT::SUPPORT_SIGMAS * largestScale *
+                                           *samplingFrequency)));
+    const std::size_t size      = TFFT::nextPowerOfTwo(pointsCount + padding);
+    const std::size_t binsCount = size / 2 + 1;
+    const TFFT        fft(size);
+
+    std::vector<double> input(size, 0.0);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        input[i] = points[i].y;
+    }
+    std::vector<std::complex<double>> spectrum;
+    fft.forwardReal(input, spectrum);
+
+    const double binFrequency =
+        TWO_PI * *samplingFrequency / static_cast<double>(size);
+    std::vector<double> magnitudes(scalesCount * pointsCount);
+    PAR::parallelFor(
+        scalesCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            std::vector<std::complex<double>> buffer(size);
+            for (std::size_t s = begin; s < end; ++s) {
+                const double scale = omega0 / (TWO_PI * frequencies[s]);
+                // Analytic wavelet: the negative frequencies stay zero
+                std::fill(buffer.begin(), buffer.end(),
+                          std::complex<double>(0.0, 0.0));
+                for (std::size_t k = 1; k < binsCount; ++k) {
+                    const double offset =
+                        scale * binFrequency * static_cast<double>(k) - omega0;
+                    buffer[k] =
+                        spectrum[k] * (2.0 * std::exp(-0.5 * offset * offset));
+                }
+                fft.inverse(buffer);
+
+                double* row = magnitudes.data() + s * pointsCount;
+                for (std::size_t i = 0; i < pointsCount; ++i) {
+                    row[i] = std::abs(buffer[i]);
+                }
+            }
+        },
+        _params.threadsCount, 1);
+
+    std::vector<double> times(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        times[i] = points[i].x;
+    }
+    _scalogram = TScalogram{.frequencies = std::move(frequencies),
+                            .times       = std::move(times),
+                            .magnitudes  = std::move(magnitudes)};
+
+    _isExecuted = true;
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+/**
+ * @file TContinuousWavelet.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TContinuousWavelet class computing
+ * Morlet scalograms of signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * @namespace CWT
+ * @brief Contains default parameters used for continuous wavelet analysis.
+ */
+namespace CWT {
+
+    static constexpr std::size_t DEFAULT_SCALES_COUNT =
+        64;  ///< Default number of scales.
+    static constexpr double DEFAULT_OMEGA0 =
+        6.0;  ///< Default center angular frequency of the Morlet wavelet
+              ///< (number of oscillations under the envelope).
+    static constexpr double SUPPORT_SIGMAS =
+        4.0;  ///< Half width of the wavelet, in envelope deviations, used to
+              ///< size the zero padding.
+
+}  // namespace CWT
+
+/**
+ * @struct TScalogram
+ * @brief Contains a scalogram: wavelet magnitudes over scales and time.
+ */
+struct TScalogram {
+    std::vector<double> frequencies =
+        {};  ///< Center frequency of every scale (row), ascending.
+    std::vector<double> times = {};  ///< X coordinate of every sample (column).
+    std::vector<double> magnitudes =
+        {};  ///< Magnitudes in row-major order (scales x samples).
+};
+
+/**
+ * @struct TContinuousWaveletParams
+ * @brief Contains parameters used for continuous wavelet analysis.
+ */
+struct TContinuousWaveletParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to analyze.
+    std::optional<double> minFrequency =
+        std::nullopt;  ///< Center frequency of the largest scale, in Hertz
+                       ///< (required).
+    std::optional<double> maxFrequency =
+        std::nullopt;  ///< Center frequency of the smallest scale, in Hertz
+                       ///< (required, up to the Nyquist frequency).
+
+    // Calculation Parameters
+    std::optional<std::size_t> scalesCount =
+        CWT::DEFAULT_SCALES_COUNT;  ///< Number of logarithmically spaced
+                                    ///< scales.
+    std::optional<double> omega0 =
+        CWT::DEFAULT_OMEGA0;  ///< Center angular frequency of the Morlet
+                              ///< wavelet.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+};
+
+/**
+ * @class TContinuousWavelet
+ * @brief Class for computing the Morlet scalogram of a signal line.
+ *
+ * @details The scales are spaced logarithmically between the center
+ * frequencies `minFrequency` and `maxFrequency`; the scale of the center
+ * frequency `f` is `s = omega0 / (2 * pi * f)`. The transform is a
+ * convolution with the analytic Morlet wavelet computed in the frequency
+ * domain: the line is zero-padded by `CWT::SUPPORT_SIGMAS` envelope deviations
+ * of the largest scale (at most its own length), transformed once, and every
+ * scale multiplies the spectrum by `2 * exp(-(s * w - omega0)^2 / 2)` over the
+ * positive frequencies and transforms it back. This normalization gives a
+ * sinusoid of unit amplitude at a center frequency a magnitude of one.
+ *
+ * The scales are independent and are computed on several threads, sharing
+ * one FFT plan and the input spectrum. Near the ends of the line the
+ * magnitudes are reduced by the zero padding (cone of influence).
+ */
+class TContinuousWavelet {
+   public:
+    /**
+     * @brief Constructs a TContinuousWavelet with a signal line and a
+     * frequency range.
+     *
+     * @param signalLine Pointer to the signal line to analyze.
+     * @param minFrequency Center frequency of the largest scale.
+     * @param maxFrequency Center frequency of the smallest scale.
+     * @param scalesCount Number of scales.
+     * @param omega0 Center angular frequency of the Morlet wavelet.
+     */
+    TContinuousWavelet(
+        const TSignalLine*         signalLine,
+        std::optional<double>      minFrequency,
+        std::optional<double>      maxFrequency,
+        std::optional<std::size_t> scalesCount = CWT::DEFAULT_SCALES_COUNT,
+        std::optional<double>      omega0      = CWT::DEFAULT_OMEGA0);
+
+    /**
+     * @brief Constructs a TContinuousWavelet with transform parameters.
+     *
+     * @param params Structure containing the parameters of the transform.
+     */
+    explicit TContinuousWavelet(TContinuousWaveletParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TContinuousWavelet() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TContinuousWavelet(const TContinuousWavelet&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TContinuousWavelet(TContinuousWavelet&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TContinuousWavelet& operator=(const TContinuousWavelet&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TContinuousWavelet& operator=(TContinuousWavelet&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the wavelet magnitude at a scale and a sample.
+     *
+     * @param scale Index of the scale (row).
+     * @param sample Index of the sample (column).
+     * @return double The magnitude.
+     *
+     * @throw SignalProcessingError If the transform has not been executed or
+     * if an index is out of bounds.
+     */
+    [[nodiscard]] double getValue(std::size_t scale, std::size_t sample) const;
+
+    /**
+     * @brief Retrieves the whole scalogram.
+     *
+     * @return const TScalogram& A constant reference to the scalogram.
+     *
+     * @throw SignalProcessingError If the transform has not been executed.
+     */
+    [[nodiscard]] const TScalogram& getScalogram() const;
+
+    /**
+     * @brief Retrieves the parameters of the transform.
+     *
+     * @return const TContinuousWaveletParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TContinuousWaveletParams& getParams() const;
+
+    /**
+     * @brief Determines if the transform has been executed.
+     *
+     * @return bool True if the transform has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Computes the scalogram.
+     *
+     * @throws SignalProcessingError If the signal line is null, has fewer than
+     * two points or no sampling frequency, or if the frequency range, the
+     * number of scales or `omega0` is invalid.
+     */
+    void execute();
+
+   private:
+    TScalogram               _scalogram = {};  ///< Computed scalogram.
+    TContinuousWaveletParams _params = {};  ///< Parameters of the transform.
+    bool _isExecuted = false;  ///< Flag indicating if the transform has been
+                               ///< executed.
+};
\ No newline at end of file
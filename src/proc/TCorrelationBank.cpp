@@ -0,0 +1,171 @@
+/**
+ * @file TCorrelationBank.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TCorrelationBank class correlating
+ * one signal line against a set of reference signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TCorrelationBank.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TCorrelationBank::TCorrelationBank(
+    const TSignalLine*               signalLine,
+    std::vector<const TSignalLine*>  referenceLines,
+    const std::optional<bool>        performNormalization,
+    const std::optional<bool>        rankByAbsoluteValue,
+    const std::optional<double>      inaccuracy,
+    const std::optional<std::size_t> threadsCount)
+    : _params{.signalLine           = signalLine,
+              .referenceLines       = std::move(referenceLines),
+              .performNormalization = performNormalization,
+              .rankByAbsoluteValue  = rankByAbsoluteValue,
+              .inaccuracy           = inaccuracy,
+              .threadsCount         = threadsCount} {}
+
+TCorrelationBank::TCorrelationBank(TCorrelationBankParams params)
+    : _params(std::move(params)) {}
+
+const std::vector<TCorrelationBankResult>& TCorrelationBank::getResults()
+    const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Correlation bank not executed");
+    }
+    return _results;
+}
+
+const std::vector<double>& TCorrelationBank::getCorrelationValues() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Correlation bank not executed");
+    }
+    return _correlationValues;
+}
+
+const TCorrelationBankParams& TCorrelationBank::getParams() const {
+    return _params;
+}
+
+bool TCorrelationBank::isExecuted() const {
+    return _isExecuted;
+}
+
+void TCorrelationBank::execute() {
+    // We're ensuring that the signal lines are not null here because the
+    // signal lines may be set after the TCorrelationBank object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    if (!_params.signalLine->getParams().duration) {
+        throw SignalProcessingError(
+            "Signal line does not have duration information");
+    }
+    for (const auto* referenceLine : _params.referenceLines) {
+        if (referenceLine == nullptr) {
+            throw SignalProcessingError("Invalid signal line (nullptr)");
+        }
+        if (!referenceLine->getParams().duration) {
+            throw SignalProcessingError(
+                "Signal line does not have duration information");
+        }
+        if (!_params.signalLine->equals(referenceLine, _params.inaccuracy)) {
+            throw SignalProcessingError("Signal lines aren't equal");
+        }
+    }
+
+    // Fold the trapezoidal integration weights into the signal once, so every
+    // reference only needs a plain dot product. The references share the grid
+    // of the signal, so their energies use the same weights.
+    const std::vector<double> weights =
+        _params.signalLine->getTrapezoidalWeights();
+    const auto&         points      = _params.signalLine->getPoints();
+    const std::size_t   pointsCount = points.size();
+    std::vector<double> weightedSignal(pointsCount);
+    double              signalEnergy = 0.0;
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        weightedSignal[i] = weights[i] * points[i].y;
+        signalEnergy += weightedSignal[i] * points[i].y;
+    }
+
+    const std::size_t   referencesCount = _params.referenceLines.size();
+    std::vector<double> products(referencesCount, 0.0);
+    std::vector<double> energies(referencesCount, 0.0);
+
+    PAR::parallelFor(
+        referencesCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t tile = 0; tile < pointsCount;
+                 tile += CBANK::SAMPLES_PER_TILE) {
+                const std::size_t tileEnd =
+                    std::min(pointsCount, tile + CBANK::SAMPLES_PER_TILE);
+                for (std::size_t r = begin; r < end; ++r) {
+                    const auto& reference =
+                        _params.referenceLines[r]->getPoints();
+                    double product = 0.0;
+                    double energy  = 0.0;
+                    for (std::size_t i = tile; i < tileEnd; ++i) {
+                        const double value = reference[i].y;
+                        product += weightedSignal[i] * value;
+                        energy += weights[i] * value * value;
+                    }
+                    products[r] += product;
+                    energies[r] += energy;
+                }
+            }
+        },
+        _params.threadsCount);
+
+    // Same definition as TCorrelator: the integral of the product divided by
+    // the signal duration, optionally divided by both RMS values.
+    const double signalDuration =
+        _params.signalLine->getParams().duration.value();
+    const bool performNormalization = _params.performNormalization.value_or(
+        CBANK::DEFAULT_PERFORM_NORMALIZATION);
+    _correlationValues.assign(referencesCount, 0.0);
+    for (std::size_t r = 0; r < referencesCount; ++r) {
+        const double rawCorrelation = products[r] / signalDuration;
+        if (performNormalization) {
+            const double referenceDuration =
+                _params.referenceLines[r]->getParams().duration.value();
+            const double signalRMS    = sqrt(signalEnergy / signalDuration);
+            const double referenceRMS = sqrt(energies[r] / referenceDuration);
+            _correlationValues[r] = rawCorrelation / (signalRMS * referenceRMS);
+        } else {
+            _correlationValues[r] = rawCorrelation;
+        }
+    }
+
+    // Rank the references by descending correlation value
+    _results.resize(referencesCount);
+    for (std::size_t r = 0; r < referencesCount; ++r) {
+        _results[r] = TCorrelationBankResult{
+            .referenceIndex = r, .correlationValue = _correlationValues[r]};
+    }
+    const bool rankByAbsoluteValue = _params.rankByAbsoluteValue.value_or(
+        CBANK::DEFAULT_RANK_BY_ABSOLUTE_VALUE);
+    std::stable_sort(_results.begin(), _results.end(),
+                     [rankByAbsoluteValue](const TCorrelationBankResult& lhs,
+                                           const TCorrelationBankResult& rhs) {
+                         return rankByAbsoluteValue
+                                    ? std::abs(lhs.correlationValue) >
+                                          std::abs(rhs.correlationValue)
+                                    : lhs.correlationValue >
+                                          rhs.correlationValue;
+                     });
+
+    _isExecuted = true;
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+/**
+ * @file TCorrelationBank.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TCorrelationBank class correlating
+ * one signal line against a set of reference signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * @namespace CBANK
+ * @brief Contains default parameters used for correlating a signal line
+ * against a bank of reference signal lines.
+ */
+namespace CBANK {
+
+    static constexpr bool DEFAULT_PERFORM_NORMALIZATION =
+        true;  ///< Default flag indicating whether to normalize the correlation
+               ///< values.
+    static constexpr bool DEFAULT_RANK_BY_ABSOLUTE_VALUE =
+        false;  ///< Default flag indicating whether the results are ranked by
+                ///< the absolute correlation value.
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_TILE =
+        2048;  ///< Number of signal samples kept in cache while all references
+               ///< of a thread are accumulated.
+
+}  // namespace CBANK
+
+/**
+ * @struct TCorrelationBankResult
+ * @brief Contains the correlation value of one reference signal line.
+ */
+struct TCorrelationBankResult {
+    std::size_t referenceIndex =
+        0;  ///< Index of the reference in `TCorrelationBankParams::
+            ///< referenceLines`.
+    double correlationValue = 0.0;  ///< Correlation value with the signal.
+};
+
+/**
+ * @struct TCorrelationBankParams
+ * @brief Contains parameters used for correlating a signal line against a bank
+ * of reference signal lines.
+ */
+struct TCorrelationBankParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to correlate.
+    std::vector<const TSignalLine*>
+        referenceLines;  ///< Pointers to the reference signal lines.
+
+    // Calculation Parameters
+    std::optional<bool> performNormalization =
+        CBANK::DEFAULT_PERFORM_NORMALIZATION;  ///< Flag indicating whether to
+                                               ///< normalize the correlation
+                                               ///< values.
+    std::optional<bool> rankByAbsoluteValue =
+        CBANK::DEFAULT_RANK_BY_ABSOLUTE_VALUE;  ///< Flag indicating whether the
+                                                ///< results are ranked by the
+                                                ///< absolute value.
+    std::optional<double> inaccuracy =
+        SL::DEFAULT_INACCURACY;  ///< Allowed inaccuracy for comparing the
+                                 ///< signal lines.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads (hardware concurrency if not set).
+};
+
+/**
+ * @class TCorrelationBank
+ * @brief Class for correlating one signal line against many reference signal
+ * lines.
+ *
+ * @details Every coefficient is defined exactly as in TCorrelator, but the
+ * weighted signal and its RMS value are computed once for the whole bank. The
+ * coefficients are then evaluated as a matrix-vector product: the references
+ * are split across threads, and the signal is processed in tiles of
+ * `CBANK::SAMPLES_PER_TILE` samples that stay in cache while all references of
+ * a thread are accumulated.
+ */
+class TCorrelationBank {
+   public:
+    /**
+     * @brief Constructs a TCorrelationBank with a signal line and references.
+     *
+     * @param signalLine Pointer to the signal line to correlate.
+     * @param referenceLines Pointers to the reference signal lines.
+     * @param performNormalization Flag indicating whether to normalize the
+     * correlation values.
+     * @param rankByAbsoluteValue Flag indicating whether the results are
+     * ranked by the absolute value.
+     * @param inaccuracy Allowed inaccuracy for comparing the signal lines.
+     * @param threadsCount Number of threads (hardware concurrency if not set).
+     */
+    TCorrelationBank(
+        const TSignalLine*              signalLine,
+        std::vector<const TSignalLine*> referenceLines,
+        std::optional<bool> performNormalization =
+            CBANK::DEFAULT_PERFORM_NORMALIZATION,
+        std::optional<bool> rankByAbsoluteValue =
+            CBANK::DEFAULT_RANK_BY_ABSOLUTE_VALUE,
+        std::optional<double>      inaccuracy   = SL::DEFAULT_INACCURACY,
+        std::optional<std::size_t> threadsCount = std::nullopt);
+
+    /**
+     * @brief Constructs a TCorrelationBank with correlation parameters.
+     *
+     * @param params Structure containing the parameters for correlation.
+     */
+    explicit TCorrelationBank(TCorrelationBankParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TCorrelationBank() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TCorrelationBank(const TCorrelationBank&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TCorrelationBank(TCorrelationBank&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TCorrelationBank& operator=(const TCorrelationBank&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TCorrelationBank& operator=(TCorrelationBank&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the ranked correlation results.
+     *
+     * @return const std::vector<TCorrelationBankResult>& The results sorted by
+     * descending correlation value (or absolute value, see
+     * `TCorrelationBankParams::rankByAbsoluteValue`).
+     *
+     * @throw SignalProcessingError If the correlation has not been executed
+     * yet.
+     */
+    [[nodiscard]] const std::vector<TCorrelationBankResult>& getResults() const;
+
+    /**
+     * @brief Retrieves the correlation values in the order of the references.
+     *
+     * @return const std::vector<double>& The correlation values.
+     *
+     * @throw SignalProcessingError If the correlation has not been executed
+     * yet.
+     */
+    [[nodiscard]] const std::vector<double>& getCorrelationValues() const;
+
+    /**
+     * @brief Retrieves the parameters used for correlation.
+     *
+     * @return const TCorrelationBankParams& A constant reference to the
+     * correlation parameters.
+     */
+    [[nodiscard]] const TCorrelationBankParams& getParams() const;
+
+    /**
+     * @brief Checks whether the correlation has been executed.
+     *
+     * @return true If the correlation has been executed.
+     * @return false Otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Executes the correlation of the signal line with every reference.
+     *
+     * @throw SignalProcessingError If one of the signal lines is invalid, does
+     * not have duration information or is not equal to the signal line.
+     */
+    void execute();
+
+   private:
+    std::vector<double> _correlationValues =
+        {};  ///< Correlation values in the order of the references.
+    std::vector<TCorrelationBankResult> _results =
+        {};                               ///< Ranked correlation results.
+    TCorrelationBankParams _params = {};  ///< Parameters used for correlation.
+
+    bool _isExecuted = false;  ///< Flag indicating if the correlation has
+                               ///< been executed.
+};
\ No newline at end of file
@@ -0,0 +1,350 @@
+/**
+ * @file TCorrelationMatrix.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TCorrelationMatrix class computing
+ * the normalized correlation matrix of a set of signal lines (channels).
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TCorrelationMatrix.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    constexpr std::size_t BLOCK = CMAT::CHANNELS_PER_BLOCK;
+    constexpr std::size_t TILE  = CMAT::SAMPLES_PER_TILE;
+    constexpr std::size_t LANES = CMAT::KERNEL_LANES;
+
+    static_assert(TILE % LANES == 0,
+                  "Samples per tile should be a multiple of kernel lanes");
+
+    /**
+     * @brief Accumulates the products of two blocks of packed channels.
+     * @details Every channel pair of the block keeps `LANES` partial sums, so
+     * the innermost loop runs over independent accumulators and is vectorized
+     * without reassociating floating-point additions.
+     *
+     * @param weighted Packed tile of weighted samples, row of the first block.
+     * @param plain Packed tile of plain samples, row of the second block.
+     * @param gram Gram matrix to update (row-major).
+     * @param stride Row stride of the Gram matrix.
+     * @param row First channel of the first block.
+     * @param column First channel of the second block.
+     */
+    void accumulateBlock(const double* weighted,
+                         const double* plain,
+                         double*       gram,
+                         std::size_t   stride,
+                         std::size_t   row,
+                         std::size_t   column) {
+        alignas(64) std::array<double, BLOCK * BLOCK * LANES> acc{};
+        for (std::size_t t = 0; t < TILE; t += LANES) {
+            for (std::size_t p = 0; p < BLOCK; ++p) {
+                const double* lhs = weighted + (row + p) * TILE + t;
+                for (std::size_t q = 0; q < BLOCK; ++q) {
+                    const double* rhs = plain + (column + q) * TILE + t;
+                    double*       sum = acc.data() + (p * BLOCK + q) * LANES;
+                    for (std::size_t l = 0; l < LANES; ++l) {
+                        sum[l] += lhs[l] * rhs[l];
+                    }
+                }
+            }
+        }
+
+        for (std::size_t p = 0; p < BLOCK; ++p) {
+            for (std::size_t q = 0; q < BLOCK; ++q) {
+                double total = 0.0;
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    total += acc[(p * BLOCK + q) * LANES + l];
+                }
+                gram[(row + p) * stride + column + q] += total;
+            }
+        }
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TCorrelationMatrix::TCorrelationMatrix(
+    std::vector<const TSignalLine*>  signalLines,
+    const std::optional<std::size_t> maxLag,
+    const std::optional<double>      inaccuracy,
+    const std::optional<std::size_t> threadsCount)
+    : _params{.signalLines  = std::move(signalLines),
+              .maxLag       = maxLag,
+              .inaccuracy   = inaccuracy,
+              .threadsCount = threadsCount} {}
+
+TCorrelationMatrix::TCorrelationMatrix(TCorrelationMatrixParams params)
+    : _params(std::move(params)) {}
+
+double TCorrelationMatrix::getCorrelationValue(const std::size_t row,
+                                               const std::size_t column) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Correlation matrix not executed");
+    }
+    const std::size_t channelsCount = _params.signalLines.size();
+    if (row >= channelsCount || column >= channelsCount) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return _matrix[row * channelsCount + column];
+}
+
+double TCorrelationMatrix::getLag(const std::size_t row,
+                                  const std::size_t column) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Correlation matrix not executed");
+    }
+    const std::size_t channelsCount = _params.signalLines.size();
+    if (row >= channelsCount || column >= channelsCount) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return _lags[row * channelsCount + column];
+}
+
+const std::vector<double>& TCorrelationMatrix::getCorrelationMatrix() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Correlation matrix not executed");
+    }
+    return _matrix;
+}
+
+const TCorrelationMatrixParams& TCorrelationMatrix::getParams() const {
+    return _params;
+}
+
+bool TCorrelationMatrix::isExecuted() const {
+    return _isExecuted;
+}
+
+void TCorrelationMatrix::execute() {
+    // We're ensuring that the signal lines are valid here because they may be
+    // set after the TCorrelationMatrix object creation.
+    if (_params.signalLines.empty()) {
+        throw SignalProcessingError("No signal lines specified");
+    }
+    for (const auto* signalLine : _params.signalLines) {
+        if (signalLine == nullptr) {
+            throw SignalProcessingError("Invalid signal line (nullptr)");
+        }
+        if (!signalLine->getParams().duration) {
+            throw SignalProcessingError(
+                "Signal line does not have duration information");
+        }
+        if (!_params.signalLines.front()->equals(signalLine,
+                                                 _params.inaccuracy)) {
+            throw SignalProcessingError("Signal lines aren't equal");
+        }
+    }
+
+    const std::size_t channelsCount = _params.signalLines.size();
+    _matrix.assign(channelsCount * channelsCount, 0.0);
+    _lags.assign(channelsCount * channelsCount, 0.0);
+
+    if (_params.maxLag.value_or(CMAT::DEFAULT_MAX_LAG) > 0) {
+        computeLagged();
+    } else {
+        computeZeroLag();
+    }
+
+    _isExecuted = true;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TCorrelationMatrix::computeZeroLag() {
+    const std::size_t channelsCount = _params.signalLines.size();
+    const std::size_t paddedCount =
+        (channelsCount + BLOCK - 1) / BLOCK * BLOCK;
+    const std::size_t blocksCount = paddedCount / BLOCK;
+    const auto&       grid        = _params.signalLines.front()->getPoints();
+    const std::size_t pointsCount = grid.size();
+    const std::size_t tilesCount  = (pointsCount + TILE - 1) / TILE;
+
+    const std::vector<double> weights =
+        _params.signalLines.front()->getTrapezoidalWeights();
+
+    // Packs one tile of all channels and accumulates its products into the
+    // upper triangle of blocks of a Gram matrix
+    const auto accumulateTile = [&](const std::size_t    tile,
+                                    std::vector<double>& plain,
+                                    std::vector<double>& weighted,
+                                    std::vector<double>& localGram) {
+        const std::size_t first = tile * TILE;
+        const std::size_t count = std::min(TILE, pointsCount - first);
+        for (std::size_t c = 0; c < channelsCount; ++c) {
+            const auto& points = _params.signalLines[c]->getPoints();
+            double*     row    = plain.data() + c * TILE;
+            double*     wrow   = weighted.data() + c * TILE;
+            for (std::size_t t = 0; t < count; ++t) {
+                row[t]  = points[first + t].y;
+                wrow[t] = weights[first + t] * row[t];
+            }
+            std::fill(row + count, row + TILE, 0.0);
+            std::fill(wrow + count, wrow + TILE, 0.0);
+        }
+
+        for (std::size_t bi = 0; bi < blocksCount; ++bi) {
+            for (std::size_t bj = bi; bj < blocksCount; ++bj) {
+                accumulateBlock(weighted.data(), plain.data(), localGram.data(),
+                                paddedCount, bi * BLOCK, bj * BLOCK);
+            }
+        }
+    };
+
+    // Every chunk of tiles accumulates its own Gram matrix; the chunks do not
+    // depend on the thread count and are added up in order, so neither does
+    // the summation order
+    const std::size_t chunksCount =
+        std::min(CMAT::GRAM_CHUNKS_COUNT, tilesCount);
+    std::vector<std::vector<double>> partialGrams(chunksCount);
+    PAR::parallelFor(
+        chunksCount,
+        [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+            std::vector<double> plain(paddedCount * TILE, 0.0);
+            std::vector<double> weighted(paddedCount * TILE, 0.0);
+            for (std::size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                auto& localGram = partialGrams[chunk];
+                localGram.assign(paddedCount * paddedCount, 0.0);
+                const std::size_t first = chunk * tilesCount / chunksCount;
+                const std::size_t last =
+                    (chunk + 1) * tilesCount / chunksCount;
+                for (std::size_t tile = first; tile < last; ++tile) {
+                    accumulateTile(tile, plain, weighted, localGram);
+                }
+            }
+        },
+        _params.threadsCount);
+
+    std::vector<double> gram(paddedCount * paddedCount, 0.0);
+    for (const auto& localGram : partialGrams) {
+        for (std::size_t i = 0; i < gram.size(); ++i) {
+            gram[i] += localGram[i];
+        }
+    }
+
+    // Normalize by the channel energies (the diagonal of the Gram matrix),
+    // which is the TCorrelator definition with both RMS values.
+    for (std::size_t i = 0; i < channelsCount; ++i) {
+        for (std::size_t j = i; j < channelsCount; ++j) {
+            const double value =
+                gram[i * paddedCount + j] /
+                sqrt(gram[i * paddedCount + i] * gram[j * paddedCount + j]);
+            _matrix[i * channelsCount + j] = value;
+            _matrix[j * channelsCount + i] = value;
+        }
+    }
+}
+
+void TCorrelationMatrix::computeLagged() {
+    const std::size_t channelsCount = _params.signalLines.size();
+    const auto&       grid          = _params.signalLines.front()->getPoints();
+    const std::size_t pointsCount   = grid.size();
+    const std::size_t maxLag = _params.maxLag.value_or(CMAT::DEFAULT_MAX_LAG);
+    if (maxLag >= pointsCount) {
+        throw SignalProcessingError(
+            "Maximal lag should be less than the points count");
+    }
+    const double step = grid[1].x - grid[0].x;
+
+    // Zero padding to at least pointsCount + maxLag keeps the circular
+    // correlation free of aliasing for all lags of interest.
+    const std::size_t fftSize = TFFT::nextPowerOfTwo(pointsCount + maxLag);
+    const TFFT        fft(fftSize);
+
+    // Spectra and energies of all channels are computed once, the spectra in
+    // one batch of real transforms (only the non-negative bins are stored).
+    // The samples are scaled by the square roots of the trapezoidal weights,
+    // so the lag-0 sums and the energies are the integrals of the zero-lag
+    // matrix.
+    const std::vector<double> weights =
+        _params.signalLines.front()->getTrapezoidalWeights();
+    const std::size_t         spectrumSize = fftSize / 2 + 1;
+    std::vector<double>       samples(channelsCount * fftSize, 0.0);
+    std::vector<double>       energies(channelsCount, 0.0);
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        const auto& points = _params.signalLines[c]->getPoints();
+        double*     signal = samples.data() + c * fftSize;
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            signal[i] = sqrt(weights[i]) * points[i].y;
+            energies[c] += signal[i] * signal[i];
+        }
+    }
+    std::vector<std::complex<double>> spectra;
+    fft.forwardRealBatch(samples, channelsCount, spectra);
+
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    pairs.reserve(channelsCount * (channelsCount - 1) / 2);
+    for (std::size_t i = 0; i < channelsCount; ++i) {
+        _matrix[i * channelsCount + i] = 1.0;
+        for (std::size_t j = i + 1; j < channelsCount; ++j) {
+            pairs.emplace_back(i, j);
+        }
+    }
+
+    PAR::parallelFor(
+        pairs.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            std::vector<std::complex<double>> product(spectrumSize);
+            std::vector<double>               correlation;
+            for (std::size_t p = begin; p < end; ++p) {
+                const auto [i, j] = pairs[p];
+                const auto* lhs   = spectra.data() + i * spectrumSize;
+                const auto* rhs   = spectra.data() + j * spectrumSize;
+                for (std::size_t k = 0; k < spectrumSize; ++k) {
+                    // conj(lhs) * rhs, expanded by hand
+                    product[k] = {lhs[k].real() * rhs[k].real() +
+                                      lhs[k].imag() * rhs[k].imag(),
+                                  lhs[k].real() * rhs[k].imag() -
+                                      lhs[k].imag() * rhs[k].real()};
+                }
+                fft.inverseReal(product, correlation);
+
+                // correlation[k] holds sum(x_i[n] * x_j[n + k]) over the
+                // weighted samples; negative lags wrap around to the end of
+                // the buffer.
+                double    bestValue = correlation[0];
+                long long bestLag   = 0;
+                for (std::size_t lag = 1; lag <= maxLag; ++lag) {
+                    const double positive = correlation[lag];
+                    const double negative = correlation[fftSize - lag];
+                    if (std::abs(positive) > std::abs(bestValue)) {
+                        bestValue = positive;
+                        bestLag   = static_cast<long long>(lag);
+                    }
+                    if (std::abs(negative) > std::abs(bestValue)) {
+                        bestValue = negative;
+                        bestLag   = -static_cast<long long>(lag);
+                    }
+                }
+
+                const double value =
+                    bestValue / sqrt(energies[i] * energies[j]);
+                const double lag = static_cast<double>(bestLag) * step;
+                _matrix[i * channelsCount + j] = value;
+                _matrix[j * channelsCount + i] = value;
+                _lags[i * channelsCount + j]   = lag;
+                _lags[j * channelsCount + i]   = -lag;
+            }
+        },
+        _params.threadsCount);
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+/**
+ * @file TCorrelationMatrix.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TCorrelationMatrix class computing the
+ * normalized correlation matrix of a set of signal lines (channels).
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * @namespace CMAT
+ * @brief Contains default parameters used for computing correlation matrices.
+ */
+namespace CMAT {
+
+    static constexpr std::size_t DEFAULT_MAX_LAG =
+        0;  ///< Default maximal lag, in samples (zero-lag correlation only).
+
+    // Kernel parameters
+    static constexpr std::size_t CHANNELS_PER_BLOCK =
+        4;  ///< Number of channels in one side of a micro-kernel tile.
+    static constexpr std::size_t SAMPLES_PER_TILE =
+        256;  ///< Number of samples of all channels packed per kernel tile.
+    static constexpr std::size_t KERNEL_LANES =
+        4;  ///< Number of independent accumulators per channel pair, which
+            ///< lets the compiler vectorize the kernel over samples.
+    static constexpr std::size_t GRAM_CHUNKS_COUNT =
+        64;  ///< Maximal number of partial Gram matrices the tiles are split
+             ///< into, independently of the number of threads.
+
+}  // namespace CMAT
+
+/**
+ * @struct TCorrelationMatrixParams
+ * @brief Contains parameters used for computing the correlation matrix.
+ */
+struct TCorrelationMatrixParams {
+    // Signal Parameters
+    std::vector<const TSignalLine*>
+        signalLines;  ///< Pointers to the channel signal lines.
+
+    // Calculation Parameters
+    std::optional<std::size_t> maxLag =
+        CMAT::DEFAULT_MAX_LAG;  ///< Maximal lag in samples. If positive, the
+                                ///< peak of the lagged correlation is searched
+                                ///< within [-maxLag, maxLag].
+    std::optional<double> inaccuracy =
+        SL::DEFAULT_INACCURACY;  ///< Allowed inaccuracy for comparing the
+                                 ///< signal lines.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads (hardware concurrency if not set).
+};
+
+/**
+ * @class TCorrelationMatrix
+ * @brief Class for computing the symmetric matrix of normalized correlation
+ * coefficients between all pairs of channels.
+ *
+ * @details For the zero-lag matrix every coefficient is defined exactly as in
+ * TCorrelator with normalization. The channel energies are computed once, and
+ * the matrix is computed as a Gram matrix with a blocked GEMM-style kernel:
+ * the samples are split into at most `CMAT::GRAM_CHUNKS_COUNT` chunks
+ * processed on several threads, every chunk packs tiles of
+ * `CMAT::SAMPLES_PER_TILE` samples of all channels and accumulates only the
+ * upper triangle of its partial matrix in `CMAT::CHANNELS_PER_BLOCK` square
+ * blocks. The partial matrices are added up in order, so the result does not
+ * depend on the number of threads.
+ *
+ * If `maxLag` is positive, the cross-correlation of every pair is computed for
+ * all lags via FFT (the channel spectra are computed once), and the matrix
+ * holds the coefficient with the largest absolute value within
+ * [-maxLag, maxLag]. The samples are scaled by the square roots of the
+ * trapezoidal weights before the transforms, so both paths share one weighting
+ * and normalization: the lag-0 coefficients equal the zero-lag matrix, and the
+ * other lags weight every product by the geometric mean of the weights of its
+ * samples.
+ */
+class TCorrelationMatrix {
+   public:
+    /**
+     * @brief Constructs a TCorrelationMatrix with channel signal lines.
+     *
+     * @param signalLines Pointers to the channel signal lines.
+     * @param maxLag Maximal lag in samples (zero-lag correlation if 0).
+     * @param inaccuracy Allowed inaccuracy for comparing the signal lines.
+     * @param threadsCount Number of threads (hardware concurrency if not set).
+     */
+    explicit TCorrelationMatrix(
+        std::vector<const TSignalLine*> signalLines,
+        std::optional<std::size_t>      maxLag       = CMAT::DEFAULT_MAX_LAG,
+        std::optional<double>           inaccuracy   = SL::DEFAULT_INACCURACY,
+        std::optional<std::size_t>      threadsCount = std::nullopt);
+
+    /**
+     * @brief Constructs a TCorrelationMatrix with calculation parameters.
+     *
+     * @param params Structure containing the parameters for the calculation.
+     */
+    explicit TCorrelationMatrix(TCorrelationMatrixParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TCorrelationMatrix() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TCorrelationMatrix(const TCorrelationMatrix&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TCorrelationMatrix(TCorrelationMatrix&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TCorrelationMatrix& operator=(const TCorrelationMatrix&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TCorrelationMatrix& operator=(TCorrelationMatrix&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the correlation coefficient of two channels.
+     *
+     * @param row Index of the first channel.
+     * @param column Index of the second channel.
+     * @return double The correlation coefficient.
+     *
+     * @throw SignalProcessingError If the matrix has not been computed yet or
+     * if an index is out of bounds.
+     */
+    [[nodiscard]] double getCorrelationValue(std::size_t row,
+                                             std::size_t column) const;
+
+    /**
+     * @brief Retrieves the lag of the correlation peak of two channels.
+     *
+     * @param row Index of the first channel.
+     * @param column Index of the second channel.
+     * @return double The lag, in units of the x-axis, by which the second
+     * channel is delayed relative to the first one (zero for the zero-lag
+     * matrix).
+     *
+     * @throw SignalProcessingError If the matrix has not been computed yet or
+     * if an index is out of bounds.
+     */
+    [[nodiscard]] double getLag(std::size_t row, std::size_t column) const;
+
+    /**
+     * @brief Retrieves the whole correlation matrix.
+     *
+     * @return const std::vector<double>& The matrix in row-major order
+     * (channels count x channels count).
+     *
+     * @throw SignalProcessingError If the matrix has not been computed yet.
+     */
+    [[nodiscard]] const std::vector<double>& getCorrelationMatrix() const;
+
+    /**
+     * @brief Retrieves the parameters used for the calculation.
+     *
+     * @return const TCorrelationMatrixParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TCorrelationMatrixParams& getParams() const;
+
+    /**
+     * @brief Checks whether the matrix has been computed.
+     *
+     * @return true If the matrix has been computed.
+     * @return false Otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Computes the correlation matrix.
+     *
+     * @throw SignalProcessingError If there are no channels, if one of the
+     * signal lines is invalid or not equal to the first one, or if it does not
+     * have duration information.
+     */
+    void execute();
+
+   private:
+    std::vector<double> _matrix = {};  ///< Correlation matrix (row-major).
+    std::vector<double> _lags   = {};  ///< Lags of the correlation peaks.
+    TCorrelationMatrixParams _params =
+        {};  ///< Parameters used for the calculation.
+
+    bool _isExecuted = false;  ///< Flag indicating if the matrix has been
+                               ///< computed.
+
+    /**
+     * @brief Computes the zero-lag matrix with the blocked Gram kernel.
+     */
+    void computeZeroLag();
+
+    /**
+     * @brief Computes the peak lagged matrix via FFT cross-correlation.
+     */
+    void computeLagged();
+};
\ No newline at end of file
@@ -0,0 +1,270 @@
+/**
+ * @file TCrossSpectrum.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TCrossSpectrum class estimating
+ * auto- and cross-spectra, transfer functions and coherence of two signal
+ * lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TCrossSpectrum.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /// Labels for the y-axes of the results, indexed by CSD::Result
+    const std::array<std::string, CSD::RESULTS_COUNT> Y_LABELS = {
+        "Input PSD", "Output PSD", "Cross Magnitude", "Cross Phase",
+        "Magnitude", "Phase",      "Coherence"};
+
+    /**
+     * @struct Accumulator
+     * @brief Sums of the segment spectra of one chunk.
+     */
+    struct Accumulator {
+        std::vector<double>               input;   ///< Sum of |X|^2.
+        std::vector<double>               output;  ///< Sum of |Y|^2.
+        std::vector<std::complex<double>> cross;   ///< Sum of conj(X) * Y.
+    };
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TCrossSpectrum::TCrossSpectrum(
+    const TSignalLine*                  inputLine,
+    const TSignalLine*                  outputLine,
+    const std::optional<std::size_t>    segmentLength,
+    const std::optional<double>         overlap,
+    const std::optional<CSD::Estimator> estimator,
+    std::optional<std::string>          xLabel,
+    std::optional<std::string>          graphLabel)
+    : _params{.inputLine     = inputLine,
+              .outputLine    = outputLine,
+              .segmentLength = segmentLength,
+              .overlap       = overlap,
+              .estimator     = estimator,
+              .xLabel        = std::move(xLabel),
+              .graphLabel    = std::move(graphLabel)} {}
+
+TCrossSpectrum::TCrossSpectrum(TCrossSpectrumParams params)
+    : _params(std::move(params)) {}
+
+const TSignalLine* TCrossSpectrum::getSignalLine(
+    const CSD::Result result) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cross spectrum not executed");
+    }
+    return &_lines.at(static_cast<std::size_t>(result));
+}
+
+std::size_t TCrossSpectrum::getSegmentsCount() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Cross spectrum not executed");
+    }
+    return _segmentsCount;
+}
+
+const TCrossSpectrumParams& TCrossSpectrum::getParams() const {
+    return _params;
+}
+
+bool TCrossSpectrum::isExecuted() const {
+    return _isExecuted;
+}
+
+void TCrossSpectrum::execute() {
+    // We're ensuring that the signal lines are not null here because they may
+    // be set after the TCrossSpectrum object creation.
+    if (_params.inputLine == nullptr || _params.outputLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       input       = _params.inputLine->getPoints();
+    const auto&       output      = _params.outputLine->getPoints();
+    const std::size_t pointsCount = input.size();
+    if (output.size() != pointsCount) {
+        throw SignalProcessingError(
+            "Input and output lines should have the same points count");
+    }
+    const auto samplingFrequency =
+        _params.inputLine->getParams().samplingFrequency;
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Input line should have a positive sampling frequency");
+    }
+
+    const std::size_t length =
+        _params.segmentLength.value_or(CSD::DEFAULT_SEGMENT_LENGTH);
+    if (length < 2 || !TFFT::isPowerOfTwo(length)) {
+        throw SignalProcessingError(
+            "Segment length should be a power of two (at least 2)");
+    }
+    if (pointsCount < length) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    const auto outputFrequency =
+        _params.outputLine->getParams().samplingFrequency;
+    if (!outputFrequency ||
+        std::abs(*outputFrequency - *samplingFrequency) >
+            _params.inaccuracy.value_or(SL::DEFAULT_INACCURACY) ||
+        !_params.inputLine->equals(_params.outputLine, _params.inaccuracy)) {
+        throw SignalProcessingError("Signal lines aren't equal");
+    }
+    const double overlap = _params.overlap.value_or(CSD::DEFAULT_OVERLAP);
+    if (overlap < 0.0 || overlap >= 1.0) {
+        throw SignalProcessingError("Overlap should be within [0, 1)");
+    }
+
+    const std::size_t hop = std::max<std::size_t>(
+        1, length - static_cast<std::size_t>(
+                        std::lround(overlap * static_cast<double>(length))));
+    const std::size_t segmentsCount = 1 + (pointsCount - length) / hop;
+    const std::size_t binsCount     = length / 2 + 1;
+    const auto        window =
+        WIN::makeWindow(_params.window.value_or(CSD::DEFAULT_WINDOW), length);
+    const TFFT fft(length);
+
+    // Every chunk of segments has its own sums, added up in order: the
+    // summation order depends neither on scheduling nor on the thread count
+    const std::size_t chunksCount =
+        (segmentsCount + CSD::SEGMENTS_PER_CHUNK - 1) /
+        CSD::SEGMENTS_PER_CHUNK;
+    std::vector<Accumulator> sums(chunksCount);
+    PAR::parallelFor(
+        chunksCount,
+        [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+            std::vector<double>               inputBatch;
+            std::vector<double>               outputBatch;
+            std::vector<std::complex<double>> inputSpectra;
+            std::vector<std::complex<double>> outputSpectra;
+            for (std::size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                Accumulator& sum = sums[chunk];
+                sum.input.assign(binsCount, 0.0);
+                sum.output.assign(binsCount, 0.0);
+                sum.cross.assign(binsCount, {0.0, 0.0});
+
+                const std::size_t first = chunk * CSD::SEGMENTS_PER_CHUNK;
+                const std::size_t last =
+                    std::min(first + CSD::SEGMENTS_PER_CHUNK, segmentsCount);
+                for (std::size_t batch = first; batch < last;
+                     batch += CSD::SEGMENTS_PER_BATCH) {
+                    const std::size_t count =
+                        std::min(CSD::SEGMENTS_PER_BATCH, last - batch);
+                    inputBatch.resize(count * length);
+                    outputBatch.resize(count * length);
+
+                    // Mean removal and windowing of every segment
+                    for (std::size_t s = 0; s < count; ++s) {
+                        const std::size_t start = (batch + s) * hop;
+                        double            inputMean  = 0.0;
+                        double            outputMean = 0.0;
+                        for (std::size_t i = 0; i < length; ++i) {
+                            inputMean += input[start + i].y;
+                            outputMean += output[start + i].y;
+                        }
+                        inputMean /= static_cast<double>(length);
+                        outputMean /= static_cast<double>(length);
+                        for (std::size_t i = 0; i < length; ++i) {
+                            inputBatch[s * length + i] =
+                                (input[start + i].y - inputMean) * window[i];
+                            outputBatch[s * length + i] =
+                                (output[start + i].y - outputMean) * window[i];
+                        }
+                    }
+
+                    fft.forwardRealBatch(inputBatch, count, inputSpectra);
+                    fft.forwardRealBatch(outputBatch, count, outputSpectra);
+                    for (std::size_t s = 0; s < count; ++s) {
+                        for (std::size_t k = 0; k < binsCount; ++k) {
+                            const std::complex<double>& x =
+                                inputSpectra[s * binsCount + k];
+                            const std::complex<double>& y =
+                                outputSpectra[s * binsCount + k];
+                            sum.input[k] += std::norm(x);
+                            sum.output[k] += std::norm(y);
+                            sum.cross[k] += std::conj(x) * y;
+                        }
+                    }
+                }
+            }
+        },
+        _params.threadsCount);
+
+    // One-sided density scaling: 1 / (fs * sum(w^2)) per segment, doubled
+    // except at zero and Nyquist frequencies
+    double windowEnergy = 0.0;
+    for (const double value : window) {
+        windowEnergy += value * value;
+    }
+    const double scale = 1.0 / (*samplingFrequency * windowEnergy *
+                                static_cast<double>(segmentsCount));
+
+    const bool isH1 = _params.estimator.value_or(CSD::DEFAULT_ESTIMATOR) ==
+                      CSD::Estimator::H1;
+    std::vector<std::vector<Point>> results(
+        CSD::RESULTS_COUNT, std::vector<Point>(binsCount));
+    for (std::size_t k = 0; k < binsCount; ++k) {
+        double               inputDensity  = 0.0;
+        double               outputDensity = 0.0;
+        std::complex<double> crossDensity  = {0.0, 0.0};
+        for (const auto& sum : sums) {
+            inputDensity += sum.input[k];
+            outputDensity += sum.output[k];
+            crossDensity += sum.cross[k];
+        }
+        const double factor = (k == 0 || k == binsCount - 1) ? scale
+                                                             : 2.0 * scale;
+        inputDensity *= factor;
+        outputDensity *= factor;
+        crossDensity *= factor;
+
+        std::complex<double> transfer = {0.0, 0.0};
+        if (isH1 && inputDensity > 0.0) {
+            transfer = crossDensity / inputDensity;
+        } else if (!isH1 && std::abs(crossDensity) > 0.0) {
+            transfer = outputDensity / std::conj(crossDensity);
+        }
+        const double densities = inputDensity * outputDensity;
+        const double coherence =
+            densities > 0.0 ? std::norm(crossDensity) / densities : 0.0;
+
+        const double frequency = static_cast<double>(k) * *samplingFrequency /
+                                 static_cast<double>(length);
+        const std::array<double, CSD::RESULTS_COUNT> values = {
+            inputDensity,       outputDensity,      std::abs(crossDensity),
+            std::arg(crossDensity), std::abs(transfer), std::arg(transfer),
+            coherence};
+        for (std::size_t r = 0; r < CSD::RESULTS_COUNT; ++r) {
+            results[r][k] = Point{.x = frequency, .y = values[r]};
+        }
+    }
+
+    _lines.clear();
+    _lines.reserve(CSD::RESULTS_COUNT);
+    for (std::size_t r = 0; r < CSD::RESULTS_COUNT; ++r) {
+        _lines.emplace_back(binsCount, _params.xLabel, Y_LABELS[r],
+                            _params.graphLabel);
+        _lines.back().setPoints(std::move(results[r]));
+    }
+    _segmentsCount = segmentsCount;
+
+    _isExecuted = true;
+}
\ No newline at end of file
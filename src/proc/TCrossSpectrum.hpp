@@ -0,0 +1,237 @@
+/**
+ * @file TCrossSpectrum.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TCrossSpectrum class estimating auto-
+ * and cross-spectra, transfer functions and coherence of two signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace CSD
+ * @brief Contains default parameters used for cross-spectral estimation.
+ */
+namespace CSD {
+
+    /**
+     * @enum Estimator
+     * @brief Specifies the transfer function estimator.
+     */
+    enum class Estimator : std::uint8_t {
+        H1,  ///< `Gxy / Gxx`; unbiased by noise on the response.
+        H2   ///< `Gyy / Gyx`; unbiased by noise on the excitation.
+    };
+
+    /**
+     * @enum Result
+     * @brief Enumerates the produced signal lines.
+     */
+    enum class Result : std::uint8_t {
+        InputSpectrum,   ///< Power spectral density of the excitation.
+        OutputSpectrum,  ///< Power spectral density of the response.
+        CrossMagnitude,  ///< Magnitude of the cross-spectral density.
+        CrossPhase,      ///< Phase of the cross-spectral density, in radians.
+        Magnitude,       ///< Magnitude of the transfer function.
+        Phase,           ///< Phase of the transfer function, in radians.
+        Coherence        ///< Magnitude-squared coherence within [0, 1].
+    };
+
+    static constexpr std::size_t RESULTS_COUNT =
+        7;  ///< Number of produced signal lines.
+    static constexpr std::size_t DEFAULT_SEGMENT_LENGTH =
+        256;  ///< Default number of samples per segment (a power of two).
+    static constexpr double DEFAULT_OVERLAP =
+        0.5;  ///< Default fraction of overlap between adjacent segments.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Hann;  ///< Default segment window.
+    static constexpr auto DEFAULT_ESTIMATOR =
+        Estimator::H1;  ///< Default transfer function estimator.
+    static const std::string DEFAULT_X_LABEL =
+        "Frequency";  ///< Default label for the x-axis.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Cross Spectrum";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t SEGMENTS_PER_BATCH =
+        16;  ///< Number of segments transformed together.
+    static constexpr std::size_t SEGMENTS_PER_CHUNK =
+        64;  ///< Number of segments accumulated into one partial sum.
+
+}  // namespace CSD
+
+/**
+ * @struct TCrossSpectrumParams
+ * @brief Contains parameters used for cross-spectral estimation.
+ */
+struct TCrossSpectrumParams {
+    // Signal Parameters
+    const TSignalLine* inputLine =
+        nullptr;  ///< Pointer to the excitation signal line.
+    const TSignalLine* outputLine =
+        nullptr;  ///< Pointer to the response signal line (same x-grid).
+
+    // Calculation Parameters
+    std::optional<std::size_t> segmentLength =
+        CSD::DEFAULT_SEGMENT_LENGTH;  ///< Samples per segment (a power of two).
+    std::optional<double> overlap =
+        CSD::DEFAULT_OVERLAP;  ///< Fraction of overlap within [0, 1).
+    std::optional<WIN::WindowType> window =
+        CSD::DEFAULT_WINDOW;  ///< Segment window.
+    std::optional<CSD::Estimator> estimator =
+        CSD::DEFAULT_ESTIMATOR;  ///< Transfer function estimator.
+    std::optional<double> inaccuracy =
+        SL::DEFAULT_INACCURACY;  ///< Allowed inaccuracy for comparing the
+                                 ///< signal lines.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        CSD::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> graphLabel =
+        CSD::DEFAULT_GRAPH_LABEL;  ///< Label for the graphs.
+};
+
+/**
+ * @class TCrossSpectrum
+ * @brief Class for estimating the spectra, transfer function and coherence of
+ * an excitation and its response (Welch's method).
+ *
+ * @details Both lines should share the sampling frequency and the x-grid
+ * (compared within `inaccuracy`). They are cut into segments of
+ * `segmentLength` samples overlapping by `overlap`; every segment has its
+ * mean removed, is windowed and transformed. The one-sided densities `Gxx`,
+ * `Gyy` and `Gxy = conj(X) * Y` are averaged over all segments in a single
+ * pass: the segments are split into chunks of `CSD::SEGMENTS_PER_CHUNK`
+ * processed on several threads, transformed in batches of
+ * `CSD::SEGMENTS_PER_BATCH` and accumulated into per-chunk sums that are added
+ * up in order at the end. The chunks do not depend on the number of threads,
+ * so neither do the results.
+ * All results are then derived from the averaged densities:
+ *
+ * - the transfer function `H1 = Gxy / Gxx` or `H2 = Gyy / Gyx`;
+ * - the magnitude-squared coherence `|Gxy|^2 / (Gxx * Gyy)`.
+ *
+ * Every result is a line of `segmentLength / 2 + 1` points from zero to the
+ * Nyquist frequency of the input line. A single segment always yields a
+ * coherence of one, so several segments are needed for a meaningful estimate.
+ */
+class TCrossSpectrum {
+   public:
+    /**
+     * @brief Constructs a TCrossSpectrum with an excitation and a response.
+     *
+     * @param inputLine Pointer to the excitation signal line.
+     * @param outputLine Pointer to the response signal line.
+     * @param segmentLength Samples per segment (a power of two).
+     * @param overlap Fraction of overlap between adjacent segments.
+     * @param estimator Transfer function estimator.
+     * @param xLabel Label for the x-axis.
+     * @param graphLabel Label for the graphs.
+     */
+    TCrossSpectrum(
+        const TSignalLine*            inputLine,
+        const TSignalLine*            outputLine,
+        std::optional<std::size_t> segmentLength =
+            CSD::DEFAULT_SEGMENT_LENGTH,
+        std::optional<double>         overlap    = CSD::DEFAULT_OVERLAP,
+        std::optional<CSD::Estimator> estimator  = CSD::DEFAULT_ESTIMATOR,
+        std::optional<std::string>    xLabel     = CSD::DEFAULT_X_LABEL,
+        std::optional<std::string>    graphLabel = CSD::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TCrossSpectrum with estimation parameters.
+     *
+     * @param params Structure containing the parameters of the estimation.
+     */
+    explicit TCrossSpectrum(TCrossSpectrumParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TCrossSpectrum() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TCrossSpectrum(const TCrossSpectrum&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TCrossSpectrum(TCrossSpectrum&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TCrossSpectrum& operator=(const TCrossSpectrum&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TCrossSpectrum& operator=(TCrossSpectrum&&) noexcept = default;
+
+    /**
+     * @brief Retrieves one of the estimated lines.
+     *
+     * @param result The line to retrieve.
+     * @return const TSignalLine* A pointer to the signal line.
+     *
+     * @throw SignalProcessingError If the estimation has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine(CSD::Result result) const;
+
+    /**
+     * @brief Retrieves the number of averaged segments.
+     *
+     * @return std::size_t The number of segments.
+     *
+     * @throw SignalProcessingError If the estimation has not been executed.
+     */
+    [[nodiscard]] std::size_t getSegmentsCount() const;
+
+    /**
+     * @brief Retrieves the parameters of the estimation.
+     *
+     * @return const TCrossSpectrumParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TCrossSpectrumParams& getParams() const;
+
+    /**
+     * @brief Determines if the estimation has been executed.
+     *
+     * @return bool True if the estimation has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Estimates the spectra, transfer function and coherence.
+     *
+     * @throws SignalProcessingError If a line is null, if the lines have
+     * different points counts or fewer points than a segment, if the input
+     * line has no sampling frequency, or if the parameters are invalid.
+     */
+    void execute();
+
+   private:
+    std::vector<TSignalLine> _lines =
+        {};  ///< Estimated lines, indexed by CSD::Result.
+    TCrossSpectrumParams _params = {};  ///< Parameters of the estimation.
+    std::size_t _segmentsCount = 0;     ///< Number of averaged segments.
+    bool _isExecuted = false;  ///< Flag indicating if the estimation has been
+                               ///< executed.
+};
\ No newline at end of file
@@ -0,0 +1,421 @@
+/**
+ * @file TDemodulator.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TDemodulator class extracting the
+ * amplitude, frequency or phase modulation of a signal.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TDemodulator.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /// Coefficients of the odd polynomial approximating atan(t) on [0, 1]
+    constexpr std::array<double, 9> ATAN_COEFFICIENTS = {
+        1.0,           -0.3333314528, 0.1999355085,
+        -0.1420889944, 0.1065626393,  -0.0752896400,
+        0.0429096138,  -0.0161657367, 0.0028662257};
+
+    /**
+     * @brief Computes atan2 with a polynomial approximation (Abramowitz and
+     * Stegun 4.4.49, absolute error below 2e-8 rad).
+     * @details The function has no data-dependent branches, so loops calling
+     * it can be vectorized.
+     *
+     * @param y The ordinate.
+     * @param x The abscissa.
+     * @return double The angle of (x, y) within [-pi, pi].
+     */
+    inline double fastAtan2(const double y, const double x) {
+        const double absX    = std::abs(x);
+        const double absY    = std::abs(y);
+        const double largest = std::max(absX, absY);
+        const double ratio =
+            largest > 0.0 ? std::min(absX, absY) / largest : 0.0;
+        const double square = ratio * ratio;
+
+        double polynomial = ATAN_COEFFICIENTS.back();
+        for (std::size_t i = ATAN_COEFFICIENTS.size() - 1; i-- > 0;) {
+            polynomial = polynomial * square + ATAN_COEFFICIENTS[i];
+        }
+        double angle = ratio * polynomial;
+        angle = absY > absX ? M_PI / 2.0 - angle : angle;
+        angle = x < 0.0 ? M_PI - angle : angle;
+        return std::copysign(angle, y);
+    }
+
+    /**
+     * @brief Computes the angles of complex values.
+     *
+     * @param values The complex values.
+     * @param angles Receives the angles within [-pi, pi].
+     */
+    void computeAngles(const std::vector<std::complex<double>>& values,
+                       std::vector<double>&                     angles) {
+        angles.resize(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            angles[i] = fastAtan2(values[i].imag(), values[i].real());
+        }
+    }
+
+    /**
+     * @brief Designs a windowed FIR Hilbert transformer.
+     *
+     * @param length Number of taps (odd).
+     * @return std::vector<double> The filter coefficients.
+     */
+    std::vector<double> designHilbert(const std::size_t length) {
+        const auto window = WIN::makeWindow(WIN::WindowType::Blackman, length);
+        const long long     center = static_cast<long long>(length - 1) / 2;
+        std::vector<double> taps(length, 0.0);
+        for (std::size_t n = 0; n < length; ++n) {
+            const long long offset = static_cast<long long>(n) - center;
+            if (offset % 2 != 0) {
+                taps[n] =
+                    window[n] * 2.0 / (M_PI * static_cast<double>(offset));
+            }
+        }
+        return taps;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TDemodulator::TDemodulator(const TSignalLine*               signalLine,
+                           const std::optional<DEMOD::Type> type,
+                           const std::optional<double>      carrierFrequency,
+                           std::optional<std::string>       xLabel,
+                           std::optional<std::string>       yLabel,
+                           std::optional<std::string>       graphLabel)
+    : _params{.signalLine       = signalLine,
+              .type             = type,
+              .carrierFrequency = carrierFrequency,
+              .xLabel           = std::move(xLabel),
+              .yLabel           = std::move(yLabel),
+              .graphLabel       = std::move(graphLabel)} {}
+
+TDemodulator::TDemodulator(TDemodulatorParams params)
+    : _params(std::move(params)) {}
+
+TDemodulator::TDemodulator(const TDemodulator& demodulator)
+    : _sl(demodulator._sl ? std::make_unique<TSignalLine>(*demodulator._sl)
+                          : nullptr),
+      _params(demodulator._params),
+      _stream(demodulator._stream),
+      _isExecuted(demodulator._isExecuted) {}
+
+TDemodulator& TDemodulator::operator=(const TDemodulator& demodulator) {
+    if (this == &demodulator) {
+        return *this;
+    }
+    _sl         = demodulator._sl
+                      ? std::make_unique<TSignalLine>(*demodulator._sl)
+                      : nullptr;
+    _params     = demodulator._params;
+    _stream     = demodulator._stream;
+    _isExecuted = demodulator._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TDemodulator::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Demodulator not executed");
+    }
+    return _sl.get();
+}
+
+const TDemodulatorParams& TDemodulator::getParams() const {
+    return _params;
+}
+
+bool TDemodulator::isExecuted() const {
+    return _isExecuted;
+}
+
+void TDemodulator::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TDemodulator object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    if (_params.quadratureLine != nullptr &&
+        _params.quadratureLine->getPoints().size() != pointsCount) {
+        throw SignalProcessingError(
+            "In-phase and quadrature lines should have the same points count");
+    }
+
+    const double samplingFrequency = resolveSamplingFrequency();
+    State        state             = makeState(samplingFrequency, 0);
+
+    std::vector<std::complex<double>> analytic(pointsCount);
+    if (_params.quadratureLine != nullptr) {
+        const auto& quadrature = _params.quadratureLine->getPoints();
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            analytic[i] = {points[i].y, quadrature[i].y};
+        }
+    } else {
+        // Analytic signal via FFT: the negative frequencies are removed and
+        // the positive ones doubled.
+        const std::size_t fftSize =
+            std::max<std::size_t>(2, TFFT::nextPowerOfTwo(pointsCount));
+        const TFFT          fft(fftSize);
+        std::vector<double> samples(fftSize, 0.0);
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            samples[i] = points[i].y;
+        }
+        std::vector<std::complex<double>> spectrum;
+        fft.forwardReal(samples, spectrum);
+
+        std::vector<std::complex<double>> full(fftSize, {0.0, 0.0});
+        full[0]           = spectrum[0];
+        full[fftSize / 2] = spectrum[fftSize / 2];
+        for (std::size_t k = 1; k < fftSize / 2; ++k) {
+            full[k] = 2.0 * spectrum[k];
+        }
+        fft.inverse(full);
+        std::copy(full.begin(),
+                  full.begin() + static_cast<std::ptrdiff_t>(pointsCount),
+                  analytic.begin());
+    }
+
+    const auto         output = detect(state, analytic, samplingFrequency);
+    std::vector<Point> outputPoints(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        outputPoints[i] = Point{.x = points[i].x, .y = output[i]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    slParams.pointsCount       = pointsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+std::vector<double> TDemodulator::processBlock(
+    const std::span<const double> samples) {
+    const double samplingFrequency = resolveSamplingFrequency();
+    if (!_stream) {
+        const std::size_t taps =
+            _params.hilbertTaps.value_or(DEMOD::DEFAULT_HILBERT_TAPS);
+        if (taps % 2 == 0) {
+            throw SignalProcessingError("Hilbert taps count should be odd");
+        }
+        _stream          = makeState(samplingFrequency, (taps - 1) / 2);
+        _stream->hilbert = designHilbert(taps);
+        _stream->history.assign(taps - 1, 0.0);
+    }
+    State& state = *_stream;
+
+    const std::size_t   historyLength = state.history.size();
+    const std::size_t   delay         = historyLength / 2;
+    std::vector<double> buffer(historyLength + samples.size());
+    std::copy(state.history.begin(), state.history.end(), buffer.begin());
+    std::copy(samples.begin(), samples.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    // The in-phase part is the input delayed to the center of the
+    // transformer; only the taps at odd offsets from the center are nonzero.
+    std::vector<std::complex<double>> analytic(samples.size());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        const double* current    = buffer.data() + historyLength + i;
+        double        quadrature = 0.0;
+        for (std::size_t t = (delay + 1) % 2; t < state.hilbert.size();
+             t += 2) {
+            quadrature += state.hilbert[t] * *(current - t);
+        }
+        analytic[i] = {*(current - delay), quadrature};
+    }
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), state.history.begin());
+    return detect(state, analytic, samplingFrequency);
+}
+
+std::vector<double> TDemodulator::processBlock(
+    const std::span<const double> inPhase,
+    const std::span<const double> quadrature) {
+    if (inPhase.size() != quadrature.size()) {
+        throw SignalProcessingError(
+            "In-phase and quadrature blocks should have the same size");
+    }
+    const double samplingFrequency = resolveSamplingFrequency();
+    if (!_stream) {
+        _stream = makeState(samplingFrequency, 0);
+    }
+
+    std::vector<std::complex<double>> analytic(inPhase.size());
+    for (std::size_t i = 0; i < inPhase.size(); ++i) {
+        analytic[i] = {inPhase[i], quadrature[i]};
+    }
+    return detect(*_stream, analytic, samplingFrequency);
+}
+
+void TDemodulator::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TDemodulator::State TDemodulator::makeState(const double      samplingFrequency,
+                                            const std::size_t delay) const {
+    const auto type = _params.type.value_or(DEMOD::DEFAULT_TYPE);
+    if (type != DEMOD::Type::AM && type != DEMOD::Type::FM &&
+        type != DEMOD::Type::PM) {
+        throw SignalProcessingError("Invalid demodulation type");
+    }
+
+    State state;
+    const double carrier =
+        _params.carrierFrequency.value_or(DEMOD::DEFAULT_CARRIER_FREQ_HZ);
+    if (carrier != 0.0) {
+        // The analytic sample n corresponds to the input sample n - delay
+        state.carrierPhase = std::remainder(
+            TWO_PI * carrier * static_cast<double>(delay) / samplingFrequency,
+            TWO_PI);
+        state.oscillator = {cos(state.carrierPhase), sin(state.carrierPhase)};
+    }
+    return state;
+}
+
+double TDemodulator::resolveSamplingFrequency() const {
+    std::optional<double> samplingFrequency = _params.samplingFrequency;
+    if (!samplingFrequency && _params.signalLine != nullptr) {
+        samplingFrequency = _params.signalLine->getParams().samplingFrequency;
+    }
+
+    const bool needed =
+        _params.type.value_or(DEMOD::DEFAULT_TYPE) == DEMOD::Type::FM ||
+        _params.carrierFrequency.value_or(DEMOD::DEFAULT_CARRIER_FREQ_HZ) !=
+            0.0;
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        if (needed) {
+            throw SignalProcessingError(
+                "Sampling frequency should be set and positive");
+        }
+        return 0.0;
+    }
+    return *samplingFrequency;
+}
+
+std::vector<double> TDemodulator::detect(
+    State&                             state,
+    std::vector<std::complex<double>>& analytic,
+    const double                       samplingFrequency) const {
+    const std::size_t count = analytic.size();
+
+    // Carrier removal with a rotating oscillator resynchronized from its
+    // phase periodically. The increment is reduced to [-pi, pi] once, so a
+    // single comparison keeps the phase wrapped.
+    const double carrier =
+        _params.carrierFrequency.value_or(DEMOD::DEFAULT_CARRIER_FREQ_HZ);
+    if (carrier != 0.0) {
+        const double increment =
+            std::remainder(-TWO_PI * carrier / samplingFrequency, TWO_PI);
+        const std::complex<double> rotation = {cos(increment), sin(increment)};
+        std::complex<double>&      oscillator = state.oscillator;
+        for (std::size_t i = 0; i < count; ++i) {
+            if ((state.samplesCount + i) % DEMOD::NCO_RESYNC_INTERVAL == 0) {
+                oscillator = {cos(state.carrierPhase),
+                              sin(state.carrierPhase)};
+            }
+            const std::complex<double> value = analytic[i];
+            analytic[i]                      = {
+                value.real() * oscillator.real() -
+                    value.imag() * oscillator.imag(),
+                value.real() * oscillator.imag() +
+                    value.imag() * oscillator.real()};
+            oscillator = {oscillator.real() * rotation.real() -
+                              oscillator.imag() * rotation.imag(),
+                          oscillator.real() * rotation.imag() +
+                              oscillator.imag() * rotation.real()};
+            state.carrierPhase += increment;
+            if (state.carrierPhase > M_PI) {
+                state.carrierPhase -= TWO_PI;
+            } else if (state.carrierPhase < -M_PI) {
+                state.carrierPhase += TWO_PI;
+            }
+        }
+    }
+    state.samplesCount += count;
+
+    std::vector<double> output(count);
+    switch (_params.type.value_or(DEMOD::DEFAULT_TYPE)) {
+        case DEMOD::Type::AM:
+            for (std::size_t i = 0; i < count; ++i) {
+                output[i] = sqrt(analytic[i].real() * analytic[i].real() +
+                                 analytic[i].imag() * analytic[i].imag());
+            }
+            break;
+        case DEMOD::Type::FM: {
+            // Phase differences from z[n] * conj(z[n - 1]) need no unwrapping
+            std::vector<std::complex<double>> products(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::complex<double>& current = analytic[i];
+                const std::complex<double>& previous =
+                    i > 0 ? analytic[i - 1] : state.previous;
+                products[i] = {current.real() * previous.real() +
+                                   current.imag() * previous.imag(),
+                               current.imag() * previous.real() -
+                                   current.real() * previous.imag()};
+            }
+            computeAngles(products, output);
+            const double scale = samplingFrequency / TWO_PI;
+            for (auto& value : output) {
+                value *= scale;
+            }
+            if (count > 0) {
+                state.previous = analytic.back();
+            }
+            break;
+        }
+        case DEMOD::Type::PM:
+            computeAngles(analytic, output);
+            for (auto& value : output) {
+                const double difference = value - state.previousPhase;
+                if (difference > M_PI) {
+                    state.phaseOffset -= TWO_PI;
+                } else if (difference < -M_PI) {
+                    state.phaseOffset += TWO_PI;
+                }
+                state.previousPhase = value;
+                value += state.phaseOffset;
+            }
+            break;
+        default:
+            throw SignalProcessingError("Invalid demodulation type");
+    }
+    return output;
+}
\ No newline at end of file
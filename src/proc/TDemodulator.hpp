@@ -0,0 +1,299 @@
+/**
+ * @file TDemodulator.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TDemodulator class extracting the
+ * amplitude, frequency or phase modulation of a signal.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace DEMOD
+ * @brief Contains default parameters used for demodulation.
+ */
+namespace DEMOD {
+
+    /**
+     * @enum Type
+     * @brief Enumerates the supported kinds of modulation.
+     */
+    enum class Type : std::uint8_t {
+        AM,  ///< Amplitude modulation; the output is the envelope.
+        FM,  ///< Frequency modulation; the output is the instantaneous
+             ///< frequency deviation from the carrier, in Hertz.
+        PM   ///< Phase modulation; the output is the unwrapped phase relative
+             ///< to the carrier, in radians.
+    };
+
+    static constexpr auto DEFAULT_TYPE =
+        Type::AM;  ///< Default kind of modulation.
+    static constexpr double DEFAULT_CARRIER_FREQ_HZ =
+        0.0;  ///< Default carrier frequency, in Hertz (baseband input).
+    static constexpr std::size_t DEFAULT_HILBERT_TAPS =
+        65;  ///< Default number of taps of the streaming Hilbert transformer
+             ///< (odd).
+    static const std::string DEFAULT_Y_LABEL =
+        "Demodulated Signal";  ///< Default label for the y-axis.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Demodulation";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t NCO_RESYNC_INTERVAL =
+        1024;  ///< Number of samples after which the carrier oscillator is
+               ///< recomputed from its phase to prevent amplitude drift.
+
+}  // namespace DEMOD
+
+/**
+ * @struct TDemodulatorParams
+ * @brief Contains parameters used for demodulation.
+ */
+struct TDemodulatorParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the real input signal line, or to the
+                  ///< in-phase part of a complex input.
+    const TSignalLine* quadratureLine =
+        nullptr;  ///< Pointer to the quadrature part of a complex input. If
+                  ///< not set, the input is real.
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Input sampling frequency, in Hertz. If not set, the
+                       ///< sampling frequency of the signal line is used.
+
+    // Calculation Parameters
+    std::optional<DEMOD::Type> type =
+        DEMOD::DEFAULT_TYPE;  ///< Kind of modulation.
+    std::optional<double> carrierFrequency =
+        DEMOD::DEFAULT_CARRIER_FREQ_HZ;  ///< Carrier frequency removed before
+                                         ///< detection, in Hertz.
+    std::optional<std::size_t> hilbertTaps =
+        DEMOD::DEFAULT_HILBERT_TAPS;  ///< Number of taps of the streaming
+                                      ///< Hilbert transformer (odd).
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        DEMOD::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        DEMOD::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TDemodulator
+ * @brief Class for extracting the amplitude, frequency or phase modulation of
+ * a signal.
+ *
+ * @details All kinds of modulation are detected on the complex (analytic)
+ * signal `z[n]`:
+ *
+ * - a real input is turned into its analytic signal, via FFT for whole lines
+ *   and via a windowed FIR Hilbert transformer for streams;
+ * - a complex input (e.g. the output of TDownConverter) is used directly.
+ *
+ * If a carrier frequency is set, `z[n]` is shifted by `-carrierFrequency`
+ * first. Then AM yields the envelope `|z[n]|`, FM yields the frequency
+ * `arg(z[n] * conj(z[n - 1])) * fs / (2*pi)` and PM yields the unwrapped phase
+ * `arg(z[n])`. The phase angles are computed with a branch-free polynomial
+ * `atan2` (absolute error below 2e-8 rad) over whole blocks, which lets the
+ * compiler vectorize the loop.
+ *
+ * The streaming Hilbert transformer is causal, so the streaming output of a
+ * real input is delayed by `(hilbertTaps - 1) / 2` samples; the first
+ * `hilbertTaps - 1` samples are affected by the start-up of the filter.
+ */
+class TDemodulator {
+   public:
+    /**
+     * @brief Constructs a TDemodulator for a real signal line.
+     *
+     * @param signalLine Pointer to the real input signal line.
+     * @param type Kind of modulation.
+     * @param carrierFrequency Carrier frequency removed before detection, in
+     * Hertz.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TDemodulator(
+        const TSignalLine*         signalLine,
+        std::optional<DEMOD::Type> type = DEMOD::DEFAULT_TYPE,
+        std::optional<double> carrierFrequency = DEMOD::DEFAULT_CARRIER_FREQ_HZ,
+        std::optional<std::string> xLabel      = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel      = DEMOD::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel  = DEMOD::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TDemodulator with demodulation parameters.
+     *
+     * @param params Structure containing the parameters for demodulation.
+     */
+    explicit TDemodulator(TDemodulatorParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TDemodulator() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TDemodulator(const TDemodulator& demodulator);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TDemodulator(TDemodulator&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TDemodulator& operator=(const TDemodulator& demodulator);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TDemodulator& operator=(TDemodulator&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the demodulated signal line.
+     *
+     * @return const TSignalLine* A pointer to the demodulated signal line.
+     *
+     * @throw SignalProcessingError If the demodulator has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the demodulator.
+     *
+     * @return const TDemodulatorParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TDemodulatorParams& getParams() const;
+
+    /**
+     * @brief Determines if the demodulator has been executed.
+     *
+     * @return bool True if the demodulator has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Demodulates the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, if the quadrature line has a different number of points, or if
+     * the sampling frequency is needed but not known.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a real stream.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<double> Demodulated samples (one per input sample).
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Processes the next block of a complex stream.
+     *
+     * @param inPhase Next in-phase samples.
+     * @param quadrature Next quadrature samples.
+     * @return std::vector<double> Demodulated samples (one per input sample).
+     *
+     * @throws SignalProcessingError If the parts have different sizes or the
+     * parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> inPhase,
+        std::span<const double> quadrature);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Stream state of the demodulator.
+     */
+    struct State {
+        std::vector<double> hilbert = {};  ///< Hilbert transformer taps.
+        std::vector<double> history =
+            {};  ///< Last real input samples (Hilbert taps - 1).
+        std::complex<double> oscillator = {
+            1.0, 0.0};  ///< Carrier oscillator for the next sample.
+        double      carrierPhase = 0.0;  ///< Carrier phase, in radians.
+        std::size_t samplesCount = 0;    ///< Number of processed samples.
+        std::complex<double> previous = {
+            0.0, 0.0};  ///< Last analytic sample (FM detection).
+        double previousPhase = 0.0;  ///< Last wrapped phase (PM unwrapping).
+        double phaseOffset   = 0.0;  ///< Accumulated unwrapping offset.
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the demodulated signal line.
+    TDemodulatorParams   _params = {};  ///< Parameters of the demodulator.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the demodulator has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh stream state.
+     *
+     * @param samplingFrequency Input sampling frequency, in Hertz.
+     * @param delay Number of samples by which the analytic signal lags the
+     * input (shifts the carrier oscillator accordingly).
+     * @return State The initial stream state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState(double samplingFrequency,
+                                  std::size_t delay) const;
+
+    /**
+     * @brief Resolves the input sampling frequency.
+     *
+     * @return double The sampling frequency, in Hertz (zero if it is not known
+     * and not needed).
+     *
+     * @throws SignalProcessingError If the sampling frequency is needed but
+     * not known.
+     */
+    [[nodiscard]] double resolveSamplingFrequency() const;
+
+    /**
+     * @brief Removes the carrier and detects the modulation of analytic
+     * samples.
+     *
+     * @param state Stream state to advance.
+     * @param analytic Analytic samples (modified in place).
+     * @param samplingFrequency Input sampling frequency, in Hertz.
+     * @return std::vector<double> Demodulated samples.
+     */
+    [[nodiscard]] std::vector<double> detect(
+        State&                             state,
+        std::vector<std::complex<double>>& analytic,
+        double                             samplingFrequency) const;
+};
\ No newline at end of file
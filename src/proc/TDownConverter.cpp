@@ -0,0 +1,380 @@
+/**
+ * @file TDownConverter.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TDownConverter class shifting a
+ * band around a carrier to baseband and decimating it (digital
+ * down-converter).
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TDownConverter.hpp"
+#include "TCICFilter.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Resolves the input sampling frequency of the down-converter.
+     *
+     * @param params Parameters of the down-converter.
+     * @return double The sampling frequency, in Hertz.
+     *
+     * @throws SignalProcessingError If the sampling frequency is not known or
+     * not positive.
+     */
+    double resolveSamplingFrequency(const TDownConverterParams& params) {
+        std::optional<double> samplingFrequency = params.samplingFrequency;
+        if (!samplingFrequency && params.signalLine != nullptr) {
+            samplingFrequency =
+                params.signalLine->getParams().samplingFrequency;
+        }
+        if (!samplingFrequency || *samplingFrequency <= 0.0) {
+            throw SignalProcessingError(
+                "Sampling frequency should be set and positive");
+        }
+        return *samplingFrequency;
+    }
+
+    /**
+     * @brief Designs a half-band low-pass filter (cutoff at a quarter of the
+     * sampling frequency); every second coefficient except the center one is
+     * exactly zero.
+     *
+     * @param length Number of taps (4k - 1).
+     * @return std::vector<double> The filter coefficients with unit DC gain.
+     */
+    std::vector<double> designHalfBand(const std::size_t length) {
+        const auto          window = WIN::makeWindow(WIN::WindowType::Kaiser,
+                                                     length);
+        const std::size_t   center = (length - 1) / 2;
+        std::vector<double> taps(length, 0.0);
+        double              gain = 0.0;
+        for (std::size_t n = 0; n < length; ++n) {
+            const std::size_t distance = n > center ? n - center : center - n;
+            if (distance == 0) {
+                taps[n] = 0.5;
+            } else if (distance % 2 == 1) {
+                const double t = static_cast<double>(distance) / 2.0;
+                taps[n]        = window[n] * 0.5 * sin(M_PI * t) / (M_PI * t);
+            }
+            gain += taps[n];
+        }
+        for (auto& tap : taps) {
+            tap /= gain;
+        }
+        return taps;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TDownConverter::TDownConverter(
+    const TSignalLine*               signalLine,
+    const std::optional<double>      carrierFrequency,
+    const std::optional<std::size_t> cicDecimation,
+    const std::optional<std::size_t> halfBandStages,
+    std::optional<std::string>       xLabel,
+    std::optional<std::string>       graphLabel)
+    : _params{.signalLine       = signalLine,
+              .carrierFrequency = carrierFrequency,
+              .cicDecimation    = cicDecimation,
+              .halfBandStages   = halfBandStages,
+              .xLabel           = std::move(xLabel),
+              .graphLabel       = std::move(graphLabel)} {}
+
+TDownConverter::TDownConverter(TDownConverterParams params)
+    : _params(std::move(params)) {}
+
+TDownConverter::TDownConverter(const TDownConverter& converter)
+    : _inPhase(converter._inPhase
+                   ? std::make_unique<TSignalLine>(*converter._inPhase)
+                   : nullptr),
+      _quadrature(converter._quadrature
+                      ? std::make_unique<TSignalLine>(*converter._quadrature)
+                      : nullptr),
+      _params(converter._params),
+      _stream(converter._stream),
+      _isExecuted(converter._isExecuted) {}
+
+TDownConverter& TDownConverter::operator=(const TDownConverter& converter) {
+    if (this == &converter) {
+        return *this;
+    }
+    _inPhase    = converter._inPhase
+                      ? std::make_unique<TSignalLine>(*converter._inPhase)
+                      : nullptr;
+    _quadrature = converter._quadrature
+                      ? std::make_unique<TSignalLine>(*converter._quadrature)
+                      : nullptr;
+    _params     = converter._params;
+    _stream     = converter._stream;
+    _isExecuted = converter._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TDownConverter::getInPhaseLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Down-converter not executed");
+    }
+    return _inPhase.get();
+}
+
+const TSignalLine* TDownConverter::getQuadratureLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Down-converter not executed");
+    }
+    return _quadrature.get();
+}
+
+std::size_t TDownConverter::getDecimation() const {
+    return _params.cicDecimation.value_or(DDC::DEFAULT_CIC_DECIMATION)
+           << _params.halfBandStages.value_or(DDC::DEFAULT_HALF_BAND_STAGES);
+}
+
+const TDownConverterParams& TDownConverter::getParams() const {
+    return _params;
+}
+
+bool TDownConverter::isExecuted() const {
+    return _isExecuted;
+}
+
+void TDownConverter::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TDownConverter object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    const double samplingFrequency = resolveSamplingFrequency(_params);
+    State        state             = makeState(samplingFrequency);
+
+    std::vector<double> samples(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        samples[i] = points[i].y;
+    }
+    const auto baseband = process(state, samples, samplingFrequency);
+
+    // Output sample m is computed at the input sample m * decimation
+    const std::size_t  decimation = getDecimation();
+    std::vector<Point> inPhasePoints(baseband.size());
+    std::vector<Point> quadraturePoints(baseband.size());
+    for (std::size_t m = 0; m < baseband.size(); ++m) {
+        const double x      = points[m * decimation].x;
+        inPhasePoints[m]    = Point{.x = x, .y = baseband[m].real()};
+        quadraturePoints[m] = Point{.x = x, .y = baseband[m].imag()};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.samplingFrequency =
+        samplingFrequency / static_cast<double>(decimation);
+    slParams.xLabel      = _params.xLabel;
+    slParams.graphLabel  = _params.graphLabel;
+    slParams.pointsCount = baseband.size();
+
+    slParams.yLabel = DDC::DEFAULT_IN_PHASE_Y_LABEL;
+    _inPhase        = std::make_unique<TSignalLine>(
+        slParams, SL::Preference::PreferPointsCount);
+    _inPhase->setPoints(std::move(inPhasePoints));
+
+    slParams.yLabel = DDC::DEFAULT_QUADRATURE_Y_LABEL;
+    _quadrature     = std::make_unique<TSignalLine>(
+        slParams, SL::Preference::PreferPointsCount);
+    _quadrature->setPoints(std::move(quadraturePoints));
+
+    _isExecuted = true;
+}
+
+std::vector<std::complex<double>> TDownConverter::processBlock(
+    const std::span<const double> samples) {
+    const double samplingFrequency = resolveSamplingFrequency(_params);
+    if (!_stream) {
+        _stream = makeState(samplingFrequency);
+    }
+    return process(*_stream, samples, samplingFrequency);
+}
+
+void TDownConverter::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TDownConverter::State TDownConverter::makeState(
+    const double samplingFrequency) const {
+    if (!_params.carrierFrequency) {
+        throw SignalProcessingError("Carrier frequency is not set");
+    }
+    if (std::abs(*_params.carrierFrequency) > samplingFrequency / 2.0) {
+        throw SignalProcessingError(
+            "Carrier frequency should not exceed the Nyquist frequency");
+    }
+
+    const std::size_t cicDecimation =
+        _params.cicDecimation.value_or(DDC::DEFAULT_CIC_DECIMATION);
+    const std::size_t cicOrder =
+        _params.cicOrder.value_or(DDC::DEFAULT_CIC_ORDER);
+    const std::size_t halfBandStages =
+        _params.halfBandStages.value_or(DDC::DEFAULT_HALF_BAND_STAGES);
+    const std::size_t compensatorTaps =
+        _params.compensatorTaps.value_or(DDC::DEFAULT_COMPENSATOR_TAPS);
+    const double passband = _params.passband.value_or(DDC::DEFAULT_PASSBAND);
+    if (!TFFT::isPowerOfTwo(cicDecimation)) {
+        throw SignalProcessingError(
+            "CIC decimation factor should be a power of two");
+    }
+    if (cicOrder == 0) {
+        throw SignalProcessingError("CIC order should be positive");
+    }
+
+    const auto makeStage = [](std::vector<double> taps,
+                              const std::size_t   decimation) {
+        FirStage stage;
+        for (std::size_t t = 0; t < taps.size(); ++t) {
+            if (taps[t] != 0.0) {
+                stage.activeTaps.push_back(t);
+            }
+        }
+        stage.history.assign(taps.size() - 1, {0.0, 0.0});
+        stage.taps       = std::move(taps);
+        stage.decimation = decimation;
+        return stage;
+    };
+
+    State state;
+
+    // CIC stage: (1 - z^-R)^N / (1 - z^-1)^N equals the product of
+    // (1 + z^-(2^i))^N, so it is applied as log2(R) binomial filters, each
+    // decimating by two.
+    std::vector<double> binomial(cicOrder + 1, 0.0);
+    binomial[0] = 1.0;
+    for (std::size_t order = 1; order <= cicOrder; ++order) {
+        for (std::size_t k = order; k > 0; --k) {
+            binomial[k] += binomial[k - 1];
+        }
+    }
+    const double binomialGain = std::ldexp(1.0, static_cast<int>(cicOrder));
+    for (auto& tap : binomial) {
+        tap /= binomialGain;
+    }
+    for (std::size_t rate = 1; rate < cicDecimation; rate <<= 1U) {
+        state.stages.push_back(makeStage(binomial, 2));
+    }
+
+    const auto halfBand = designHalfBand(DDC::HALF_BAND_TAPS);
+    for (std::size_t s = 0; s < halfBandStages; ++s) {
+        state.stages.push_back(makeStage(halfBand, 2));
+    }
+
+    state.stages.push_back(
+        makeStage(TCICFilter::designCompensator(
+                      compensatorTaps, cicOrder, cicDecimation, 1, passband,
+                      std::size_t{1} << halfBandStages),
+                  1));
+    return state;
+}
+
+std::vector<std::complex<double>> TDownConverter::process(
+    State&                        state,
+    const std::span<const double> samples,
+    const double                  samplingFrequency) const {
+    // Mixing with the oscillator; the oscillator is advanced by a complex
+    // rotation and recomputed from the phase periodically. The increment is
+    // reduced to [-pi, pi] once, so a single comparison keeps the phase
+    // wrapped.
+    const double increment = std::remainder(
+        -TWO_PI * *_params.carrierFrequency / samplingFrequency, TWO_PI);
+    const std::complex<double> rotation = {cos(increment), sin(increment)};
+
+    std::vector<std::complex<double>> data(samples.size());
+    std::complex<double>&             oscillator = state.oscillator;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        if ((state.samplesCount + i) % DDC::NCO_RESYNC_INTERVAL == 0) {
+            oscillator = {cos(state.phase), sin(state.phase)};
+        }
+        data[i] = samples[i] * oscillator;
+
+        oscillator = {
+            oscillator.real() * rotation.real() -
+                oscillator.imag() * rotation.imag(),
+            oscillator.real() * rotation.imag() +
+                oscillator.imag() * rotation.real()};
+        state.phase += increment;
+        if (state.phase > M_PI) {
+            state.phase -= TWO_PI;
+        } else if (state.phase < -M_PI) {
+            state.phase += TWO_PI;
+        }
+    }
+    state.samplesCount += samples.size();
+
+    for (auto& stage : state.stages) {
+        filterStage(stage, data);
+    }
+    return data;
+}
+
+void TDownConverter::filterStage(FirStage&                          stage,
+                                 std::vector<std::complex<double>>& data) {
+    const std::size_t historyLength = stage.history.size();
+    const std::size_t decimation    = stage.decimation;
+
+    std::vector<std::complex<double>> buffer(historyLength + data.size());
+    std::copy(stage.history.begin(), stage.history.end(), buffer.begin());
+    std::copy(data.begin(), data.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    // Outputs are taken at the input samples whose index is a multiple of the
+    // decimation factor.
+    const std::size_t firstOffset =
+        (decimation - stage.samplesCount % decimation) % decimation;
+    const std::size_t outputsCount =
+        data.size() > firstOffset
+            ? (data.size() - firstOffset + decimation - 1) / decimation
+            : 0;
+
+    std::vector<std::complex<double>> output(outputsCount);
+    for (std::size_t m = 0; m < outputsCount; ++m) {
+        const std::size_t position =
+            historyLength + firstOffset + m * decimation;
+        double            real     = 0.0;
+        double            imag     = 0.0;
+        for (const std::size_t t : stage.activeTaps) {
+            const std::complex<double>& value = buffer[position - t];
+            real += stage.taps[t] * value.real();
+            imag += stage.taps[t] * value.imag();
+        }
+        output[m] = {real, imag};
+    }
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), stage.history.begin());
+    stage.samplesCount += data.size();
+    data = std::move(output);
+}
\ No newline at end of file
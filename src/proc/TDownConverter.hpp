@@ -0,0 +1,304 @@
+/**
+ * @file TDownConverter.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TDownConverter class shifting a band
+ * around a carrier to baseband and decimating it (digital down-converter).
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace DDC
+ * @brief Contains default parameters used by the digital down-converter.
+ */
+namespace DDC {
+
+    static constexpr std::size_t DEFAULT_CIC_DECIMATION =
+        8;  ///< Default decimation factor of the CIC stage (a power of two).
+    static constexpr std::size_t DEFAULT_CIC_ORDER =
+        4;  ///< Default number of CIC sections.
+    static constexpr std::size_t DEFAULT_HALF_BAND_STAGES =
+        2;  ///< Default number of half-band decimators after the CIC stage.
+    static constexpr std::size_t DEFAULT_COMPENSATOR_TAPS =
+        33;  ///< Default number of taps of the compensation FIR filter (odd).
+    static constexpr double DEFAULT_PASSBAND =
+        0.8;  ///< Default passband edge of the compensator as a fraction of the
+              ///< output Nyquist frequency.
+    static const std::string DEFAULT_IN_PHASE_Y_LABEL =
+        "In-Phase";  ///< Default label for the y-axis of the in-phase line.
+    static const std::string DEFAULT_QUADRATURE_Y_LABEL =
+        "Quadrature";  ///< Default label for the y-axis of the quadrature line.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Down-Conversion";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t NCO_RESYNC_INTERVAL =
+        1024;  ///< Number of samples after which the oscillator is recomputed
+               ///< from its phase to prevent amplitude drift.
+    static constexpr std::size_t HALF_BAND_TAPS =
+        31;  ///< Number of taps of every half-band filter (4k - 1).
+
+}  // namespace DDC
+
+/**
+ * @struct TDownConverterParams
+ * @brief Contains parameters used by the digital down-converter.
+ */
+struct TDownConverterParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the input signal line (not needed for
+                  ///< streaming).
+    std::optional<double> carrierFrequency =
+        std::nullopt;  ///< Frequency shifted to zero, in Hertz (required).
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Input sampling frequency, in Hertz. If not set, the
+                       ///< sampling frequency of the signal line is used.
+
+    // Calculation Parameters
+    std::optional<std::size_t> cicDecimation =
+        DDC::DEFAULT_CIC_DECIMATION;  ///< Decimation factor of the CIC stage.
+    std::optional<std::size_t> cicOrder =
+        DDC::DEFAULT_CIC_ORDER;  ///< Number of CIC sections.
+    std::optional<std::size_t> halfBandStages =
+        DDC::DEFAULT_HALF_BAND_STAGES;  ///< Number of half-band decimators.
+    std::optional<std::size_t> compensatorTaps =
+        DDC::DEFAULT_COMPENSATOR_TAPS;  ///< Number of compensator taps.
+    std::optional<double> passband =
+        DDC::DEFAULT_PASSBAND;  ///< Passband edge of the compensator as a
+                                ///< fraction of the output Nyquist frequency.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> graphLabel =
+        DDC::DEFAULT_GRAPH_LABEL;  ///< Label for the graphs.
+};
+
+/**
+ * @class TDownConverter
+ * @brief Class for shifting a band around a carrier to baseband and decimating
+ * it.
+ *
+ * @details The input is mixed with a numerically controlled oscillator
+ * `exp(-2*pi*i*fc*t)`, so a tone of amplitude `A` at `fc + df` becomes a
+ * complex exponential of amplitude `A / 2` at `df`. The mixed signal is then
+ * decimated by a cascade of stages that run at decreasing rates:
+ *
+ * - a CIC decimator of order `N` and factor `R`, implemented as `log2(R)`
+ *   stages of the binomial filter `(1 + z^-1)^N` decimating by two, which is
+ *   the non-recursive form of the CIC filter and needs no wide accumulators;
+ * - `halfBandStages` half-band FIR decimators, each decimating by two;
+ * - a linear-phase FIR compensator at the output rate (see
+ *   TCICFilter::designCompensator) that flattens the passband droop of the CIC
+ *   stage and suppresses the band above `passband` of the output Nyquist
+ *   frequency.
+ *
+ * The total decimation factor is `R * 2^halfBandStages`. Every stage keeps its
+ * own history, so `processBlock()` can process a stream block by block and
+ * yields exactly the same samples as `execute()` for the concatenated blocks.
+ * The stages are causal, so the outputs are delayed relative to the input.
+ */
+class TDownConverter {
+   public:
+    /**
+     * @brief Constructs a TDownConverter with a signal line and a carrier.
+     *
+     * @param signalLine Pointer to the input signal line.
+     * @param carrierFrequency Frequency shifted to zero, in Hertz.
+     * @param cicDecimation Decimation factor of the CIC stage.
+     * @param halfBandStages Number of half-band decimators.
+     * @param xLabel Label for the x-axis.
+     * @param graphLabel Label for the graphs.
+     */
+    TDownConverter(
+        const TSignalLine*         signalLine,
+        std::optional<double>      carrierFrequency,
+        std::optional<std::size_t> cicDecimation = DDC::DEFAULT_CIC_DECIMATION,
+        std::optional<std::size_t> halfBandStages =
+            DDC::DEFAULT_HALF_BAND_STAGES,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> graphLabel = DDC::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TDownConverter with down-converter parameters.
+     *
+     * @param params Structure containing the parameters of the down-converter.
+     */
+    explicit TDownConverter(TDownConverterParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TDownConverter() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TDownConverter(const TDownConverter& converter);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TDownConverter(TDownConverter&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TDownConverter& operator=(const TDownConverter& converter);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TDownConverter& operator=(TDownConverter&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the in-phase (real) part of the baseband signal.
+     *
+     * @return const TSignalLine* A pointer to the in-phase signal line.
+     *
+     * @throw SignalProcessingError If the down-converter has not been
+     * executed.
+     */
+    [[nodiscard]] const TSignalLine* getInPhaseLine() const;
+
+    /**
+     * @brief Retrieves the quadrature (imaginary) part of the baseband signal.
+     *
+     * @return const TSignalLine* A pointer to the quadrature signal line.
+     *
+     * @throw SignalProcessingError If the down-converter has not been
+     * executed.
+     */
+    [[nodiscard]] const TSignalLine* getQuadratureLine() const;
+
+    /**
+     * @brief Retrieves the total decimation factor.
+     *
+     * @return std::size_t The number of input samples per output sample.
+     */
+    [[nodiscard]] std::size_t getDecimation() const;
+
+    /**
+     * @brief Retrieves the parameters of the down-converter.
+     *
+     * @return const TDownConverterParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TDownConverterParams& getParams() const;
+
+    /**
+     * @brief Determines if the down-converter has been executed.
+     *
+     * @return bool True if the down-converter has been executed, false
+     * otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Down-converts the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, or if the parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<std::complex<double>> Baseband samples completed by
+     * the block.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<std::complex<double>> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct FirStage
+     * @brief Decimating FIR stage of the cascade with its stream state.
+     */
+    struct FirStage {
+        std::vector<double> taps = {};  ///< Filter coefficients.
+        std::vector<std::size_t> activeTaps =
+            {};  ///< Indices of the nonzero coefficients.
+        std::size_t decimation = 1;  ///< Decimation factor of the stage.
+        std::vector<std::complex<double>> history =
+            {};  ///< Last input samples (filter length - 1).
+        std::size_t samplesCount = 0;  ///< Number of processed input samples.
+    };
+
+    /**
+     * @struct State
+     * @brief Stream state of the whole down-converter.
+     */
+    struct State {
+        std::vector<FirStage> stages = {};  ///< Decimation cascade.
+        std::complex<double>  oscillator = {
+            1.0, 0.0};  ///< Oscillator value for the next sample.
+        double      phase        = 0.0;  ///< Oscillator phase, in radians.
+        std::size_t samplesCount = 0;    ///< Number of processed input samples.
+    };
+
+    std::unique_ptr<TSignalLine> _inPhase =
+        nullptr;  ///< A unique pointer to the in-phase signal line.
+    std::unique_ptr<TSignalLine> _quadrature =
+        nullptr;  ///< A unique pointer to the quadrature signal line.
+    TDownConverterParams _params = {};  ///< Parameters of the down-converter.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the down-converter has
+                               ///< been executed.
+
+    /**
+     * @brief Validates the parameters and designs a fresh stream state.
+     *
+     * @param samplingFrequency Input sampling frequency, in Hertz.
+     * @return State The initial stream state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState(double samplingFrequency) const;
+
+    /**
+     * @brief Mixes and decimates a block of samples.
+     *
+     * @param state Stream state to advance.
+     * @param samples Input samples.
+     * @param samplingFrequency Input sampling frequency, in Hertz.
+     * @return std::vector<std::complex<double>> Baseband output samples.
+     */
+    [[nodiscard]] std::vector<std::complex<double>> process(
+        State&                  state,
+        std::span<const double> samples,
+        double                  samplingFrequency) const;
+
+    /**
+     * @brief Filters and decimates a block of samples by one stage.
+     *
+     * @param stage Stage to advance.
+     * @param data Input samples, replaced by the output samples.
+     */
+    static void filterStage(FirStage&                          stage,
+                            std::vector<std::complex<double>>& data);
+};
\ No newline at end of file
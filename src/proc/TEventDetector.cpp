@@ -0,0 +1,202 @@
+/**
+ * @file TEventDetector.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TEventDetector class finding
+ * threshold crossings with hysteresis.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TEventDetector.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Finds the first sample at or above, or strictly below, a
+     * threshold.
+     * @details The falling test is strict so that a signal resting exactly at
+     * equal thresholds does not toggle on every sample.
+     *
+     * @tparam Above True to search a sample at or above the threshold, false
+     * to search one strictly below it.
+     * @param samples The samples.
+     * @param begin Index to start from.
+     * @param threshold The threshold.
+     * @return std::size_t Index of the sample, or `samples.size()` if none.
+     */
+    template <bool Above>
+    std::size_t findCrossing(const std::span<const double> samples,
+                             std::size_t                   begin,
+                             const double                  threshold) {
+        const std::size_t count = samples.size();
+        const double*     data  = samples.data();
+
+        // Whole blocks are skipped with a branch-free comparison
+        while (begin + EVT::SAMPLES_PER_SCAN <= count) {
+            unsigned hits = 0;
+            for (std::size_t i = 0; i < EVT::SAMPLES_PER_SCAN; ++i) {
+                const double value = data[begin + i];
+                hits |= static_cast<unsigned>(Above ? value >= threshold
+                                                    : value < threshold);
+            }
+            if (hits != 0) {
+                break;
+            }
+            begin += EVT::SAMPLES_PER_SCAN;
+        }
+        for (; begin < count; ++begin) {
+            if (Above ? data[begin] >= threshold : data[begin] < threshold) {
+                return begin;
+            }
+        }
+        return count;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TEventDetector::TEventDetector(const TSignalLine*             signalLine,
+                               const std::optional<double>    upperThreshold,
+                               const std::optional<double>    lowerThreshold,
+                               const std::optional<EVT::Edge> edge)
+    : _params{.signalLine     = signalLine,
+              .upperThreshold = upperThreshold,
+              .lowerThreshold = lowerThreshold,
+              .edge           = edge} {}
+
+TEventDetector::TEventDetector(TEventDetectorParams params)
+    : _params(std::move(params)) {}
+
+const std::vector<TEvent>& TEventDetector::getEvents() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Event detector not executed");
+    }
+    return _events;
+}
+
+const TEventDetectorParams& TEventDetector::getParams() const {
+    return _params;
+}
+
+bool TEventDetector::isExecuted() const {
+    return _isExecuted;
+}
+
+void TEventDetector::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TEventDetector object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    std::vector<double> values(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        values[i] = points[i].y;
+    }
+
+    State               state;
+    std::vector<TEvent> events;
+    detect(values, state, events);
+
+    // Crossing times in samples are mapped onto the x coordinates
+    for (auto& event : events) {
+        const double fraction =
+            event.time - static_cast<double>(event.index - 1);
+        const double start = points[event.index - 1].x;
+        event.time = start + fraction * (points[event.index].x - start);
+    }
+    _events     = std::move(events);
+    _isExecuted = true;
+}
+
+std::vector<TEvent> TEventDetector::processBlock(
+    const std::span<const double> samples) {
+    if (!_stream) {
+        _stream = State{};
+    }
+    std::vector<TEvent> events;
+    detect(samples, *_stream, events);
+    if (_params.samplingFrequency) {
+        for (auto& event : events) {
+            event.time /= *_params.samplingFrequency;
+        }
+    }
+    return events;
+}
+
+void TEventDetector::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TEventDetector::detect(const std::span<const double> samples,
+                            State&                        state,
+                            std::vector<TEvent>&          events) const {
+    if (!_params.upperThreshold) {
+        throw SignalProcessingError("Upper threshold is not specified");
+    }
+    const double upper = *_params.upperThreshold;
+    const double lower = _params.lowerThreshold.value_or(upper);
+    if (lower > upper) {
+        throw SignalProcessingError(
+            "Lower threshold should not exceed the upper threshold");
+    }
+    if (samples.empty()) {
+        return;
+    }
+    const EVT::Edge edge = _params.edge.value_or(EVT::DEFAULT_EDGE);
+
+    std::size_t i = 0;
+    if (state.position == 0) {
+        state.high = samples[0] >= upper;
+        i          = 1;
+    }
+    while (i < samples.size()) {
+        const double threshold = state.high ? lower : upper;
+        i = state.high ? findCrossing<false>(samples, i, threshold)
+                       : findCrossing<true>(samples, i, threshold);
+        if (i == samples.size()) {
+            break;
+        }
+
+        state.high = !state.high;
+        const EVT::Edge direction =
+            state.high ? EVT::Edge::Rising : EVT::Edge::Falling;
+        if (edge == EVT::Edge::Both || edge == direction) {
+            const double previous = i > 0 ? samples[i - 1] : state.previous;
+            const double current  = samples[i];
+            const double fraction =
+                current == previous ? 1.0
+                                    : (threshold - previous) /
+                                          (current - previous);
+            const std::size_t index = state.position + i;
+            events.push_back(
+                {.index = index,
+                 .time  = static_cast<double>(index - 1) + fraction,
+                 .edge  = direction});
+        }
+        ++i;
+    }
+    state.previous = samples.back();
+    state.position += samples.size();
+}
\ No newline at end of file
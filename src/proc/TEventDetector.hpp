@@ -0,0 +1,227 @@
+/**
+ * @file TEventDetector.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TEventDetector class finding
+ * threshold crossings with hysteresis.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * @namespace EVT
+ * @brief Contains edge types and default parameters used for event detection.
+ */
+namespace EVT {
+
+    /**
+     * @enum Edge
+     * @brief Specifies which threshold crossings are reported.
+     */
+    enum class Edge : std::uint8_t {
+        Rising,   ///< Crossings of the upper threshold upwards.
+        Falling,  ///< Crossings of the lower threshold downwards.
+        Both      ///< Crossings in both directions.
+    };
+
+    static constexpr auto DEFAULT_EDGE = Edge::Rising;  ///< Default edge.
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_SCAN =
+        64;  ///< Number of samples tested at once while searching a crossing.
+
+}  // namespace EVT
+
+/**
+ * @struct TEvent
+ * @brief Contains a detected threshold crossing.
+ */
+struct TEvent {
+    std::size_t index = 0;  ///< Index of the first sample beyond the threshold
+                            ///< (counted from the start of the stream).
+    double time = 0.0;  ///< Time of the crossing, linearly interpolated
+                        ///< between the samples around it.
+    EVT::Edge edge = EVT::Edge::Rising;  ///< Direction of the crossing.
+};
+
+/**
+ * @struct TEventDetectorParams
+ * @brief Contains parameters used for event detection.
+ */
+struct TEventDetectorParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to scan (not needed for
+                  ///< streaming).
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Sampling frequency of streams, used for their
+                       ///< timestamps. If not set, stream timestamps are in
+                       ///< samples.
+
+    // Calculation Parameters
+    std::optional<double> upperThreshold =
+        std::nullopt;  ///< Threshold of rising crossings (required).
+    std::optional<double> lowerThreshold =
+        std::nullopt;  ///< Threshold of falling crossings (not above the upper
+                       ///< one). If not set, it equals the upper threshold
+                       ///< (no hysteresis).
+    std::optional<EVT::Edge> edge =
+        EVT::DEFAULT_EDGE;  ///< Crossings to report.
+};
+
+/**
+ * @class TEventDetector
+ * @brief Class for finding the times at which a signal crosses a threshold.
+ *
+ * @details The detector is a Schmitt trigger: in the low state it waits for a
+ * sample at or above the upper threshold (a rising crossing), in the high state
+ * for a sample strictly below the lower threshold (a falling crossing). Noise
+ * between the thresholds therefore does not produce extra events, and a
+ * signal resting exactly at equal thresholds stays high. The state
+ * starts high if the first sample is at or above the upper threshold, and low
+ * otherwise.
+ *
+ * Events are sparse, so the search tests `EVT::SAMPLES_PER_SCAN` samples at
+ * once with a branch-free, vectorized comparison and only looks at single
+ * samples in the block holding the crossing.
+ *
+ * `processBlock()` processes a stream block by block; the state and the last
+ * sample are carried over, so the events equal those of `execute()` for the
+ * concatenated blocks.
+ */
+class TEventDetector {
+   public:
+    /**
+     * @brief Constructs a TEventDetector with a signal line and thresholds.
+     *
+     * @param signalLine Pointer to the signal line to scan.
+     * @param upperThreshold Threshold of rising crossings.
+     * @param lowerThreshold Threshold of falling crossings.
+     * @param edge Crossings to report.
+     */
+    TEventDetector(const TSignalLine*       signalLine,
+                   std::optional<double>    upperThreshold,
+                   std::optional<double>    lowerThreshold = std::nullopt,
+                   std::optional<EVT::Edge> edge           = EVT::DEFAULT_EDGE);
+
+    /**
+     * @brief Constructs a TEventDetector with detection parameters.
+     *
+     * @param params Structure containing the parameters of the detector.
+     */
+    explicit TEventDetector(TEventDetectorParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TEventDetector() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TEventDetector(const TEventDetector&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TEventDetector(TEventDetector&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TEventDetector& operator=(const TEventDetector&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TEventDetector& operator=(TEventDetector&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the events of the signal line.
+     *
+     * @return const std::vector<TEvent>& The events in order; their times are
+     * x coordinates of the line.
+     *
+     * @throw SignalProcessingError If the detector has not been executed.
+     */
+    [[nodiscard]] const std::vector<TEvent>& getEvents() const;
+
+    /**
+     * @brief Retrieves the parameters of the detector.
+     *
+     * @return const TEventDetectorParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TEventDetectorParams& getParams() const;
+
+    /**
+     * @brief Determines if the detector has been executed.
+     *
+     * @return bool True if the detector has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Scans the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, or if the thresholds are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next samples.
+     * @return std::vector<TEvent> The events within the block.
+     *
+     * @throws SignalProcessingError If the thresholds are invalid.
+     */
+    [[nodiscard]] std::vector<TEvent> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Trigger state carried between blocks.
+     */
+    struct State {
+        bool        high     = false;  ///< Whether the trigger is high.
+        double      previous = 0.0;    ///< Last sample.
+        std::size_t position = 0;  ///< Number of samples processed so far.
+    };
+
+    std::vector<TEvent>  _events = {};  ///< Events of the signal line.
+    TEventDetectorParams _params = {};  ///< Parameters of the detector.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the detector has been
+                               ///< executed.
+
+    /**
+     * @brief Scans a run of samples.
+     *
+     * @param samples The samples.
+     * @param state State to continue from (the first sample initializes it if
+     * no sample has been processed); updated in place.
+     * @param events Receives the events, with their times in samples.
+     */
+    void detect(std::span<const double> samples,
+                State&                  state,
+                std::vector<TEvent>&    events) const;
+};
\ No newline at end of file
@@ -0,0 +1,303 @@
+/**
+ * @file TFractionalDelay.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TFractionalDelay class delaying a
+ * signal by an arbitrary number of samples on its own grid.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TFractionalDelay.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Expands the Lagrange basis polynomials into powers of the
+     * fraction (Farrow branch coefficients).
+     * @details Tap `k` holds the sample delayed by `I + k`; the basis
+     * polynomial of tap `k` is evaluated at `(order - 1) / 2 + mu`.
+     *
+     * @param order Order of the interpolator.
+     * @return std::vector<double> Coefficient of `mu^m` for tap `k` at index
+     * `m * (order + 1) + k`.
+     */
+    std::vector<double> designBranches(const std::size_t order) {
+        const std::size_t   taps   = order + 1;
+        const double        center = (static_cast<double>(order) - 1.0) / 2.0;
+        std::vector<double> branches(taps * taps, 0.0);
+
+        for (std::size_t k = 0; k < taps; ++k) {
+            std::vector<double> polynomial = {1.0};
+            for (std::size_t j = 0; j < taps; ++j) {
+                if (j == k) {
+                    continue;
+                }
+                // Multiply by (mu + center - j) / (k - j)
+                const double shift = center - static_cast<double>(j);
+                const double divisor =
+                    static_cast<double>(k) - static_cast<double>(j);
+                std::vector<double> product(polynomial.size() + 1, 0.0);
+                for (std::size_t m = 0; m < polynomial.size(); ++m) {
+                    product[m + 1] += polynomial[m] / divisor;
+                    product[m] += polynomial[m] * shift / divisor;
+                }
+                polynomial = std::move(product);
+            }
+            for (std::size_t m = 0; m < taps; ++m) {
+                branches[m * taps + k] = polynomial[m];
+            }
+        }
+        return branches;
+    }
+
+    /**
+     * @brief Retrieves the interpolator order of the parameters.
+     *
+     * @param params Parameters of the delay.
+     * @return std::size_t The order.
+     *
+     * @throws SignalProcessingError If the order is zero.
+     */
+    std::size_t resolveOrder(const TFractionalDelayParams& params) {
+        const std::size_t order = params.order.value_or(FDEL::DEFAULT_ORDER);
+        if (order == 0) {
+            throw SignalProcessingError(
+                "Interpolator order should be positive");
+        }
+        return order;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TFractionalDelay::TFractionalDelay(const TSignalLine*               signalLine,
+                                   const std::optional<double>      delay,
+                                   const std::optional<std::size_t> order,
+                                   std::optional<std::string>       xLabel,
+                                   std::optional<std::string>       yLabel,
+                                   std::optional<std::string>       graphLabel)
+    : _params{.signalLine = signalLine,
+              .delay      = delay,
+              .order      = order,
+              .xLabel     = std::move(xLabel),
+              .yLabel     = std::move(yLabel),
+              .graphLabel = std::move(graphLabel)} {}
+
+TFractionalDelay::TFractionalDelay(TFractionalDelayParams params)
+    : _params(std::move(params)) {}
+
+TFractionalDelay::TFractionalDelay(const TFractionalDelay& delay)
+    : _sl(delay._sl ? std::make_unique<TSignalLine>(*delay._sl) : nullptr),
+      _params(delay._params),
+      _stream(delay._stream),
+      _isExecuted(delay._isExecuted) {}
+
+TFractionalDelay& TFractionalDelay::operator=(const TFractionalDelay& delay) {
+    if (this == &delay) {
+        return *this;
+    }
+    _sl = delay._sl ? std::make_unique<TSignalLine>(*delay._sl) : nullptr;
+    _params     = delay._params;
+    _stream     = delay._stream;
+    _isExecuted = delay._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TFractionalDelay::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Fractional delay not executed");
+    }
+    return _sl.get();
+}
+
+const TFractionalDelayParams& TFractionalDelay::getParams() const {
+    return _params;
+}
+
+bool TFractionalDelay::isExecuted() const {
+    return _isExecuted;
+}
+
+void TFractionalDelay::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TFractionalDelay object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    // The delay is counted in samples, so the line should be sampled
+    // uniformly at its sampling frequency
+    const auto samplingFrequency =
+        _params.signalLine->getParams().samplingFrequency;
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Signal line should have a positive sampling frequency");
+    }
+    if (std::abs(points.back().x - points.front().x -
+                 static_cast<double>(pointsCount - 1) / *samplingFrequency) >
+        SL::DEFAULT_INACCURACY) {
+        throw SignalProcessingError(
+            "Signal line should be sampled uniformly at its sampling "
+            "frequency");
+    }
+
+    // Only the branches are needed: the streaming history and its maximal
+    // delay do not apply to a whole line
+    const std::size_t order    = resolveOrder(_params);
+    const auto        branches = designBranches(order);
+    const std::size_t taps     = order + 1;
+    const double      center   = (static_cast<double>(order) - 1.0) / 2.0;
+    const double      delay    = _params.delay.value_or(FDEL::DEFAULT_DELAY);
+    const double      shift    = floor(delay - center);
+    const double      fraction = delay - center - shift;
+
+    // For a constant delay the Farrow branches collapse into one FIR filter
+    std::vector<double> filter(taps, 0.0);
+    for (std::size_t k = 0; k < taps; ++k) {
+        double power = 1.0;
+        for (std::size_t m = 0; m < taps; ++m) {
+            filter[k] += branches[m * taps + k] * power;
+            power *= fraction;
+        }
+    }
+
+    std::vector<double> input(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        input[i] = points[i].y;
+    }
+
+    // Tap k reads x[n - shift - k]; each tap is applied to the whole valid
+    // range at once, so the inner loop is a plain vectorizable axpy.
+    const auto          count  = static_cast<long long>(pointsCount);
+    std::vector<double> output(pointsCount, 0.0);
+    for (std::size_t k = 0; k < taps; ++k) {
+        const long long offset =
+            static_cast<long long>(shift) + static_cast<long long>(k);
+        const long long first = std::max(0LL, offset);
+        const long long last  = std::min(count, count + offset);
+        const double    tap   = filter[k];
+        for (long long n = first; n < last; ++n) {
+            output[static_cast<std::size_t>(n)] +=
+                tap * input[static_cast<std::size_t>(n - offset)];
+        }
+    }
+
+    std::vector<Point> outputPoints(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        outputPoints[i] = Point{.x = points[i].x, .y = output[i]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    slParams.pointsCount       = pointsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+std::vector<double> TFractionalDelay::processBlock(
+    const std::span<const double> samples) {
+    const std::vector<double> delays(
+        samples.size(), _params.delay.value_or(FDEL::DEFAULT_DELAY));
+    return processBlock(samples, delays);
+}
+
+std::vector<double> TFractionalDelay::processBlock(
+    const std::span<const double> samples,
+    const std::span<const double> delays) {
+    if (samples.size() != delays.size()) {
+        throw SignalProcessingError(
+            "Samples and delays should have the same size");
+    }
+    if (!_stream) {
+        _stream = makeState();
+    }
+    State& state = *_stream;
+
+    const std::size_t order    = _params.order.value_or(FDEL::DEFAULT_ORDER);
+    const std::size_t taps     = order + 1;
+    const double      center   = (static_cast<double>(order) - 1.0) / 2.0;
+    const auto        maxDelay = static_cast<double>(
+        _params.maxDelay.value_or(FDEL::DEFAULT_MAX_DELAY));
+    for (const double delay : delays) {
+        if (delay < center || delay > maxDelay) {
+            throw SignalProcessingError("Delay is out of the streaming range");
+        }
+    }
+
+    const std::size_t   historyLength = state.history.size();
+    std::vector<double> buffer(historyLength + samples.size());
+    std::copy(state.history.begin(), state.history.end(), buffer.begin());
+    std::copy(samples.begin(), samples.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    std::vector<double> output(samples.size());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        const double shift    = floor(delays[i] - center);
+        const double fraction = delays[i] - center - shift;
+        // Newest tap first: tap k holds x[n - shift - k]
+        const double* newest = buffer.data() + historyLength + i -
+                               static_cast<std::size_t>(shift);
+
+        // Horner's scheme over the branch outputs
+        double value = 0.0;
+        for (std::size_t m = taps; m-- > 0;) {
+            const double* branch = state.branches.data() + m * taps;
+            double        sum    = 0.0;
+            for (std::size_t k = 0; k < taps; ++k) {
+                sum += branch[k] * *(newest - k);
+            }
+            value = value * fraction + sum;
+        }
+        output[i] = value;
+    }
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), state.history.begin());
+    return output;
+}
+
+void TFractionalDelay::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TFractionalDelay::State TFractionalDelay::makeState() const {
+    const std::size_t order = resolveOrder(_params);
+    const std::size_t maxDelay =
+        _params.maxDelay.value_or(FDEL::DEFAULT_MAX_DELAY);
+    if (2 * maxDelay + 1 < order) {
+        throw SignalProcessingError(
+            "Maximal delay should not be less than (order - 1) / 2");
+    }
+
+    return State{.branches = designBranches(order),
+                 .history  = std::vector<double>(maxDelay + order, 0.0)};
+}
\ No newline at end of file
@@ -0,0 +1,238 @@
+/**
+ * @file TFractionalDelay.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TFractionalDelay class delaying a
+ * signal by an arbitrary number of samples on its own grid.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace FDEL
+ * @brief Contains default parameters used for fractional delays.
+ */
+namespace FDEL {
+
+    static constexpr double DEFAULT_DELAY =
+        0.0;  ///< Default delay, in samples.
+    static constexpr std::size_t DEFAULT_ORDER =
+        3;  ///< Default order of the Lagrange interpolator (cubic).
+    static constexpr std::size_t DEFAULT_MAX_DELAY =
+        64;  ///< Default largest streaming delay, in samples.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Delayed Signal";  ///< Default graph label.
+
+}  // namespace FDEL
+
+/**
+ * @struct TFractionalDelayParams
+ * @brief Contains parameters used for fractional delays.
+ */
+struct TFractionalDelayParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to delay (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<double> delay =
+        FDEL::DEFAULT_DELAY;  ///< Delay, in samples (may be fractional or, for
+                              ///< whole lines, negative).
+    std::optional<std::size_t> order =
+        FDEL::DEFAULT_ORDER;  ///< Order of the Lagrange interpolator (number
+                              ///< of taps - 1).
+    std::optional<std::size_t> maxDelay =
+        FDEL::DEFAULT_MAX_DELAY;  ///< Largest streaming delay, in samples
+                                  ///< (sets the history length).
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        FDEL::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TFractionalDelay
+ * @brief Class for delaying a signal by an arbitrary number of samples while
+ * keeping its x coordinates.
+ *
+ * @details Unlike the shifting constructor of TSignalLine, which moves the x
+ * coordinates, the delayed samples are interpolated back onto the original
+ * grid, so the result can be combined with the input by TMultiplier or
+ * TSummator. The interpolator is a Lagrange polynomial of order `P` over
+ * `P + 1` neighbouring samples, implemented as a Farrow structure:
+ *
+ *   `y[n] = sum_m mu^m * sum_k C[m][k] * x[n - I - k]`,
+ *
+ * where the delay is split into the integer part `I` and the fraction
+ * `mu = delay - (P - 1) / 2 - I` within [0, 1), which keeps the interpolation
+ * point in the middle of the taps. The branch coefficients `C` do not depend
+ * on the delay, so the delay can change at every sample.
+ *
+ * For a whole line the delay is constant, so the branches are folded into a
+ * single FIR filter which runs over contiguous arrays and is vectorized by the
+ * compiler; samples outside the line are taken as zero. In streaming mode the
+ * delay can be given per sample and should stay within
+ * `[(P - 1) / 2, maxDelay]`; the stream then yields the same samples as
+ * `execute()` for the same constant delay.
+ */
+class TFractionalDelay {
+   public:
+    /**
+     * @brief Constructs a TFractionalDelay with a signal line and a delay.
+     *
+     * @param signalLine Pointer to the signal line to delay.
+     * @param delay Delay, in samples.
+     * @param order Order of the Lagrange interpolator.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TFractionalDelay(
+        const TSignalLine*         signalLine,
+        std::optional<double>      delay      = FDEL::DEFAULT_DELAY,
+        std::optional<std::size_t> order      = FDEL::DEFAULT_ORDER,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = FDEL::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TFractionalDelay with delay parameters.
+     *
+     * @param params Structure containing the parameters of the delay.
+     */
+    explicit TFractionalDelay(TFractionalDelayParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TFractionalDelay() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TFractionalDelay(const TFractionalDelay& delay);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TFractionalDelay(TFractionalDelay&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TFractionalDelay& operator=(const TFractionalDelay& delay);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TFractionalDelay& operator=(TFractionalDelay&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the delayed signal line.
+     *
+     * @return const TSignalLine* A pointer to the delayed signal line.
+     *
+     * @throw SignalProcessingError If the delay has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the delay.
+     *
+     * @return const TFractionalDelayParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TFractionalDelayParams& getParams() const;
+
+    /**
+     * @brief Determines if the delay has been executed.
+     *
+     * @return bool True if the delay has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Delays the whole signal line by the constant delay.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null, has no
+     * points or is not sampled uniformly at a positive sampling frequency, or
+     * if the order is zero.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream with the constant delay.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<double> Delayed samples (one per input sample).
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Processes the next block of a stream with a time-varying delay.
+     *
+     * @param samples Next input samples.
+     * @param delays Delay of every sample, in samples.
+     * @return std::vector<double> Delayed samples (one per input sample).
+     *
+     * @throws SignalProcessingError If the spans have different sizes, if a
+     * delay is out of the streaming range, or if the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples,
+        std::span<const double> delays);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Stream state of the delay.
+     */
+    struct State {
+        std::vector<double> branches =
+            {};  ///< Farrow branch coefficients, (order + 1)^2 values stored
+                 ///< by powers of the fraction.
+        std::vector<double> history =
+            {};  ///< Last input samples (maxDelay + order values).
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the delayed signal line.
+    TFractionalDelayParams _params = {};  ///< Parameters of the delay.
+    std::optional<State>   _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the delay has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh stream state.
+     *
+     * @return State The initial stream state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState() const;
+};
\ No newline at end of file
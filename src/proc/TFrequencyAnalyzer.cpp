@@ -1,150 +1,243 @@
-/**
- * @file TFrequencyAnalyzer.hpp
- * @author Vorontsov Ilya Aleksandrovich (ilvoron)
- * @brief Contains the implementation of the TFrequencyAnalyzer class used for
- * converting signals from the time domain to the frequency domain.
+/**
+ * @file TFrequencyAnalyzer.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TFrequencyAnalyzer class used for
+ * converting signals from the time domain to the frequency domain.
  * @version 2.1.0.0
  * @date October 12, 2024
- * @copyright Copyright (c) 2024
- */
-
-#include "TFrequencyAnalyzer.hpp"
-#include "TCore.hpp"
-#include "TCorrelator.hpp"
-#include "TGenerator.hpp"
-#include "TSignalLine.hpp"
-
-#include <cmath>
-#include <cstddef>
-#include <memory>
-#include <optional>
-#include <string>
-#include <utility>
-
-/*
- * PUBLIC METHODS
- */
-
-TFrequencyAnalyzer::TFrequencyAnalyzer(const TSignalLine*  signalLine,
-                                       const double        fromFrequency,
-                                       const double        toFrequency,
-                                       const double        stepFrequency,
-                                       const std::optional<bool> useAbsoluteValue,
-                                       std::optional<std::string> xLabel,
-                                       std::optional<std::string> yLabel,
-                                       std::optional<std::string> graphLabel)
-    : _params{.signalLine       = signalLine,
-              .fromFrequency    = fromFrequency,
-              .toFrequency      = toFrequency,
-              .stepFrequency    = stepFrequency,
-              .useAbsoluteValue = useAbsoluteValue,
-              .xLabel           = std::move(xLabel),
-              .yLabel           = std::move(yLabel),
-              .graphLabel       = std::move(graphLabel)} {
-    if (_params.fromFrequency >= _params.toFrequency) {
-        throw SignalProcessingError("Invalid frequency range");
-    }
-}
-
-TFrequencyAnalyzer::TFrequencyAnalyzer(TFrequencyAnalyzerParams params)
-    : _params(std::move(params)) {
-    if (_params.fromFrequency >= _params.toFrequency) {
-        throw SignalProcessingError("Invalid frequency range");
-    }
-}
-
-TFrequencyAnalyzer::TFrequencyAnalyzer(const TFrequencyAnalyzer& analyzer)
-    : _sl(analyzer._sl ? std::make_unique<TSignalLine>(*analyzer._sl)
-                       : nullptr),
-      _params(analyzer._params),
-      _isExecuted(analyzer._isExecuted) {}
-
-TFrequencyAnalyzer& TFrequencyAnalyzer::operator=(
-    const TFrequencyAnalyzer& analyzer) {
-    if (this == &analyzer) {
-        return *this;
-    }
-    _sl = analyzer._sl ? std::make_unique<TSignalLine>(*analyzer._sl) : nullptr;
-    _params     = analyzer._params;
-    _isExecuted = analyzer._isExecuted;
-    return *this;
-}
-
-const TSignalLine* TFrequencyAnalyzer::getSignalLine() const {
-    if (!_isExecuted) {
-        throw SignalProcessingError("Fourier transform not executed");
-    }
-    return _sl.get();
-}
-
-const TFrequencyAnalyzerParams& TFrequencyAnalyzer::getParams() const {
-    return _params;
-}
-
-bool TFrequencyAnalyzer::isExecuted() const {
-    return _isExecuted;
-}
-
-void TFrequencyAnalyzer::execute() {
-    // We're ensuring that the signal line is not null here because the signal
-    // line may be set after the TFrequencyAnalyzer object creation.
-    if (_params.signalLine == nullptr) {
-        throw SignalProcessingError("Invalid signal line (nullptr)");
-    }
-    if (!_params.signalLine->getParams().duration) {
-        throw SignalProcessingError(
-            "Signal line does not have duration information");
-    }
-
-    // Initialize frequency and time-related parameters
-    const double fromFrequency = _params.fromFrequency;
-    const double toFrequency   = _params.toFrequency;
-    const double stepFrequency = _params.stepFrequency;
-    const double duration = _params.signalLine->getParams().duration.value();
-    const double samplingFreq =
-        _params.signalLine->getParams().samplingFrequency.value();
-
-    // Configure signal line parameters for the output frequency domain signal
-    TSignalLineParams slParams = _params.signalLine->getParams();
-    slParams.xLabel            = _params.xLabel;
-    slParams.yLabel            = _params.yLabel;
-    slParams.graphLabel        = _params.graphLabel;
-    _sl                        = std::make_unique<TSignalLine>(
-        ceil((toFrequency - fromFrequency) / stepFrequency));
-
-    // Remove DC component from the signal
-    auto DCRemovedSignal = TSignalLine(_params.signalLine);
-    DCRemovedSignal.removeDCComponent();
-
-    // Iterate through each frequency step and generate corresponding signal
-    // data
-    for (std::size_t i = 0; i < _sl->getParams().pointsCount; ++i) {
-        // Set up generator parameters for a specific frequency
-        TGeneratorParams genParams;
-        genParams.duration = duration;
-        genParams.oscillationFreq =
-            fromFrequency + static_cast<double>(i) * stepFrequency;
-        genParams.initPhase    = 0;
-        genParams.offsetY      = 0;
-        genParams.amplitude    = 1;
-        genParams.samplingFreq = samplingFreq;
-
-        // Create a generator and execute it to produce a signal for this
-        // frequency
-        TGenerator gen(genParams);
-        gen.execute();
-
-        // Correlate the generated signal with the original signal to compute
-        // the correlation value
-        TCorrelator corr(&DCRemovedSignal, gen.getSignalLine());
-        corr.execute();
-
-        _sl->setPoint(
-            i, fromFrequency + static_cast<double>(i) * stepFrequency,
-            _params.useAbsoluteValue.value_or(FA::DEFAULT_USE_ABSOLUTE_VALUE)
-                ? std::abs(corr.getCorrelationValue())
-                : corr.getCorrelationValue());
-    }
-
-    _isExecuted = true;
+ * @copyright Copyright (c) 2024
+ */
+
+#include "TFrequencyAnalyzer.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Correlates the signal with a block of sine reference waves in a
+     * single pass over the samples.
+     * @details Each bin keeps its own oscillator (cosine and sine of the
+     * current phase) which is advanced by a complex rotation per sample. The
+     * oscillators of the whole block are laid out as contiguous arrays, so the
+     * per-sample update is vectorized across bins by the compiler. To avoid
+     * drift of the rotation recurrence, the oscillators are resynchronized
+     * with exact values every `FA::OSCILLATOR_RESYNC_INTERVAL` samples.
+     *
+     * @param weightedSignal Signal samples premultiplied by the integration
+     * weights.
+     * @param signalEnergy Weighted energy of the signal.
+     * @param samplingFreq Sampling frequency of the signal.
+     * @param frequencies Frequencies of the bins in the block.
+     * @param correlations Output normalized correlation values of the bins.
+     */
+    void correlateBlock(
+        const std::vector<double>&                    weightedSignal,
+        const double                                  signalEnergy,
+        const double                                  samplingFreq,
+        const std::array<double, FA::BINS_PER_BLOCK>& frequencies,
+        std::array<double, FA::BINS_PER_BLOCK>&       correlations) {
+        constexpr std::size_t width       = FA::BINS_PER_BLOCK;
+        const std::size_t     pointsCount = weightedSignal.size();
+
+        alignas(64) std::array<double, width> phaseStep{};
+        alignas(64) std::array<double, width> stepCos{};
+        alignas(64) std::array<double, width> stepSin{};
+        alignas(64) std::array<double, width> oscCos{};
+        alignas(64) std::array<double, width> oscSin{};
+        alignas(64) std::array<double, width> products{};
+        alignas(64) std::array<double, width> energies{};
+        for (std::size_t k = 0; k < width; ++k) {
+            phaseStep[k] = TWO_PI * frequencies[k] / samplingFreq;
+            stepCos[k]   = cos(phaseStep[k]);
+            stepSin[k]   = sin(phaseStep[k]);
+        }
+
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            if (i % FA::OSCILLATOR_RESYNC_INTERVAL == 0) {
+                for (std::size_t k = 0; k < width; ++k) {
+                    oscCos[k] = cos(phaseStep[k] * static_cast<double>(i));
+                    oscSin[k] = sin(phaseStep[k] * static_cast<double>(i));
+                }
+            }
+
+            const double sample = weightedSignal[i];
+            for (std::size_t k = 0; k < width; ++k) {
+                products[k] += sample * oscSin[k];
+                energies[k] += oscSin[k] * oscSin[k];
+
+                const double nextCos = oscCos[k] * stepCos[k] -
+                                       oscSin[k] * stepSin[k];
+                oscSin[k] = oscSin[k] * stepCos[k] + oscCos[k] * stepSin[k];
+                oscCos[k] = nextCos;
+            }
+        }
+
+        // The reference waves are sampled uniformly, so their trapezoidal
+        // energy is the plain sum with the edge samples counted half.
+        const double lastPhase = static_cast<double>(pointsCount - 1);
+        for (std::size_t k = 0; k < width; ++k) {
+            const double lastSin = sin(phaseStep[k] * lastPhase);
+            const double referenceEnergy =
+                (energies[k] - lastSin * lastSin / 2.0) / samplingFreq;
+            correlations[k] =
+                products[k] / sqrt(signalEnergy * referenceEnergy);
+        }
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TFrequencyAnalyzer::TFrequencyAnalyzer(const TSignalLine*  signalLine,
+                                       const double        fromFrequency,
+                                       const double        toFrequency,
+                                       const double        stepFrequency,
+                                       const std::optional<bool> useAbsoluteValue,
+                                       std::optional<std::string> xLabel,
+                                       std::optional<std::string> yLabel,
+                                       std::optional<std::string> graphLabel)
+    : _params{.signalLine       = signalLine,
+              .fromFrequency    = fromFrequency,
+              .toFrequency      = toFrequency,
+              .stepFrequency    = stepFrequency,
+              .useAbsoluteValue = useAbsoluteValue,
+              .xLabel           = std::move(xLabel),
+              .yLabel           = std::move(yLabel),
+              .graphLabel       = std::move(graphLabel)} {
+    if (_params.fromFrequency >= _params.toFrequency) {
+        throw SignalProcessingError("Invalid frequency range");
+    }
+}
+
+TFrequencyAnalyzer::TFrequencyAnalyzer(TFrequencyAnalyzerParams params)
+    : _params(std::move(params)) {
+    if (_params.fromFrequency >= _params.toFrequency) {
+        throw SignalProcessingError("Invalid frequency range");
+    }
+}
+
+TFrequencyAnalyzer::TFrequencyAnalyzer(const TFrequencyAnalyzer& analyzer)
+    : _sl(analyzer._sl ? std::make_unique<TSignalLine>(*analyzer._sl)
+                       : nullptr),
+      _params(analyzer._params),
+      _isExecuted(analyzer._isExecuted) {}
+
+TFrequencyAnalyzer& TFrequencyAnalyzer::operator=(
+    const TFrequencyAnalyzer& analyzer) {
+    if (this == &analyzer) {
+        return *this;
+    }
+    _sl = analyzer._sl ? std::make_unique<TSignalLine>(*analyzer._sl) : nullptr;
+    _params     = analyzer._params;
+    _isExecuted = analyzer._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TFrequencyAnalyzer::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Fourier transform not executed");
+    }
+    return _sl.get();
+}
+
+const TFrequencyAnalyzerParams& TFrequencyAnalyzer::getParams() const {
+    return _params;
+}
+
+bool TFrequencyAnalyzer::isExecuted() const {
+    return _isExecuted;
+}
+
+void TFrequencyAnalyzer::execute() {
+    // We're ensuring that the signal line is not null here because the signal
+    // line may be set after the TFrequencyAnalyzer object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    if (!_params.signalLine->getParams().duration) {
+        throw SignalProcessingError(
+            "Signal line does not have duration information");
+    }
+
+    // Initialize frequency and time-related parameters
+    const double fromFrequency = _params.fromFrequency;
+    const double toFrequency   = _params.toFrequency;
+    const double stepFrequency = _params.stepFrequency;
+    const double duration = _params.signalLine->getParams().duration.value();
+    const double samplingFreq =
+        _params.signalLine->getParams().samplingFrequency.value();
+
+    // Configure signal line parameters for the output frequency domain signal
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    _sl                        = std::make_unique<TSignalLine>(
+        ceil((toFrequency - fromFrequency) / stepFrequency));
+
+    // The reference waves are generated on the uniform grid of the signal, so
+    // the signal has to cover exactly the same points (see TMultiplier).
+    const auto& params      = _params.signalLine->getParams();
+    const auto  pointsCount = static_cast<std::size_t>(
+        ceil(duration * samplingFreq + 1));
+    if (params.pointsCount != pointsCount ||
+        std::abs(_params.signalLine->getPoint(0).x) > SL::DEFAULT_INACCURACY ||
+        std::abs(_params.signalLine->getPoint(pointsCount - 1).x -
+                 static_cast<double>(pointsCount - 1) / samplingFreq) >
+            SL::DEFAULT_INACCURACY) {
+        throw SignalProcessingError("Signal lines aren't equal");
+    }
+
+    // Remove DC component from the signal
+    auto DCRemovedSignal = TSignalLine(_params.signalLine);
+    DCRemovedSignal.removeDCComponent();
+
+    // Fold the trapezoidal integration weights (see TIntegrator) into the
+    // signal once, so every bin only needs a plain dot product.
+    const auto&         points  = DCRemovedSignal.getPoints();
+    const auto          weights = DCRemovedSignal.getTrapezoidalWeights();
+    std::vector<double> weightedSignal(pointsCount);
+    double              signalEnergy = 0.0;
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        weightedSignal[i] = weights[i] * points[i].y;
+        signalEnergy += weightedSignal[i] * points[i].y;
+    }
+
+    // Evaluate the bins in blocks, streaming the signal once per block
+    const std::size_t binsCount = _sl->getParams().pointsCount;
+    const bool        useAbsoluteValue =
+        _params.useAbsoluteValue.value_or(FA::DEFAULT_USE_ABSOLUTE_VALUE);
+    std::array<double, FA::BINS_PER_BLOCK> frequencies{};
+    std::array<double, FA::BINS_PER_BLOCK> correlations{};
+    for (std::size_t block = 0; block < binsCount;
+         block += FA::BINS_PER_BLOCK) {
+        for (std::size_t k = 0; k < FA::BINS_PER_BLOCK; ++k) {
+            frequencies[k] =
+                fromFrequency + static_cast<double>(block + k) * stepFrequency;
+        }
+
+        correlateBlock(weightedSignal, signalEnergy, samplingFreq, frequencies,
+                       correlations);
+
+        for (std::size_t k = 0; k < FA::BINS_PER_BLOCK && block + k < binsCount;
+             ++k) {
+            _sl->setPoint(block + k, frequencies[k],
+                          useAbsoluteValue ? std::abs(correlations[k])
+                                           : correlations[k]);
+        }
+    }
+
+    _isExecuted = true;
 }
\ No newline at end of file
@@ -0,0 +1,294 @@
+/**
+ * @file TLombScargle.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TLombScargle class computing the
+ * Lomb-Scargle periodogram of irregularly sampled signals.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TLombScargle.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Spreads a complex value onto the nodes of a periodic grid around a
+     * fractional position so that sums of `value * exp(-2*pi*i*k*u/M)` are
+     * preserved (Lagrange extirpolation).
+     *
+     * @param grid Periodic grid of `M` nodes.
+     * @param position Fractional position within [0, M).
+     * @param value Value to spread.
+     */
+    void extirpolate(std::vector<std::complex<double>>& grid,
+                     const double                       position,
+                     const std::complex<double>         value) {
+        constexpr std::size_t order = LS::EXTIRPOLATION_ORDER;
+        const auto            size  = static_cast<long long>(grid.size());
+        const long long       first =
+            static_cast<long long>(floor(position)) -
+            static_cast<long long>(order / 2) + 1;
+
+        for (std::size_t p = 0; p < order; ++p) {
+            const auto node =
+                static_cast<double>(first) + static_cast<double>(p);
+            double weight = 1.0;
+            for (std::size_t q = 0; q < order; ++q) {
+                if (q != p) {
+                    const auto other =
+                        static_cast<double>(first) + static_cast<double>(q);
+                    weight *= (position - other) / (node - other);
+                }
+            }
+            const long long index =
+                ((first + static_cast<long long>(p)) % size + size) % size;
+            grid[static_cast<std::size_t>(index)] += weight * value;
+        }
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TLombScargle::TLombScargle(
+    const TSignalLine*                     signalLine,
+    const double                           fromFrequency,
+    const double                           toFrequency,
+    const double                           stepFrequency,
+    const std::optional<LS::Normalization> normalization,
+    std::optional<std::string>             xLabel,
+    std::optional<std::string>             yLabel,
+    std::optional<std::string>             graphLabel)
+    : _params{.signalLine    = signalLine,
+              .fromFrequency = fromFrequency,
+              .toFrequency   = toFrequency,
+              .stepFrequency = stepFrequency,
+              .normalization = normalization,
+              .xLabel        = std::move(xLabel),
+              .yLabel        = std::move(yLabel),
+              .graphLabel    = std::move(graphLabel)} {
+    if (_params.fromFrequency >= _params.toFrequency) {
+        throw SignalProcessingError("Invalid frequency range");
+    }
+}
+
+TLombScargle::TLombScargle(TLombScargleParams params)
+    : _params(std::move(params)) {
+    if (_params.fromFrequency >= _params.toFrequency) {
+        throw SignalProcessingError("Invalid frequency range");
+    }
+}
+
+TLombScargle::TLombScargle(const TLombScargle& periodogram)
+    : _sl(periodogram._sl ? std::make_unique<TSignalLine>(*periodogram._sl)
+                          : nullptr),
+      _params(periodogram._params),
+      _isExecuted(periodogram._isExecuted) {}
+
+TLombScargle& TLombScargle::operator=(const TLombScargle& periodogram) {
+    if (this == &periodogram) {
+        return *this;
+    }
+    _sl         = periodogram._sl
+                      ? std::make_unique<TSignalLine>(*periodogram._sl)
+                      : nullptr;
+    _params     = periodogram._params;
+    _isExecuted = periodogram._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TLombScargle::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Lomb-Scargle periodogram not executed");
+    }
+    return _sl.get();
+}
+
+const TLombScargleParams& TLombScargle::getParams() const {
+    return _params;
+}
+
+bool TLombScargle::isExecuted() const {
+    return _isExecuted;
+}
+
+void TLombScargle::execute() {
+    // We're ensuring that the signal line is not null here because the signal
+    // line may be set after the TLombScargle object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    if (_params.stepFrequency <= 0.0) {
+        throw SignalProcessingError("Frequency step should be positive");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount < 2) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    // The periodogram is invariant to time shifts, so the times are taken
+    // relative to the earliest sample to keep the phases accurate.
+    double startTime = points[0].x;
+    double mean      = 0.0;
+    for (const auto& point : points) {
+        startTime = std::min(startTime, point.x);
+        mean += point.y;
+    }
+    mean /= static_cast<double>(pointsCount);
+
+    std::vector<double> times(pointsCount);
+    std::vector<double> values(pointsCount);
+    double              totalSquares = 0.0;
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        times[i]  = points[i].x - startTime;
+        values[i] = points[i].y - mean;
+        totalSquares += values[i] * values[i];
+    }
+    if (totalSquares <= 0.0) {
+        throw SignalProcessingError("Signal line should not be constant");
+    }
+
+    const auto binsCount = static_cast<std::size_t>(
+        ceil((_params.toFrequency - _params.fromFrequency) /
+             _params.stepFrequency));
+    const auto method = _params.method.value_or(LS::DEFAULT_METHOD);
+    const bool useDirect =
+        method == LS::Method::Direct ||
+        (method == LS::Method::Auto &&
+         pointsCount * binsCount <= LS::DIRECT_THRESHOLD);
+    const auto sums = useDirect ? directSums(times, values, binsCount)
+                                : fastSums(times, values, binsCount);
+
+    // Shifting the time origin by tau makes the cosine and sine terms
+    // orthogonal; tan(2 * w * tau) = sum(sin(2wt)) / sum(cos(2wt)).
+    const auto count      = static_cast<double>(pointsCount);
+    const bool isStandard = _params.normalization.value_or(
+                                LS::DEFAULT_NORMALIZATION) ==
+                            LS::Normalization::Standard;
+    std::vector<Point> outputPoints(binsCount);
+    for (std::size_t k = 0; k < binsCount; ++k) {
+        const Sums&  bin        = sums[k];
+        const double doubleNorm = std::hypot(bin.doubleCos, bin.doubleSin);
+        const double cosDouble =
+            doubleNorm > 0.0 ? bin.doubleCos / doubleNorm : 1.0;
+        const double sinDouble =
+            doubleNorm > 0.0 ? bin.doubleSin / doubleNorm : 0.0;
+        const double cosTau = sqrt((1.0 + cosDouble) / 2.0);
+        const double sinTau =
+            std::copysign(sqrt((1.0 - cosDouble) / 2.0), sinDouble);
+
+        const double cosProjection =
+            bin.signalCos * cosTau + bin.signalSin * sinTau;
+        const double sinProjection =
+            bin.signalSin * cosTau - bin.signalCos * sinTau;
+        const double cosEnergy = (count + doubleNorm) / 2.0;
+        const double sinEnergy = (count - doubleNorm) / 2.0;
+
+        // The sine term vanishes at zero frequency (and at the Nyquist
+        // frequency of uniform sampling)
+        double power = cosProjection * cosProjection / cosEnergy;
+        if (sinEnergy > count * SL::DEFAULT_INACCURACY) {
+            power += sinProjection * sinProjection / sinEnergy;
+        }
+
+        outputPoints[k] = Point{
+            .x = _params.fromFrequency +
+                 static_cast<double>(k) * _params.stepFrequency,
+            .y = isStandard ? power / totalSquares : power / 2.0};
+    }
+
+    _sl = std::make_unique<TSignalLine>(binsCount, _params.xLabel,
+                                        _params.yLabel, _params.graphLabel);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+std::vector<TLombScargle::Sums> TLombScargle::directSums(
+    const std::vector<double>& times,
+    const std::vector<double>& values,
+    const std::size_t          binsCount) const {
+    std::vector<Sums> sums(binsCount);
+    PAR::parallelFor(
+        binsCount,
+        [this, &times, &values, &sums](const std::size_t begin,
+                                       const std::size_t end) {
+            for (std::size_t k = begin; k < end; ++k) {
+                const double omega =
+                    TWO_PI * (_params.fromFrequency +
+                              static_cast<double>(k) * _params.stepFrequency);
+                Sums bin;
+                for (std::size_t i = 0; i < times.size(); ++i) {
+                    const double phase = omega * times[i];
+                    bin.signalCos += values[i] * cos(phase);
+                    bin.signalSin += values[i] * sin(phase);
+                    bin.doubleCos += cos(2.0 * phase);
+                    bin.doubleSin += sin(2.0 * phase);
+                }
+                sums[k] = bin;
+            }
+        },
+        _params.threadsCount, LS::BINS_PER_CHUNK);
+    return sums;
+}
+
+std::vector<TLombScargle::Sums> TLombScargle::fastSums(
+    const std::vector<double>& times,
+    const std::vector<double>& values,
+    const std::size_t          binsCount) const {
+    // exp(-2*pi*i*k*step*t) has the period 1 / step for every integer k, so
+    // the samples are wrapped onto one period sampled with gridSize nodes.
+    // The frequency offset fromFrequency is folded into the spread values.
+    const std::size_t gridSize = TFFT::nextPowerOfTwo(std::max(
+        LS::GRID_OVERSAMPLING * 2 * binsCount, LS::EXTIRPOLATION_ORDER));
+    const auto        size     = static_cast<double>(gridSize);
+    std::vector<std::complex<double>> signalGrid(gridSize, {0.0, 0.0});
+    std::vector<std::complex<double>> doubleGrid(gridSize, {0.0, 0.0});
+
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        const double cycles   = times[i] * _params.stepFrequency;
+        const double position = (cycles - floor(cycles)) * size;
+        const double offset   = -TWO_PI * _params.fromFrequency * times[i];
+        extirpolate(signalGrid, position,
+                    values[i] * std::complex<double>(cos(offset), sin(offset)));
+        extirpolate(doubleGrid, position,
+                    {cos(2.0 * offset), sin(2.0 * offset)});
+    }
+
+    const TFFT fft(gridSize);
+    fft.forward(signalGrid);
+    fft.forward(doubleGrid);
+
+    // The transforms hold sum(value * exp(-i * w * t)) = C - iS; the doubled
+    // frequencies 2 * (fromFrequency + k * step) are found at the index 2k.
+    std::vector<Sums> sums(binsCount);
+    for (std::size_t k = 0; k < binsCount; ++k) {
+        sums[k] = Sums{.signalCos = signalGrid[k].real(),
+                       .signalSin = -signalGrid[k].imag(),
+                       .doubleCos = doubleGrid[2 * k].real(),
+                       .doubleSin = -doubleGrid[2 * k].imag()};
+    }
+    return sums;
+}
\ No newline at end of file
@@ -0,0 +1,260 @@
+/**
+ * @file TLombScargle.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TLombScargle class computing the
+ * Lomb-Scargle periodogram of irregularly sampled signals.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace LS
+ * @brief Contains default parameters used for the Lomb-Scargle periodogram.
+ */
+namespace LS {
+
+    /**
+     * @enum Normalization
+     * @brief Specifies the scaling of the periodogram.
+     */
+    enum class Normalization : std::uint8_t {
+        Standard,  ///< Fraction of the signal variance explained by the best
+                   ///< fitting sine wave at each frequency, within [0, 1].
+        Psd        ///< Power spectral density as defined by Scargle, in squared
+                   ///< signal units.
+    };
+
+    /**
+     * @enum Method
+     * @brief Specifies how the trigonometric sums are evaluated.
+     */
+    enum class Method : std::uint8_t {
+        Auto,    ///< Direct for small inputs, fast otherwise.
+        Direct,  ///< Exact sums, `O(N * K)` for `N` points and `K` bins.
+        Fast     ///< Sums from two FFTs of the signal spread onto a uniform
+                 ///< grid (Press and Rybicki), `O(N + K log K)`.
+    };
+
+    static constexpr auto DEFAULT_NORMALIZATION =
+        Normalization::Standard;  ///< Default scaling of the periodogram.
+    static constexpr auto DEFAULT_METHOD =
+        Method::Auto;  ///< Default evaluation method.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Lomb-Scargle Periodogram";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t DIRECT_THRESHOLD =
+        1 << 18;  ///< Largest product of points and bins evaluated directly
+                  ///< when the method is `Auto`.
+    static constexpr std::size_t EXTIRPOLATION_ORDER =
+        4;  ///< Number of grid nodes every sample is spread onto (fast method).
+    static constexpr std::size_t GRID_OVERSAMPLING =
+        8;  ///< Minimal ratio of the grid size to the highest evaluated grid
+            ///< frequency index (fast method).
+    static constexpr std::size_t BINS_PER_CHUNK =
+        16;  ///< Minimal number of bins evaluated by one thread (direct
+             ///< method).
+
+}  // namespace LS
+
+/**
+ * @struct TLombScargleParams
+ * @brief Contains parameters used for the Lomb-Scargle periodogram.
+ */
+struct TLombScargleParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to analyze (any x spacing).
+
+    // Calculation Parameters
+    double fromFrequency = 0.0;  ///< Lower bound of the frequency range.
+    double toFrequency   = 0.0;  ///< Upper bound of the frequency range.
+    double stepFrequency = 0.0;  ///< Step size for the frequency range.
+    std::optional<LS::Normalization> normalization =
+        LS::DEFAULT_NORMALIZATION;  ///< Scaling of the periodogram.
+    std::optional<LS::Method> method =
+        LS::DEFAULT_METHOD;  ///< Evaluation method.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads of the direct method. If not set,
+                       ///< the number of hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        LS::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TLombScargle
+ * @brief Class for computing the Lomb-Scargle periodogram of a signal line
+ * with arbitrary x coordinates.
+ *
+ * @details For every frequency `f` of the range, the mean-removed signal is
+ * fitted with `a * cos(w * (t - tau)) + b * sin(w * (t - tau))` by least
+ * squares (`w = 2*pi*f`, `tau` chosen so that the cosine and sine terms are
+ * orthogonal on the sample times), which reduces to the classic periodogram
+ * for uniformly sampled signals. No sampling frequency is needed.
+ *
+ * The fast method spreads the samples onto a uniform grid of one period
+ * `1 / stepFrequency` by Lagrange extirpolation and obtains the sums of all
+ * bins from two FFTs; its accuracy is governed by `LS::EXTIRPOLATION_ORDER` and
+ * `LS::GRID_OVERSAMPLING`.
+ *
+ * The result has the layout of TFrequencyAnalyzer: one point per bin of
+ * `[fromFrequency, toFrequency)` with the frequency on the x-axis, so the two
+ * spectra can be compared or plotted together.
+ */
+class TLombScargle {
+   public:
+    /**
+     * @brief Constructs a TLombScargle with a signal line and a frequency
+     * range.
+     *
+     * @param signalLine Pointer to the signal line to analyze.
+     * @param fromFrequency Lower bound of the frequency range.
+     * @param toFrequency Upper bound of the frequency range.
+     * @param stepFrequency Step size for the frequency range.
+     * @param normalization Scaling of the periodogram.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     *
+     * @throws SignalProcessingError if the frequency range is invalid.
+     */
+    explicit TLombScargle(
+        const TSignalLine*               signalLine,
+        double                           fromFrequency = 0.0,
+        double                           toFrequency   = 0.0,
+        double                           stepFrequency = 0.0,
+        std::optional<LS::Normalization> normalization =
+            LS::DEFAULT_NORMALIZATION,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = LS::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TLombScargle with periodogram parameters.
+     *
+     * @param params Structure containing the parameters of the periodogram.
+     *
+     * @throws SignalProcessingError if the frequency range is invalid.
+     */
+    explicit TLombScargle(TLombScargleParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TLombScargle() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TLombScargle(const TLombScargle& periodogram);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TLombScargle(TLombScargle&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TLombScargle& operator=(const TLombScargle& periodogram);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TLombScargle& operator=(TLombScargle&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the periodogram.
+     *
+     * @return const TSignalLine* A pointer to the periodogram signal line.
+     *
+     * @throw SignalProcessingError if the periodogram has not been computed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the periodogram.
+     *
+     * @return const TLombScargleParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TLombScargleParams& getParams() const;
+
+    /**
+     * @brief Determines if the periodogram has been computed.
+     *
+     * @return bool True if the periodogram has been computed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Computes the periodogram.
+     *
+     * @throws SignalProcessingError if the signal line is null, has fewer than
+     * two points or a constant value, or if the frequency step is not
+     * positive.
+     */
+    void execute();
+
+   private:
+    /**
+     * @struct Sums
+     * @brief Trigonometric sums of one frequency bin.
+     */
+    struct Sums {
+        double signalCos = 0.0;  ///< Sum of y * cos(w * t).
+        double signalSin = 0.0;  ///< Sum of y * sin(w * t).
+        double doubleCos = 0.0;  ///< Sum of cos(2 * w * t).
+        double doubleSin = 0.0;  ///< Sum of sin(2 * w * t).
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the periodogram signal line.
+    TLombScargleParams _params = {};  ///< Parameters of the periodogram.
+    bool _isExecuted = false;  ///< Flag indicating if the periodogram has been
+                               ///< computed.
+
+    /**
+     * @brief Evaluates the sums of all bins directly.
+     *
+     * @param times Sample times relative to the first one.
+     * @param values Mean-removed sample values.
+     * @param binsCount Number of bins.
+     * @return std::vector<Sums> The sums of every bin.
+     */
+    [[nodiscard]] std::vector<Sums> directSums(
+        const std::vector<double>& times,
+        const std::vector<double>& values,
+        std::size_t                binsCount) const;
+
+    /**
+     * @brief Evaluates the sums of all bins by extirpolation and FFT.
+     *
+     * @param times Sample times relative to the first one.
+     * @param values Mean-removed sample values.
+     * @param binsCount Number of bins.
+     * @return std::vector<Sums> The sums of every bin.
+     */
+    [[nodiscard]] std::vector<Sums> fastSums(
+        const std::vector<double>& times,
+        const std::vector<double>& values,
+        std::size_t                binsCount) const;
+};
\ No newline at end of file
@@ -0,0 +1,319 @@
+/**
+ * @file TMedianFilter.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TMedianFilter class applying a
+ * running median to signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TMedianFilter.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @class SortedWindow
+     * @brief Window kept as a sorted array (small windows).
+     */
+    class SortedWindow {
+       public:
+        explicit SortedWindow(const std::span<const double> values)
+            : _values(values.begin(), values.end()) {
+            std::sort(_values.begin(), _values.end());
+        }
+
+        void replace(const double outgoing, const double incoming) {
+            auto position =
+                std::lower_bound(_values.begin(), _values.end(), outgoing);
+            // Shift the neighbours over the outgoing value towards the place
+            // of the incoming one
+            while (position + 1 != _values.end() &&
+                   *(position + 1) < incoming) {
+                *position = *(position + 1);
+                ++position;
+            }
+            while (position != _values.begin() && *(position - 1) > incoming) {
+                *position = *(position - 1);
+                --position;
+            }
+            *position = incoming;
+        }
+
+        [[nodiscard]] double median() const {
+            return _values[_values.size() / 2];
+        }
+
+       private:
+        std::vector<double> _values;  ///< Window values in ascending order.
+    };
+
+    /**
+     * @class TreeWindow
+     * @brief Window kept as two balanced trees (large windows).
+     * @details The lower tree holds one value more than the upper one, so the
+     * median is its largest value.
+     */
+    class TreeWindow {
+       public:
+        explicit TreeWindow(const std::span<const double> values) {
+            std::vector<double> sorted(values.begin(), values.end());
+            std::sort(sorted.begin(), sorted.end());
+            const auto lowerCount =
+                static_cast<std::ptrdiff_t>(sorted.size() / 2 + 1);
+            _lower.insert(sorted.begin(), sorted.begin() + lowerCount);
+            _upper.insert(sorted.begin() + lowerCount, sorted.end());
+        }
+
+        void replace(const double outgoing, const double incoming) {
+            if (outgoing <= *_lower.rbegin()) {
+                _lower.erase(_lower.find(outgoing));
+            } else {
+                _upper.erase(_upper.find(outgoing));
+            }
+            if (_lower.empty() || incoming <= *_lower.rbegin()) {
+                _lower.insert(incoming);
+            } else {
+                _upper.insert(incoming);
+            }
+            // Restore the sizes by moving one boundary value
+            if (_lower.size() > _upper.size() + 1) {
+                const auto last = std::prev(_lower.end());
+                _upper.insert(*last);
+                _lower.erase(last);
+            } else if (_lower.size() <= _upper.size()) {
+                _lower.insert(*_upper.begin());
+                _upper.erase(_upper.begin());
+            }
+        }
+
+        [[nodiscard]] double median() const {
+            return *_lower.rbegin();
+        }
+
+       private:
+        std::multiset<double> _lower;  ///< Lower half and the median.
+        std::multiset<double> _upper;  ///< Upper half.
+    };
+
+    /**
+     * @brief Computes running medians.
+     *
+     * @param input `count + windowSize - 1` input values.
+     * @param windowSize Number of samples in the window.
+     * @param output Receives `count` medians, `output[i]` being the median of
+     * `input[i] ... input[i + windowSize - 1]`.
+     * @param count Number of medians.
+     */
+    template <typename Window>
+    void slide(const double*     input,
+               const std::size_t windowSize,
+               double*           output,
+               const std::size_t count) {
+        Window window({input, windowSize});
+        for (std::size_t i = 0; i < count; ++i) {
+            output[i] = window.median();
+            if (i + 1 < count) {
+                window.replace(input[i], input[i + windowSize]);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks that the values are finite.
+     * @details Both windows rely on a strict weak ordering of the values,
+     * which a NaN breaks.
+     *
+     * @param values Values to check.
+     *
+     * @throws SignalProcessingError If a value is not finite.
+     */
+    void checkFinite(const std::span<const double> values) {
+        if (!std::all_of(values.begin(), values.end(),
+                         [](const double value) {
+                             return std::isfinite(value);
+                         })) {
+            throw SignalProcessingError("Input samples should be finite");
+        }
+    }
+
+    /**
+     * @brief Computes running medians with the window suited to its size.
+     *
+     * @param input `count + windowSize - 1` input values.
+     * @param windowSize Number of samples in the window.
+     * @param output Receives `count` medians.
+     * @param count Number of medians.
+     */
+    void filterRange(const double*     input,
+                     const std::size_t windowSize,
+                     double*           output,
+                     const std::size_t count) {
+        if (count == 0) {
+            return;
+        }
+        if (windowSize <= MED::SMALL_WINDOW_SIZE) {
+            slide<SortedWindow>(input, windowSize, output, count);
+        } else {
+            slide<TreeWindow>(input, windowSize, output, count);
+        }
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TMedianFilter::TMedianFilter(const TSignalLine*               signalLine,
+                             const std::optional<std::size_t> windowSize,
+                             std::optional<std::string>       xLabel,
+                             std::optional<std::string>       yLabel,
+                             std::optional<std::string>       graphLabel)
+    : _params{.signalLine = signalLine,
+              .windowSize = windowSize,
+              .xLabel     = std::move(xLabel),
+              .yLabel     = std::move(yLabel),
+              .graphLabel = std::move(graphLabel)} {}
+
+TMedianFilter::TMedianFilter(TMedianFilterParams params)
+    : _params(std::move(params)) {}
+
+TMedianFilter::TMedianFilter(const TMedianFilter& filter)
+    : _sl(filter._sl ? std::make_unique<TSignalLine>(*filter._sl) : nullptr),
+      _params(filter._params),
+      _stream(filter._stream),
+      _isExecuted(filter._isExecuted) {}
+
+TMedianFilter& TMedianFilter::operator=(const TMedianFilter& filter) {
+    if (this == &filter) {
+        return *this;
+    }
+    _sl = filter._sl ? std::make_unique<TSignalLine>(*filter._sl) : nullptr;
+    _params     = filter._params;
+    _stream     = filter._stream;
+    _isExecuted = filter._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TMedianFilter::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Median filter not executed");
+    }
+    return _sl.get();
+}
+
+const TMedianFilterParams& TMedianFilter::getParams() const {
+    return _params;
+}
+
+bool TMedianFilter::isExecuted() const {
+    return _isExecuted;
+}
+
+void TMedianFilter::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TMedianFilter object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    const std::size_t windowSize = getWindowSize();
+    const std::size_t half       = windowSize / 2;
+
+    // The edge samples are repeated beyond the ends of the line
+    std::vector<double> input(pointsCount + windowSize - 1);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        const std::size_t index = std::clamp(i, half, pointsCount + half - 1);
+        input[i]                = points[index - half].y;
+    }
+    checkFinite(input);
+
+    std::vector<double> output(pointsCount);
+    PAR::parallelFor(
+        pointsCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            filterRange(input.data() + begin, windowSize, output.data() + begin,
+                        end - begin);
+        },
+        _params.threadsCount, MED::SAMPLES_PER_CHUNK);
+
+    std::vector<Point> outputPoints(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        outputPoints[i] = Point{.x = points[i].x, .y = output[i]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    slParams.pointsCount       = pointsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+std::vector<double> TMedianFilter::processBlock(
+    const std::span<const double> samples) {
+    const std::size_t windowSize = getWindowSize();
+    if (samples.empty()) {
+        return {};
+    }
+    checkFinite(samples);
+    if (!_stream) {
+        _stream = State{
+            .history = std::vector<double>(windowSize - 1, samples.front())};
+    }
+    State& state = *_stream;
+
+    const std::size_t   historyLength = state.history.size();
+    std::vector<double> buffer(historyLength + samples.size());
+    std::copy(state.history.begin(), state.history.end(), buffer.begin());
+    std::copy(samples.begin(), samples.end(),
+              buffer.begin() + static_cast<std::ptrdiff_t>(historyLength));
+
+    std::vector<double> output(samples.size());
+    filterRange(buffer.data(), windowSize, output.data(), samples.size());
+
+    std::copy(buffer.end() - static_cast<std::ptrdiff_t>(historyLength),
+              buffer.end(), state.history.begin());
+    return output;
+}
+
+void TMedianFilter::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+std::size_t TMedianFilter::getWindowSize() const {
+    const std::size_t windowSize =
+        _params.windowSize.value_or(MED::DEFAULT_WINDOW_SIZE);
+    if (windowSize % 2 == 0) {
+        throw SignalProcessingError("Window size should be odd");
+    }
+    return windowSize;
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+/**
+ * @file TMedianFilter.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TMedianFilter class applying a
+ * running median to signal lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace MED
+ * @brief Contains default parameters used for median filtering.
+ */
+namespace MED {
+
+    static constexpr std::size_t DEFAULT_WINDOW_SIZE =
+        5;  ///< Default number of samples in the window (odd).
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Median Filtered Signal";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t SMALL_WINDOW_SIZE =
+        64;  ///< Largest window kept as a plain sorted array.
+    static constexpr std::size_t SAMPLES_PER_CHUNK =
+        16384;  ///< Minimal number of samples filtered by one thread.
+
+}  // namespace MED
+
+/**
+ * @struct TMedianFilterParams
+ * @brief Contains parameters used for median filtering.
+ */
+struct TMedianFilterParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to filter (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<std::size_t> windowSize =
+        MED::DEFAULT_WINDOW_SIZE;  ///< Number of samples in the window (odd).
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        MED::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TMedianFilter
+ * @brief Class for removing impulse noise with a running median.
+ *
+ * @details Every output sample is the median of the `W = windowSize` input
+ * samples centered on it; beyond the ends of the line the edge samples are
+ * repeated, so the output has the same points as the input. The window is
+ * slid by removing the oldest and inserting the newest sample:
+ *
+ * - windows of up to `MED::SMALL_WINDOW_SIZE` samples are kept as a sorted
+ *   array, where a step is a binary search and a short contiguous move;
+ * - larger windows are kept as two balanced trees holding the lower and the
+ *   upper half (a double heap with deletion), so a step costs `O(log W)`.
+ *
+ * A sliding median cannot be updated in amortized constant time by
+ * comparisons, so the small windows are not `O(1)` per step: the move is
+ * `O(W)`, but it shifts at most `MED::SMALL_WINDOW_SIZE - 1` contiguous values
+ * and outruns the tree updates at these sizes.
+ *
+ * Long lines are split into chunks filtered on several threads; each chunk
+ * starts its own window from the `W - 1` samples overlapping the previous
+ * chunk, so the result does not depend on the number of threads.
+ *
+ * In streaming mode the output is causal: the median of the last `W`
+ * samples, with the first sample of the stream repeated before it. The stream
+ * therefore lags the whole-line result by `(W - 1) / 2` samples.
+ */
+class TMedianFilter {
+   public:
+    /**
+     * @brief Constructs a TMedianFilter with a signal line and a window size.
+     *
+     * @param signalLine Pointer to the signal line to filter.
+     * @param windowSize Number of samples in the window (odd).
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TMedianFilter(
+        const TSignalLine*         signalLine,
+        std::optional<std::size_t> windowSize = MED::DEFAULT_WINDOW_SIZE,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = MED::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TMedianFilter with filter parameters.
+     *
+     * @param params Structure containing the parameters of the filter.
+     */
+    explicit TMedianFilter(TMedianFilterParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TMedianFilter() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TMedianFilter(const TMedianFilter& filter);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TMedianFilter(TMedianFilter&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TMedianFilter& operator=(const TMedianFilter& filter);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TMedianFilter& operator=(TMedianFilter&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the filtered signal line.
+     *
+     * @return const TSignalLine* A pointer to the filtered signal line.
+     *
+     * @throw SignalProcessingError If the filter has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the filter.
+     *
+     * @return const TMedianFilterParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TMedianFilterParams& getParams() const;
+
+    /**
+     * @brief Determines if the filter has been executed.
+     *
+     * @return bool True if the filter has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Filters the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, if a sample is not finite, or if the window size is not odd.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<double> Medians of the last `W` samples (one per
+     * input sample).
+     *
+     * @throws SignalProcessingError If the window size is not odd or if a
+     * sample is not finite.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Stream state of the filter.
+     */
+    struct State {
+        std::vector<double> history =
+            {};  ///< Last `W - 1` input samples.
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the filtered signal line.
+    TMedianFilterParams  _params = {};            ///< Parameters of the filter.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the filter has been
+                               ///< executed.
+
+    /**
+     * @brief Validates and returns the window size.
+     *
+     * @return std::size_t The window size.
+     *
+     * @throws SignalProcessingError If the window size is not odd.
+     */
+    [[nodiscard]] std::size_t getWindowSize() const;
+};
\ No newline at end of file
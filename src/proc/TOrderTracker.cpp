@@ -0,0 +1,590 @@
+/**
+ * @file TOrderTracker.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TOrderTracker class resampling
+ * vibration lines onto uniform shaft angle increments and computing their
+ * order spectra.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TOrderTracker.hpp"
+#include "TCore.hpp"
+#include "TEventDetector.hpp"
+#include "TFFT.hpp"
+#include "TFilterDesign.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Solves a monotone cubic Hermite segment normalized to the unit
+     * square for the parameter reaching a target value.
+     *
+     * @param target Target value within [0, 1].
+     * @param startSlope Normalized slope at the start of the segment.
+     * @param endSlope Normalized slope at the end of the segment.
+     * @return double The parameter within [0, 1].
+     */
+    double solveHermite(const double target,
+                        const double startSlope,
+                        const double endSlope) {
+        double lower = 0.0;
+        double upper = 1.0;
+        double t     = target;
+        for (std::size_t i = 0; i < ORD::MAX_SOLVER_ITERATIONS; ++i) {
+            const double t2    = t * t;
+            const double t3    = t2 * t;
+            const double value = (t3 - 2.0 * t2 + t) * startSlope +
+                                 (3.0 * t2 - 2.0 * t3) +
+                                 (t3 - t2) * endSlope - target;
+            if (value == 0.0) {
+                return t;
+            }
+            if (value > 0.0) {
+                upper = t;
+            } else {
+                lower = t;
+            }
+            const double derivative = (3.0 * t2 - 4.0 * t + 1.0) * startSlope +
+                                      6.0 * (t - t2) +
+                                      (3.0 * t2 - 2.0 * t) * endSlope;
+
+            // Newton steps leaving the bracket fall back to bisection
+            double next = derivative > 0.0 ? t - value / derivative : -1.0;
+            if (next <= lower || next >= upper) {
+                next = 0.5 * (lower + upper);
+            }
+            if (std::abs(next - t) < 1e-14) {
+                return next;
+            }
+            t = next;
+        }
+        return t;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TOrderTracker::TOrderTracker(
+    std::vector<const TSignalLine*>      signalLines,
+    const TSignalLine*                   tachometerLine,
+    const std::optional<ORD::Tachometer> tachometer,
+    const std::optional<double>          triggerLevel,
+    const std::optional<std::size_t>     samplesPerRevolution)
+    : _params{.signalLines          = std::move(signalLines),
+              .tachometerLine       = tachometerLine,
+              .tachometer           = tachometer,
+              .triggerLevel         = triggerLevel,
+              .samplesPerRevolution = samplesPerRevolution} {}
+
+TOrderTracker::TOrderTracker(TOrderTrackerParams params)
+    : _params(std::move(params)) {}
+
+const TSignalLine* TOrderTracker::getSignalLine(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Order tracker not executed");
+    }
+    if (channel >= _lines.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return &_lines[channel];
+}
+
+const TSignalLine* TOrderTracker::getOrderSpectrum(
+    const std::size_t channel) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Order tracker not executed");
+    }
+    if (channel >= _spectra.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return &_spectra[channel];
+}
+
+std::size_t TOrderTracker::getSegmentsCount() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Order tracker not executed");
+    }
+    return _segmentsCount;
+}
+
+const TOrderTrackerParams& TOrderTracker::getParams() const {
+    return _params;
+}
+
+bool TOrderTracker::isExecuted() const {
+    return _isExecuted;
+}
+
+void TOrderTracker::execute() {
+    // We're ensuring that the signal lines are not null here because they may
+    // be set after the TOrderTracker object creation.
+    if (_params.signalLines.empty()) {
+        throw SignalProcessingError("No vibration lines");
+    }
+    if (_params.tachometerLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       tachometerPoints = _params.tachometerLine->getPoints();
+    const std::size_t pointsCount      = tachometerPoints.size();
+    for (const TSignalLine* line : _params.signalLines) {
+        if (line == nullptr) {
+            throw SignalProcessingError("Invalid signal line (nullptr)");
+        }
+        if (line->getPoints().size() != pointsCount) {
+            throw SignalProcessingError(
+                "Vibration and tachometer lines should have the same points "
+                "count");
+        }
+    }
+
+    const std::size_t           channelsCount = _params.signalLines.size();
+    const std::optional<double> samplingFrequency =
+        _params.samplingFrequency
+            ? _params.samplingFrequency
+            : _params.tachometerLine->getParams().samplingFrequency;
+    State state = makeState(channelsCount, samplingFrequency);
+
+    std::vector<double> tachometer(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        tachometer[i] = tachometerPoints[i].y;
+    }
+    std::vector<std::vector<double>>     channels(channelsCount);
+    std::vector<std::span<const double>> channelSpans(channelsCount);
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        const auto& points = _params.signalLines[c]->getPoints();
+        channels[c].resize(pointsCount);
+        for (std::size_t i = 0; i < pointsCount; ++i) {
+            channels[c][i] = points[i].y;
+        }
+        channelSpans[c] = channels[c];
+    }
+
+    std::vector<std::vector<double>> outputs;
+    track(state, tachometer, channelSpans, true, outputs);
+    if (_params.tachometer.value_or(ORD::DEFAULT_TACHOMETER) ==
+            ORD::Tachometer::Pulses &&
+        state.pulsesCount < 2) {
+        throw SignalProcessingError("Insufficient number of tachometer pulses");
+    }
+    if (state.segmentsCount == 0) {
+        throw SignalProcessingError(
+            "Insufficient number of revolutions for a spectrum segment");
+    }
+
+    const auto samplesPerRevolution = static_cast<double>(
+        _params.samplesPerRevolution.value_or(
+            ORD::DEFAULT_SAMPLES_PER_REVOLUTION));
+    const std::size_t outputsCount = state.outputsCount;
+    _lines.clear();
+    _spectra.clear();
+    _lines.reserve(channelsCount);
+    _spectra.reserve(channelsCount);
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        std::vector<Point> points(outputsCount);
+        for (std::size_t j = 0; j < outputsCount; ++j) {
+            points[j] =
+                Point{.x = static_cast<double>(j) / samplesPerRevolution,
+                      .y = outputs[c][j]};
+        }
+        _lines.emplace_back(outputsCount, ORD::DEFAULT_ANGLE_LABEL,
+                            _params.yLabel, _params.graphLabel);
+        _lines.back().setPoints(std::move(points));
+
+        std::vector<Point> spectrum = makeSpectrum(state, c);
+        _spectra.emplace_back(spectrum.size(), ORD::DEFAULT_ORDER_LABEL,
+                              ORD::DEFAULT_AMPLITUDE_LABEL,
+                              ORD::DEFAULT_SPECTRUM_GRAPH_LABEL);
+        _spectra.back().setPoints(std::move(spectrum));
+    }
+    _segmentsCount = state.segmentsCount;
+
+    _isExecuted = true;
+}
+
+std::vector<std::vector<double>> TOrderTracker::processBlock(
+    const std::span<const double>               tachometer,
+    const std::vector<std::span<const double>>& channels) {
+    if (channels.empty()) {
+        throw SignalProcessingError("No vibration channels");
+    }
+    for (const auto& channel : channels) {
+        if (channel.size() != tachometer.size()) {
+            throw SignalProcessingError(
+                "Vibration and tachometer blocks should have the same size");
+        }
+    }
+    if (!_stream) {
+        _stream = makeState(channels.size(), _params.samplingFrequency);
+    } else if (_stream->histories.size() != channels.size()) {
+        throw SignalProcessingError(
+            "Number of channels differs from the first block");
+    }
+
+    std::vector<std::vector<double>> outputs;
+    track(*_stream, tachometer, channels, false, outputs);
+    return outputs;
+}
+
+std::vector<Point> TOrderTracker::getStreamOrderSpectrum(
+    const std::size_t channel) const {
+    if (!_stream) {
+        throw SignalProcessingError("No block has been processed");
+    }
+    if (channel >= _stream->powers.size()) {
+        throw SignalProcessingError("Channel index is out of range");
+    }
+    return makeSpectrum(*_stream, channel);
+}
+
+void TOrderTracker::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TOrderTracker::State TOrderTracker::makeState(
+    const std::size_t           channelsCount,
+    const std::optional<double> samplingFrequency) const {
+    const auto tachometer =
+        _params.tachometer.value_or(ORD::DEFAULT_TACHOMETER);
+    const double hysteresis =
+        _params.triggerHysteresis.value_or(ORD::DEFAULT_TRIGGER_HYSTERESIS);
+    if (tachometer == ORD::Tachometer::Pulses) {
+        if (!_params.triggerLevel) {
+            throw SignalProcessingError("Trigger level is not specified");
+        }
+        if (hysteresis < 0.0) {
+            throw SignalProcessingError(
+                "Trigger hysteresis should not be negative");
+        }
+        if (_params.pulsesPerRevolution.value_or(
+                ORD::DEFAULT_PULSES_PER_REVOLUTION) == 0) {
+            throw SignalProcessingError(
+                "Number of pulses per revolution should be positive");
+        }
+    } else if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError("Sampling frequency should be positive");
+    }
+    if (_params.samplesPerRevolution.value_or(
+            ORD::DEFAULT_SAMPLES_PER_REVOLUTION) == 0) {
+        throw SignalProcessingError(
+            "Number of samples per revolution should be positive");
+    }
+    if (_params.kernelHalfWidth.value_or(ORD::DEFAULT_KERNEL_HALF_WIDTH) == 0) {
+        throw SignalProcessingError("Kernel half width should be positive");
+    }
+    const std::size_t length =
+        _params.segmentLength.value_or(ORD::DEFAULT_SEGMENT_LENGTH);
+    if (length < 2 || !TFFT::isPowerOfTwo(length)) {
+        throw SignalProcessingError(
+            "Segment length should be a power of two (at least 2)");
+    }
+    const double overlap = _params.overlap.value_or(ORD::DEFAULT_OVERLAP);
+    if (overlap < 0.0 || overlap >= 1.0) {
+        throw SignalProcessingError("Overlap should be within [0, 1)");
+    }
+
+    const double   level = _params.triggerLevel.value_or(0.0);
+    TEventDetector detector(TEventDetectorParams{
+        .upperThreshold = level, .lowerThreshold = level - hysteresis});
+    State state{.detector = std::move(detector),
+                .fft      = TFFT(length),
+                .window   = WIN::makeWindow(
+                    _params.window.value_or(ORD::DEFAULT_WINDOW), length),
+                .samplingFrequency = samplingFrequency.value_or(0.0)};
+    state.histories.resize(channelsCount);
+    state.pending.resize(channelsCount);
+    state.powers.assign(channelsCount,
+                        std::vector<double>(length / 2 + 1, 0.0));
+    return state;
+}
+
+void TOrderTracker::track(
+    State&                                      state,
+    const std::span<const double>               tachometer,
+    const std::vector<std::span<const double>>& channels,
+    const bool                                  isFinal,
+    std::vector<std::vector<double>>&           outputs) const {
+    const std::size_t channelsCount = channels.size();
+    const std::size_t halfWidth =
+        _params.kernelHalfWidth.value_or(ORD::DEFAULT_KERNEL_HALF_WIDTH);
+    const auto samplesPerRevolution = static_cast<double>(
+        _params.samplesPerRevolution.value_or(
+            ORD::DEFAULT_SAMPLES_PER_REVOLUTION));
+
+    addKnots(state, tachometer, isFinal);
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        state.histories[c].insert(state.histories[c].end(),
+                                  channels[c].begin(), channels[c].end());
+    }
+    state.end += tachometer.size();
+
+    // Positions and kernel weights are shared by all channels
+    const std::size_t   width = 2 * halfWidth;
+    std::vector<double> weights;
+    std::vector<std::size_t> firsts;
+    std::vector<std::size_t> counts;
+    std::size_t              knot = 0;
+    while (true) {
+        const double angle =
+            static_cast<double>(state.outputsCount) / samplesPerRevolution;
+        while (knot + 2 < state.slopes.size() &&
+               state.angles[knot + 1] < angle) {
+            ++knot;
+        }
+        if (knot + 1 >= state.slopes.size() ||
+            state.angles[knot + 1] < angle) {
+            break;
+        }
+
+        const double rise     = state.angles[knot + 1] - state.angles[knot];
+        const double duration = state.positions[knot + 1] -
+                                state.positions[knot];
+        const double t        = solveHermite(
+            (angle - state.angles[knot]) / rise,
+            state.slopes[knot] * duration / rise,
+            state.slopes[knot + 1] * duration / rise);
+        const double position = state.positions[knot] + t * duration;
+
+        const auto center = static_cast<std::ptrdiff_t>(std::floor(position));
+        const auto kernelEnd =
+            center + static_cast<std::ptrdiff_t>(halfWidth) + 1;
+        if (!isFinal && kernelEnd > static_cast<std::ptrdiff_t>(state.end)) {
+            break;
+        }
+        const std::ptrdiff_t first = std::max(
+            center - static_cast<std::ptrdiff_t>(halfWidth) + 1,
+            static_cast<std::ptrdiff_t>(state.start));
+        const std::ptrdiff_t last =
+            std::min(kernelEnd, static_cast<std::ptrdiff_t>(state.end));
+
+        const std::size_t offset = weights.size();
+        double            sum    = 0.0;
+        weights.resize(offset + width, 0.0);
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+            const double weight =
+                FDES::lanczos(position - static_cast<double>(i),
+                              static_cast<double>(halfWidth));
+            weights[offset + static_cast<std::size_t>(i - first)] = weight;
+            sum += weight;
+        }
+        for (std::size_t n = 0; n < width; ++n) {
+            weights[offset + n] /= sum;
+        }
+        firsts.push_back(static_cast<std::size_t>(first) - state.start);
+        counts.push_back(static_cast<std::size_t>(last - first));
+        state.position = position;
+        ++state.outputsCount;
+    }
+
+    const std::size_t outputsCount = firsts.size();
+    outputs.assign(channelsCount, std::vector<double>(outputsCount));
+    PAR::parallelFor(
+        channelsCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                const double* history = state.histories[c].data();
+                for (std::size_t j = 0; j < outputsCount; ++j) {
+                    const double* samples = history + firsts[j];
+                    const double* kernel  = weights.data() + j * width;
+                    double        value   = 0.0;
+                    for (std::size_t n = 0; n < counts[j]; ++n) {
+                        value += kernel[n] * samples[n];
+                    }
+                    outputs[c][j] = value;
+                }
+            }
+        },
+        _params.threadsCount);
+
+    // Knots and samples behind the next angle sample are no longer needed
+    const auto shift = static_cast<std::ptrdiff_t>(knot);
+    state.positions.erase(state.positions.begin(),
+                          state.positions.begin() + shift);
+    state.angles.erase(state.angles.begin(), state.angles.begin() + shift);
+    state.slopes.erase(state.slopes.begin(), state.slopes.begin() + shift);
+
+    double bound = static_cast<double>(state.end) - 1.0;
+    if (state.position) {
+        bound = *state.position;
+    } else if (!state.positions.empty()) {
+        bound = state.positions.front();
+    }
+    const auto keep = static_cast<std::size_t>(std::max<std::ptrdiff_t>(
+        static_cast<std::ptrdiff_t>(state.start),
+        static_cast<std::ptrdiff_t>(std::floor(bound)) -
+            static_cast<std::ptrdiff_t>(halfWidth) + 1));
+    for (auto& history : state.histories) {
+        history.erase(history.begin(),
+                      history.begin() +
+                          static_cast<std::ptrdiff_t>(keep - state.start));
+    }
+    state.start = keep;
+
+    for (std::size_t c = 0; c < channelsCount; ++c) {
+        state.pending[c].insert(state.pending[c].end(), outputs[c].begin(),
+                                outputs[c].end());
+    }
+    accumulateSpectra(state);
+}
+
+void TOrderTracker::addKnots(State&                        state,
+                             const std::span<const double> tachometer,
+                             const bool                    isFinal) const {
+    if (_params.tachometer.value_or(ORD::DEFAULT_TACHOMETER) ==
+        ORD::Tachometer::Speed) {
+        for (std::size_t i = 0; i < tachometer.size(); ++i) {
+            const double speed = tachometer[i];
+            if (!(speed > 0.0)) {
+                throw SignalProcessingError("Shaft speed should be positive");
+            }
+            const std::size_t index = state.end + i;
+            double            angle = 0.0;
+            if (index > 0) {
+                angle = state.angles.back() + 0.5 * (state.speed + speed) /
+                                                  state.samplingFrequency;
+            }
+            state.positions.push_back(static_cast<double>(index));
+            state.angles.push_back(angle);
+            state.slopes.push_back(speed / state.samplingFrequency);
+            state.speed = speed;
+        }
+        return;
+    }
+
+    const auto pulsesPerRevolution = static_cast<double>(
+        _params.pulsesPerRevolution.value_or(
+            ORD::DEFAULT_PULSES_PER_REVOLUTION));
+    auto secant = [&state](const std::size_t knot) {
+        return (state.angles[knot + 1] - state.angles[knot]) /
+               (state.positions[knot + 1] - state.positions[knot]);
+    };
+
+    // The slope at a pulse needs the next pulse, so it is resolved one pulse
+    // later
+    for (const TEvent& event : state.detector.processBlock(tachometer)) {
+        state.positions.push_back(event.time);
+        state.angles.push_back(static_cast<double>(state.pulsesCount) /
+                               pulsesPerRevolution);
+        ++state.pulsesCount;
+        const std::size_t last = state.positions.size() - 1;
+        if (state.pulsesCount == 2) {
+            state.slopes.push_back(secant(0));
+        } else if (state.pulsesCount > 2) {
+            const double before = secant(last - 2);
+            const double after  = secant(last - 1);
+            state.slopes.push_back(2.0 * before * after / (before + after));
+        }
+    }
+    if (isFinal && state.positions.size() >= 2 &&
+        state.slopes.size() + 1 == state.positions.size()) {
+        state.slopes.push_back(secant(state.positions.size() - 2));
+    }
+}
+
+void TOrderTracker::accumulateSpectra(State& state) const {
+    const std::size_t length    = state.fft.getSize();
+    const std::size_t binsCount = length / 2 + 1;
+    const double overlap = _params.overlap.value_or(ORD::DEFAULT_OVERLAP);
+    const std::size_t hop = std::max<std::size_t>(
+        1, length - static_cast<std::size_t>(
+                        std::lround(overlap * static_cast<double>(length))));
+    const std::size_t available = state.pending.front().size();
+    if (available < length) {
+        return;
+    }
+    const std::size_t segmentsCount = 1 + (available - length) / hop;
+
+    PAR::parallelFor(
+        state.pending.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            std::vector<double>               batch;
+            std::vector<std::complex<double>> spectra;
+            for (std::size_t c = begin; c < end; ++c) {
+                const std::vector<double>& samples = state.pending[c];
+                for (std::size_t first = 0; first < segmentsCount;
+                     first += ORD::SEGMENTS_PER_BATCH) {
+                    const std::size_t count = std::min(ORD::SEGMENTS_PER_BATCH,
+                                                       segmentsCount - first);
+                    batch.resize(count * length);
+                    for (std::size_t s = 0; s < count; ++s) {
+                        const double* segment =
+                            samples.data() + (first + s) * hop;
+                        double mean = 0.0;
+                        for (std::size_t i = 0; i < length; ++i) {
+                            mean += segment[i];
+                        }
+                        mean /= static_cast<double>(length);
+                        for (std::size_t i = 0; i < length; ++i) {
+                            batch[s * length + i] =
+                                (segment[i] - mean) * state.window[i];
+                        }
+                    }
+                    state.fft.forwardRealBatch(batch, count, spectra);
+                    for (std::size_t s = 0; s < count; ++s) {
+                        for (std::size_t k = 0; k < binsCount; ++k) {
+                            state.powers[c][k] +=
+                                std::norm(spectra[s * binsCount + k]);
+                        }
+                    }
+                }
+            }
+        },
+        _params.threadsCount);
+
+    const auto consumed = static_cast<std::ptrdiff_t>(segmentsCount * hop);
+    for (auto& samples : state.pending) {
+        samples.erase(samples.begin(), samples.begin() + consumed);
+    }
+    state.segmentsCount += segmentsCount;
+}
+
+std::vector<Point> TOrderTracker::makeSpectrum(
+    const State&      state,
+    const std::size_t channel) const {
+    const std::size_t length    = state.fft.getSize();
+    const std::size_t binsCount = length / 2 + 1;
+    const auto        samplesPerRevolution = static_cast<double>(
+        _params.samplesPerRevolution.value_or(
+            ORD::DEFAULT_SAMPLES_PER_REVOLUTION));
+
+    // Peak amplitude scaling: 2 / sum(w), except at zero and Nyquist orders
+    double windowSum = 0.0;
+    for (const double value : state.window) {
+        windowSum += value;
+    }
+    std::vector<Point> spectrum(binsCount);
+    for (std::size_t k = 0; k < binsCount; ++k) {
+        const double power =
+            state.segmentsCount > 0
+                ? state.powers[channel][k] /
+                      static_cast<double>(state.segmentsCount)
+                : 0.0;
+        const double factor = (k == 0 || k == binsCount - 1) ? 1.0 : 2.0;
+        spectrum[k] = Point{.x = static_cast<double>(k) * samplesPerRevolution /
+                                 static_cast<double>(length),
+                            .y = factor * std::sqrt(power) / windowSum};
+    }
+    return spectrum;
+}
\ No newline at end of file
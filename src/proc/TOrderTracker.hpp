@@ -0,0 +1,407 @@
+/**
+ * @file TOrderTracker.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TOrderTracker class resampling
+ * vibration lines onto uniform shaft angle increments and computing their
+ * order spectra.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TEventDetector.hpp"
+#include "TFFT.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace ORD
+ * @brief Contains tachometer types and default parameters used for order
+ * tracking.
+ */
+namespace ORD {
+
+    /**
+     * @enum Tachometer
+     * @brief Specifies how the tachometer line encodes the shaft rotation.
+     */
+    enum class Tachometer : std::uint8_t {
+        Pulses,  ///< Pulse train with a fixed number of pulses per revolution.
+        Speed    ///< Shaft speed in revolutions per second.
+    };
+
+    static constexpr auto DEFAULT_TACHOMETER =
+        Tachometer::Pulses;  ///< Default tachometer type.
+    static constexpr std::size_t DEFAULT_PULSES_PER_REVOLUTION =
+        1;  ///< Default number of tachometer pulses per revolution.
+    static constexpr double DEFAULT_TRIGGER_HYSTERESIS =
+        0.0;  ///< Default hysteresis of the pulse trigger.
+    static constexpr std::size_t DEFAULT_SAMPLES_PER_REVOLUTION =
+        64;  ///< Default number of angle samples per revolution.
+    static constexpr std::size_t DEFAULT_KERNEL_HALF_WIDTH =
+        8;  ///< Default half width of the interpolation kernel, in samples.
+    static constexpr std::size_t DEFAULT_SEGMENT_LENGTH =
+        1024;  ///< Default number of angle samples per spectrum segment (a
+               ///< power of two).
+    static constexpr double DEFAULT_OVERLAP =
+        0.5;  ///< Default fraction of overlap between adjacent segments.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Hann;  ///< Default segment window.
+    static const std::string DEFAULT_ANGLE_LABEL =
+        "Revolutions";  ///< Default label for the x-axis of angle lines.
+    static const std::string DEFAULT_ORDER_LABEL =
+        "Order";  ///< Default label for the x-axis of order spectra.
+    static const std::string DEFAULT_AMPLITUDE_LABEL =
+        "Amplitude";  ///< Default label for the y-axis of order spectra.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Angle Domain Signal";  ///< Default graph label of angle lines.
+    static const std::string DEFAULT_SPECTRUM_GRAPH_LABEL =
+        "Order Spectrum";  ///< Default graph label of order spectra.
+
+    // Kernel parameters
+    static constexpr std::size_t SEGMENTS_PER_BATCH =
+        16;  ///< Number of segments transformed together.
+    static constexpr std::size_t MAX_SOLVER_ITERATIONS =
+        50;  ///< Maximal number of Newton steps locating an angle sample.
+
+}  // namespace ORD
+
+/**
+ * @struct TOrderTrackerParams
+ * @brief Contains parameters used for order tracking.
+ */
+struct TOrderTrackerParams {
+    // Signal Parameters
+    std::vector<const TSignalLine*>
+        signalLines;  ///< Pointers to the vibration signal lines (not needed
+                      ///< for streaming).
+    const TSignalLine* tachometerLine =
+        nullptr;  ///< Pointer to the tachometer signal line (same points
+                  ///< count; not needed for streaming).
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Sampling frequency of streams (needed for a speed
+                       ///< tachometer). If not set, the one of the tachometer
+                       ///< line is used.
+
+    // Calculation Parameters
+    std::optional<ORD::Tachometer> tachometer =
+        ORD::DEFAULT_TACHOMETER;  ///< Tachometer type.
+    std::optional<double> triggerLevel =
+        std::nullopt;  ///< Level at which a pulse starts (required for a pulse
+                       ///< tachometer).
+    std::optional<double> triggerHysteresis =
+        ORD::DEFAULT_TRIGGER_HYSTERESIS;  ///< Drop below the trigger level
+                                          ///< that ends a pulse.
+    std::optional<std::size_t> pulsesPerRevolution =
+        ORD::DEFAULT_PULSES_PER_REVOLUTION;  ///< Pulses per revolution.
+    std::optional<std::size_t> samplesPerRevolution =
+        ORD::DEFAULT_SAMPLES_PER_REVOLUTION;  ///< Angle samples per revolution.
+    std::optional<std::size_t> kernelHalfWidth =
+        ORD::DEFAULT_KERNEL_HALF_WIDTH;  ///< Half width of the interpolation
+                                         ///< kernel, in samples.
+    std::optional<std::size_t> segmentLength =
+        ORD::DEFAULT_SEGMENT_LENGTH;  ///< Angle samples per spectrum segment
+                                      ///< (a power of two).
+    std::optional<double> overlap =
+        ORD::DEFAULT_OVERLAP;  ///< Fraction of overlap within [0, 1).
+    std::optional<WIN::WindowType> window =
+        ORD::DEFAULT_WINDOW;  ///< Segment window.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis of angle lines.
+    std::optional<std::string> graphLabel =
+        ORD::DEFAULT_GRAPH_LABEL;  ///< Label for the graph of angle lines.
+};
+
+/**
+ * @class TOrderTracker
+ * @brief Class for computed order tracking: resampling vibration lines of a
+ * machine with varying speed onto uniform shaft angle increments and
+ * estimating their order spectra.
+ *
+ * @details The shaft angle is known at knots: at every tachometer pulse
+ * (found by a TEventDetector with sub-sample timing; the first pulse is angle
+ * zero) or at every sample of a speed profile (trapezoidal integration of the
+ * speed; the first sample is angle zero). Between the knots the angle is a
+ * monotone cubic Hermite curve; the slopes at the pulses are the harmonic means
+ * of the adjacent secants (Fritsch-Butland), so the curve follows the
+ * acceleration without overshoot.
+ *
+ * Every angle sample `j / samplesPerRevolution` is mapped back to a fractional
+ * sample position by solving the Hermite cubic (safeguarded Newton steps), and
+ * the vibration is interpolated there with a Lanczos-windowed sinc kernel of
+ * `2 * kernelHalfWidth` taps normalized to unit sum. The kernel weights do not
+ * depend on the channel, so they are computed once and the channels are then
+ * interpolated on several threads. The angle rate should keep the highest
+ * order of interest below `samplesPerRevolution / 2`; higher orders alias.
+ *
+ * The order spectrum of every channel is averaged over segments of
+ * `segmentLength` angle samples (Welch's method in the angle domain, mean
+ * removed, windowed); its bins are `k * samplesPerRevolution / segmentLength`
+ * orders apart and hold the RMS-averaged peak amplitude.
+ *
+ * Streams are tracked block by block by `processBlock()`. With a pulse
+ * tachometer the angle between two pulses is resolved one pulse later, and
+ * every angle sample waits for the `kernelHalfWidth` samples after it, so the
+ * output lags the input. The spectra are accumulated as segments complete.
+ */
+class TOrderTracker {
+   public:
+    /**
+     * @brief Constructs a TOrderTracker with vibration lines and a tachometer.
+     *
+     * @param signalLines Pointers to the vibration signal lines.
+     * @param tachometerLine Pointer to the tachometer signal line.
+     * @param tachometer Tachometer type.
+     * @param triggerLevel Level at which a pulse starts (pulse tachometer).
+     * @param samplesPerRevolution Angle samples per revolution.
+     */
+    TOrderTracker(std::vector<const TSignalLine*> signalLines,
+                  const TSignalLine*              tachometerLine,
+                  std::optional<ORD::Tachometer>  tachometer =
+                      ORD::DEFAULT_TACHOMETER,
+                  std::optional<double>      triggerLevel = std::nullopt,
+                  std::optional<std::size_t> samplesPerRevolution =
+                      ORD::DEFAULT_SAMPLES_PER_REVOLUTION);
+
+    /**
+     * @brief Constructs a TOrderTracker with tracking parameters.
+     *
+     * @param params Structure containing the parameters of the tracker.
+     */
+    explicit TOrderTracker(TOrderTrackerParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TOrderTracker() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TOrderTracker(const TOrderTracker&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TOrderTracker(TOrderTracker&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TOrderTracker& operator=(const TOrderTracker&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TOrderTracker& operator=(TOrderTracker&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the angle domain line of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const TSignalLine* A pointer to the line; its x coordinates are
+     * revolutions.
+     *
+     * @throw SignalProcessingError If the tracker has not been executed or if
+     * the index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine(std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the order spectrum of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return const TSignalLine* A pointer to the spectrum; its x coordinates
+     * are orders.
+     *
+     * @throw SignalProcessingError If the tracker has not been executed or if
+     * the index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getOrderSpectrum(
+        std::size_t channel) const;
+
+    /**
+     * @brief Retrieves the number of averaged spectrum segments.
+     *
+     * @return std::size_t The number of segments.
+     *
+     * @throw SignalProcessingError If the tracker has not been executed.
+     */
+    [[nodiscard]] std::size_t getSegmentsCount() const;
+
+    /**
+     * @brief Retrieves the parameters of the tracker.
+     *
+     * @return const TOrderTrackerParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TOrderTrackerParams& getParams() const;
+
+    /**
+     * @brief Determines if the tracker has been executed.
+     *
+     * @return bool True if the tracker has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Tracks the whole signal lines.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If there are no vibration lines, if a line
+     * is null, if the points counts differ, if fewer than two pulses are found,
+     * if the lines are too short for one spectrum segment, or if the
+     * parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param tachometer Next tachometer samples.
+     * @param channels Next vibration samples of every channel (as many as
+     * tachometer samples).
+     * @return std::vector<std::vector<double>> Angle samples of every channel
+     * resolved by this block.
+     *
+     * @throws SignalProcessingError If there are no channels, if the number of
+     * channels differs from the first block, if a block size does not match,
+     * or if the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<std::vector<double>> processBlock(
+        std::span<const double>                     tachometer,
+        const std::vector<std::span<const double>>& channels);
+
+    /**
+     * @brief Retrieves the order spectrum of a streamed channel so far.
+     *
+     * @param channel Index of the channel.
+     * @return std::vector<Point> The spectrum as (order, amplitude) points
+     * (zero amplitudes before the first complete segment).
+     *
+     * @throw SignalProcessingError If the index is out of bounds or no block
+     * has been processed.
+     */
+    [[nodiscard]] std::vector<Point> getStreamOrderSpectrum(
+        std::size_t channel) const;
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Tracking state shared by whole-line and streaming processing.
+     */
+    struct State {
+        TEventDetector      detector;  ///< Pulse detector (pulse tachometer).
+        TFFT                fft;       ///< Plan of the segment transform.
+        std::vector<double> window = {};  ///< Segment window.
+        double samplingFrequency   = 0.0;  ///< Sampling frequency of the
+                                           ///< input (speed tachometer).
+        std::vector<double> positions =
+            {};  ///< Sample positions of the retained knots.
+        std::vector<double> angles = {};  ///< Angles of the retained knots.
+        std::vector<double> slopes =
+            {};  ///< Slopes (revolutions per sample) of the knots resolved so
+                 ///< far.
+        std::size_t pulsesCount = 0;    ///< Number of pulses found so far.
+        double      speed       = 0.0;  ///< Last speed sample.
+        std::vector<std::vector<double>> histories =
+            {};  ///< Retained vibration samples of every channel.
+        std::size_t start = 0;  ///< Index of the first retained sample.
+        std::size_t end   = 0;  ///< Number of samples processed.
+        std::size_t outputsCount = 0;  ///< Number of angle samples produced.
+        std::optional<double> position =
+            std::nullopt;  ///< Sample position of the last angle sample.
+        std::vector<std::vector<double>> pending =
+            {};  ///< Angle samples of every channel awaiting a segment.
+        std::vector<std::vector<double>> powers =
+            {};  ///< Sums of the squared segment spectra of every channel.
+        std::size_t segmentsCount = 0;  ///< Number of averaged segments.
+    };
+
+    std::vector<TSignalLine> _lines   = {};  ///< Angle lines of the channels.
+    std::vector<TSignalLine> _spectra = {};  ///< Order spectra of the
+                                             ///< channels.
+    std::size_t         _segmentsCount = 0;   ///< Number of averaged segments.
+    TOrderTrackerParams _params        = {};  ///< Parameters of the tracker.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the tracker has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh state.
+     *
+     * @param channelsCount Number of channels.
+     * @param samplingFrequency Sampling frequency of the input (speed
+     * tachometer only).
+     * @return State The initial state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState(
+        std::size_t           channelsCount,
+        std::optional<double> samplingFrequency) const;
+
+    /**
+     * @brief Tracks all channels over a run of samples.
+     *
+     * @param state State to continue from; updated in place.
+     * @param tachometer Tachometer samples.
+     * @param channels Vibration samples of every channel.
+     * @param isFinal True if no samples follow (the last knot is resolved and
+     * the kernel is truncated at the end).
+     * @param outputs Receives the angle samples of every channel.
+     */
+    void track(State&                                      state,
+               std::span<const double>                     tachometer,
+               const std::vector<std::span<const double>>& channels,
+               bool                                        isFinal,
+               std::vector<std::vector<double>>&           outputs) const;
+
+    /**
+     * @brief Appends the knots found in a run of tachometer samples.
+     *
+     * @param state State to update.
+     * @param tachometer Tachometer samples.
+     * @param isFinal True if no samples follow.
+     */
+    void addKnots(State&                  state,
+                  std::span<const double> tachometer,
+                  bool                    isFinal) const;
+
+    /**
+     * @brief Transforms the complete segments of the pending angle samples
+     * and adds their power spectra to the sums.
+     *
+     * @param state State to update.
+     */
+    void accumulateSpectra(State& state) const;
+
+    /**
+     * @brief Derives the order spectrum of a channel from the power sums.
+     *
+     * @param state State holding the sums.
+     * @param channel Index of the channel.
+     * @return std::vector<Point> The spectrum as (order, amplitude) points.
+     */
+    [[nodiscard]] std::vector<Point> makeSpectrum(const State& state,
+                                                  std::size_t  channel) const;
+};
\ No newline at end of file
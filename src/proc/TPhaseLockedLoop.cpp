@@ -0,0 +1,354 @@
+/**
+ * @file TPhaseLockedLoop.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TPhaseLockedLoop class tracking
+ * the frequency and phase of drifting tones.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TPhaseLockedLoop.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /// Labels for the y-axes of the results, indexed by PLL::Result
+    const std::array<std::string, PLL::RESULTS_COUNT> Y_LABELS = {
+        "Frequency", "Phase", "Lock"};
+
+    /**
+     * @brief Wraps a phase into [-pi, pi].
+     *
+     * @details The loops step by less than a turn per sample, so one
+     * compare-and-subtract suffices; larger steps fall back to the remainder.
+     *
+     * @param phase The phase, in radians.
+     * @return double The wrapped phase.
+     */
+    double wrapPhase(double phase) {
+        constexpr double TWO_PI = 2.0 * std::numbers::pi;
+        if (phase > std::numbers::pi) {
+            phase -= TWO_PI;
+        } else if (phase < -std::numbers::pi) {
+            phase += TWO_PI;
+        }
+        return std::abs(phase) <= std::numbers::pi
+                   ? phase
+                   : std::remainder(phase, TWO_PI);
+    }
+
+    /**
+     * @brief Computes the distance of a mixing product from zero frequency,
+     * aliased by the sampling frequency.
+     *
+     * @param frequency The frequency of the product, in Hertz.
+     * @param samplingFrequency The sampling frequency, in Hertz.
+     * @return double The distance, in Hertz.
+     */
+    double aliasedDistance(const double frequency,
+                           const double samplingFrequency) {
+        return std::abs(std::remainder(frequency, samplingFrequency));
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TPhaseLockedLoop::TPhaseLockedLoop(
+    const TSignalLine*          signalLine,
+    std::vector<double>         frequencies,
+    const std::optional<double> loopBandwidth,
+    const std::optional<double> frequencyLoopBandwidth,
+    std::optional<std::string>  xLabel,
+    std::optional<std::string>  graphLabel)
+    : _params{.signalLine             = signalLine,
+              .frequencies            = std::move(frequencies),
+              .loopBandwidth          = loopBandwidth,
+              .frequencyLoopBandwidth = frequencyLoopBandwidth,
+              .xLabel                 = std::move(xLabel),
+              .graphLabel             = std::move(graphLabel)} {}
+
+TPhaseLockedLoop::TPhaseLockedLoop(TPhaseLockedLoopParams params)
+    : _params(std::move(params)) {}
+
+const TSignalLine* TPhaseLockedLoop::getSignalLine(
+    const PLL::Result result,
+    const std::size_t tone) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Phase-locked loop not executed");
+    }
+    if (tone >= _params.frequencies.size()) {
+        throw SignalProcessingError("Tone index is out of range");
+    }
+    return &_lines[tone * PLL::RESULTS_COUNT +
+                   static_cast<std::size_t>(result)];
+}
+
+const TPhaseLockedLoopParams& TPhaseLockedLoop::getParams() const {
+    return _params;
+}
+
+bool TPhaseLockedLoop::isExecuted() const {
+    return _isExecuted;
+}
+
+void TPhaseLockedLoop::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TPhaseLockedLoop object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    State               state = makeState(resolveSamplingFrequency());
+    std::vector<double> samples(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        samples[i] = points[i].y;
+    }
+    const std::vector<TToneTrack> tracks = track(state, samples);
+
+    _lines.clear();
+    _lines.reserve(tracks.size() * PLL::RESULTS_COUNT);
+    for (const TToneTrack& tones : tracks) {
+        for (std::size_t r = 0; r < PLL::RESULTS_COUNT; ++r) {
+            std::vector<Point> outputPoints(pointsCount);
+            for (std::size_t i = 0; i < pointsCount; ++i) {
+                double value = tones.frequency[i];
+                if (r == static_cast<std::size_t>(PLL::Result::Phase)) {
+                    value = tones.phase[i];
+                } else if (r == static_cast<std::size_t>(PLL::Result::Lock)) {
+                    value = static_cast<double>(tones.lock[i]);
+                }
+                outputPoints[i] = Point{.x = points[i].x, .y = value};
+            }
+
+            TSignalLineParams slParams = _params.signalLine->getParams();
+            slParams.xLabel            = _params.xLabel;
+            slParams.yLabel            = Y_LABELS[r];
+            slParams.graphLabel        = _params.graphLabel;
+            slParams.pointsCount       = pointsCount;
+            _lines.emplace_back(slParams, SL::Preference::PreferPointsCount);
+            _lines.back().setPoints(std::move(outputPoints));
+        }
+    }
+
+    _isExecuted = true;
+}
+
+std::vector<TToneTrack> TPhaseLockedLoop::processBlock(
+    const std::span<const double> samples) {
+    if (!_stream) {
+        _stream = makeState(resolveSamplingFrequency());
+    }
+    return track(*_stream, samples);
+}
+
+void TPhaseLockedLoop::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+double TPhaseLockedLoop::resolveSamplingFrequency() const {
+    std::optional<double> samplingFrequency = _params.samplingFrequency;
+    if (!samplingFrequency && _params.signalLine != nullptr) {
+        samplingFrequency = _params.signalLine->getParams().samplingFrequency;
+    }
+    if (!samplingFrequency || *samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Sampling frequency should be set and positive");
+    }
+    return *samplingFrequency;
+}
+
+TPhaseLockedLoop::State TPhaseLockedLoop::makeState(
+    const double samplingFrequency) const {
+    if (_params.frequencies.empty()) {
+        throw SignalProcessingError("No tones to track");
+    }
+    const double damping =
+        _params.dampingFactor.value_or(PLL::DEFAULT_DAMPING_FACTOR);
+    const double frequencyLoopBandwidth =
+        _params.frequencyLoopBandwidth.value_or(
+            PLL::DEFAULT_FREQUENCY_LOOP_BANDWIDTH);
+    const double threshold =
+        _params.lockThreshold.value_or(PLL::DEFAULT_LOCK_THRESHOLD);
+    if ((_params.loopBandwidth && *_params.loopBandwidth <= 0.0) ||
+        frequencyLoopBandwidth < 0.0) {
+        throw SignalProcessingError(
+            "Loop bandwidths should be positive (the frequency loop may be "
+            "disabled by zero)");
+    }
+    if (damping <= 0.0) {
+        throw SignalProcessingError("Damping factor should be positive");
+    }
+    if (threshold <= 0.0 || threshold >= 1.0) {
+        throw SignalProcessingError("Lock threshold should be within (0, 1)");
+    }
+    if (_params.armBandwidth && (*_params.armBandwidth <= 0.0 ||
+                                 *_params.armBandwidth >=
+                                     0.5 * samplingFrequency)) {
+        throw SignalProcessingError(
+            "Arm bandwidth should be within (0, fs / 2)");
+    }
+
+    // Nearest mixing product of every tone: the double frequency, or the sum
+    // or difference with another tone
+    const auto&         frequencies = _params.frequencies;
+    std::vector<double> nearest(frequencies.size());
+    for (std::size_t t = 0; t < frequencies.size(); ++t) {
+        nearest[t] = aliasedDistance(2.0 * frequencies[t], samplingFrequency);
+        for (std::size_t o = 0; o < frequencies.size(); ++o) {
+            if (o != t) {
+                nearest[t] = std::min(
+                    {nearest[t],
+                     aliasedDistance(frequencies[o] - frequencies[t],
+                                     samplingFrequency),
+                     aliasedDistance(frequencies[o] + frequencies[t],
+                                     samplingFrequency)});
+            }
+        }
+    }
+
+    // The default loop is narrowed so that the arm filters of the closest
+    // tone fit between it and the nearest product
+    const double loopBandwidth = _params.loopBandwidth.value_or(std::min(
+        PLL::DEFAULT_LOOP_BANDWIDTH,
+        std::ranges::min(nearest) / PLL::ARM_SEPARATION_RATIO /
+            PLL::MIN_ARM_BANDWIDTH_RATIO));
+
+    // Digital second-order loop: theta = Bn * T / (zeta + 1 / (4 * zeta))
+    const double theta = loopBandwidth / samplingFrequency /
+                         (damping + 0.25 / damping);
+    const double denominator = 1.0 + 2.0 * damping * theta + theta * theta;
+    const auto pole = [samplingFrequency](const double bandwidth) {
+        return 1.0 - std::exp(-2.0 * std::numbers::pi * bandwidth /
+                              samplingFrequency);
+    };
+
+    State state{
+        .proportionalGain   = 4.0 * damping * theta / denominator,
+        .integralGain       = 4.0 * theta * theta / denominator,
+        .frequencyGain      = 4.0 * frequencyLoopBandwidth / samplingFrequency,
+        .averageCoefficient = pole(loopBandwidth),
+        .lockThreshold      = threshold,
+        .samplingFrequency  = samplingFrequency};
+
+    // The arm filters of every tone stay clear of its nearest mixing product
+    // and well above the loop bandwidth
+    const double widestLoop = std::max(loopBandwidth, frequencyLoopBandwidth);
+    state.tones.resize(frequencies.size());
+    for (std::size_t t = 0; t < state.tones.size(); ++t) {
+        const double armBandwidth = _params.armBandwidth.value_or(
+            std::min(PLL::DEFAULT_ARM_BANDWIDTH_RATIO * widestLoop,
+                     nearest[t] / PLL::ARM_SEPARATION_RATIO));
+        // Compared the way they are derived, so that the bounds themselves
+        // pass despite rounding
+        if (armBandwidth <= 0.0 ||
+            armBandwidth > nearest[t] / PLL::ARM_SEPARATION_RATIO ||
+            armBandwidth / PLL::MIN_ARM_BANDWIDTH_RATIO < widestLoop) {
+            throw SignalProcessingError(
+                "Tone at " + std::to_string(frequencies[t]) +
+                " Hz is too close to another tone, to zero or to the Nyquist "
+                "frequency for the loop bandwidth; lower the loop bandwidth");
+        }
+        state.tones[t].frequency =
+            2.0 * std::numbers::pi * frequencies[t] / samplingFrequency;
+        state.tones[t].armCoefficient = pole(armBandwidth);
+    }
+    return state;
+}
+
+std::vector<TToneTrack> TPhaseLockedLoop::track(
+    State&                        state,
+    const std::span<const double> samples) const {
+    const std::size_t samplesCount = samples.size();
+    const double      toHertz =
+        state.samplingFrequency / (2.0 * std::numbers::pi);
+    const bool isAssisted = state.frequencyGain > 0.0;
+
+    std::vector<TToneTrack> tracks(state.tones.size());
+    PAR::parallelFor(
+        state.tones.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t t = begin; t < end; ++t) {
+                // The loop runs on a local copy: neighbouring tones share
+                // cache lines
+                Tone        tone   = state.tones[t];
+                TToneTrack& result = tracks[t];
+                result.frequency.resize(samplesCount);
+                result.phase.resize(samplesCount);
+                result.lock.resize(samplesCount);
+
+                constexpr std::size_t last = PLL::ARM_FILTER_ORDER - 1;
+                for (std::size_t n = 0; n < samplesCount; ++n) {
+                    const double previousI = tone.inPhase[last];
+                    const double previousQ = tone.quadrature[last];
+
+                    // Mixing with the oscillator and arm filtering
+                    double inPhase    = samples[n] * std::cos(tone.phase);
+                    double quadrature = -samples[n] * std::sin(tone.phase);
+                    for (std::size_t k = 0; k < PLL::ARM_FILTER_ORDER; ++k) {
+                        tone.inPhase[k] +=
+                            tone.armCoefficient * (inPhase - tone.inPhase[k]);
+                        tone.quadrature[k] += tone.armCoefficient *
+                                              (quadrature - tone.quadrature[k]);
+                        inPhase    = tone.inPhase[k];
+                        quadrature = tone.quadrature[k];
+                    }
+
+                    const double error = std::atan2(quadrature, inPhase);
+                    tone.frequency += state.integralGain * error;
+                    if (isAssisted) {
+                        const double rotation = std::atan2(
+                            previousI * quadrature - previousQ * inPhase,
+                            previousI * inPhase + previousQ * quadrature);
+                        tone.frequency += state.frequencyGain * rotation;
+                    }
+
+                    const double magnitude =
+                        std::sqrt(inPhase * inPhase + quadrature * quadrature);
+                    const double cosine =
+                        magnitude > 0.0 ? inPhase / magnitude : 0.0;
+                    tone.lock +=
+                        state.averageCoefficient * (cosine - tone.lock);
+                    tone.error +=
+                        state.averageCoefficient * (error - tone.error);
+
+                    const double frequency =
+                        tone.frequency + state.proportionalGain * error;
+                    result.frequency[n] =
+                        (tone.frequency + state.proportionalGain * tone.error) *
+                        toHertz;
+                    result.phase[n] = wrapPhase(tone.phase + error);
+                    result.lock[n] = tone.lock > state.lockThreshold ? 1 : 0;
+                    tone.phase     = wrapPhase(tone.phase + frequency);
+                }
+                state.tones[t] = tone;
+            }
+        },
+        _params.threadsCount);
+    return tracks;
+}
\ No newline at end of file
@@ -0,0 +1,347 @@
+/**
+ * @file TPhaseLockedLoop.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TPhaseLockedLoop class tracking the
+ * frequency and phase of drifting tones.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace PLL
+ * @brief Contains result types and default parameters used for phase-locked
+ * tracking.
+ */
+namespace PLL {
+
+    /**
+     * @enum Result
+     * @brief Enumerates the produced signal lines of every tone.
+     */
+    enum class Result : std::uint8_t {
+        Frequency,  ///< Instantaneous frequency, in Hertz.
+        Phase,      ///< Phase of the tone within [-pi, pi], in radians.
+        Lock        ///< Lock status (1 if locked, 0 otherwise).
+    };
+
+    static constexpr std::size_t RESULTS_COUNT =
+        3;  ///< Number of produced signal lines per tone.
+    static constexpr double DEFAULT_LOOP_BANDWIDTH =
+        10.0;  ///< Default noise bandwidth of the phase loop, in Hertz.
+    static constexpr double DEFAULT_DAMPING_FACTOR =
+        0.707;  ///< Default damping factor of the phase loop.
+    static constexpr double DEFAULT_FREQUENCY_LOOP_BANDWIDTH =
+        0.0;  ///< Default noise bandwidth of the frequency-locked assist, in
+              ///< Hertz (disabled).
+    static constexpr double DEFAULT_ARM_BANDWIDTH_RATIO =
+        10.0;  ///< Default ratio of the arm filter bandwidth to the widest loop
+               ///< bandwidth (lowered to keep the mixing products out).
+    static constexpr double DEFAULT_LOCK_THRESHOLD =
+        0.8;  ///< Default threshold of the lock metric (mean cosine of the
+              ///< phase error).
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Phase-Locked Loop";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t ARM_FILTER_ORDER =
+        2;  ///< Number of cascaded one-pole stages of the arm filters.
+    static constexpr double ARM_SEPARATION_RATIO =
+        5.0;  ///< Minimal ratio of the nearest mixing product of a tone (the
+              ///< double frequency or another tone) to its arm bandwidth.
+    static constexpr double MIN_ARM_BANDWIDTH_RATIO =
+        2.0;  ///< Minimal ratio of the arm bandwidth to the widest loop
+              ///< bandwidth keeping the loops stable.
+
+}  // namespace PLL
+
+/**
+ * @struct TToneTrack
+ * @brief Contains the tracking results of one tone over a run of samples.
+ */
+struct TToneTrack {
+    std::vector<double> frequency = {};  ///< Instantaneous frequency, in Hertz.
+    std::vector<double> phase = {};  ///< Phase within [-pi, pi], in radians.
+    std::vector<std::uint8_t> lock = {};  ///< Lock status (1 if locked).
+};
+
+/**
+ * @struct TPhaseLockedLoopParams
+ * @brief Contains parameters used for phase-locked tracking.
+ */
+struct TPhaseLockedLoopParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to track (not needed for
+                  ///< streaming).
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Input sampling frequency, in Hertz. If not set, the
+                       ///< sampling frequency of the signal line is used.
+
+    // Calculation Parameters
+    std::vector<double> frequencies =
+        {};  ///< Initial frequencies of the tracked tones, in Hertz
+             ///< (required).
+    std::optional<double> loopBandwidth =
+        std::nullopt;  ///< Noise bandwidth of the phase loop, in Hertz. If
+                       ///< not set, it is `PLL::DEFAULT_LOOP_BANDWIDTH`,
+                       ///< lowered to fit the arm filters of the closest tone.
+    std::optional<double> dampingFactor =
+        PLL::DEFAULT_DAMPING_FACTOR;  ///< Damping factor of the phase loop.
+    std::optional<double> frequencyLoopBandwidth =
+        PLL::DEFAULT_FREQUENCY_LOOP_BANDWIDTH;  ///< Noise bandwidth of the
+                                                ///< frequency-locked assist,
+                                                ///< in Hertz (0 disables it).
+    std::optional<double> armBandwidth =
+        std::nullopt;  ///< Bandwidth of the arm filters, in Hertz. If not set,
+                       ///< it is `PLL::DEFAULT_ARM_BANDWIDTH_RATIO` times the
+                       ///< widest loop bandwidth, lowered per tone to
+                       ///< `1 / PLL::ARM_SEPARATION_RATIO` of the distance
+                       ///< to its nearest mixing product.
+    std::optional<double> lockThreshold =
+        PLL::DEFAULT_LOCK_THRESHOLD;  ///< Threshold of the lock metric within
+                                      ///< (0, 1).
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> graphLabel =
+        PLL::DEFAULT_GRAPH_LABEL;  ///< Label for the graphs.
+};
+
+/**
+ * @class TPhaseLockedLoop
+ * @brief Class for tracking the instantaneous frequency and phase of one or
+ * several drifting tones with phase-locked loops.
+ *
+ * @details Every tone has its own loop. The input is mixed with the loop
+ * oscillator, and the in-phase and quadrature arms are low-passed by
+ * `PLL::ARM_FILTER_ORDER` one-pole stages. Mixing a real input leaves, besides
+ * the tone at zero frequency, products at the double frequency and at the
+ * sums and differences with the other tones (aliased by the sampling
+ * frequency); the arm bandwidth of every tone is kept
+ * `PLL::ARM_SEPARATION_RATIO` times below its nearest product, and at least
+ * `PLL::MIN_ARM_BANDWIDTH_RATIO` times above the loop bandwidth, so that the
+ * arm filters do not destabilize the loop. Without an explicit loop
+ * bandwidth, `PLL::DEFAULT_LOOP_BANDWIDTH` is lowered until the closest tone
+ * fits; with one, tones too close to each other, to zero or to the Nyquist
+ * frequency for it are rejected. The
+ * angle of the arms is the phase error, so the detector does not depend on
+ * the amplitude. A proportional-integral loop filter (second-order loop with
+ * the standard noise bandwidth and damping gains) steers the oscillator. It
+ * follows frequency ramps with a vanishing phase error.
+ *
+ * The reported frequency is the loop integrator plus the proportional term of
+ * the phase error averaged with the phase loop bandwidth: the residue of the
+ * mixing products is smoothed out, while ramps stay unbiased.
+ *
+ * The optional frequency-locked assist adds the rotation of the arms between
+ * samples (a cross-product discriminator) to the loop integrator. It pulls the
+ * loop in from initial frequencies far outside the phase loop bandwidth.
+ *
+ * The lock metric is the cosine of the phase error, averaged with the phase
+ * loop bandwidth; the tone is locked while it exceeds `lockThreshold`.
+ *
+ * The tones are tracked on several threads. `processBlock()` processes a
+ * stream block by block with the same loops, so the results equal those of
+ * `execute()` for the concatenated blocks.
+ */
+class TPhaseLockedLoop {
+   public:
+    /**
+     * @brief Constructs a TPhaseLockedLoop with a signal line and the tones.
+     *
+     * @param signalLine Pointer to the signal line to track.
+     * @param frequencies Initial frequencies of the tones, in Hertz.
+     * @param loopBandwidth Noise bandwidth of the phase loop, in Hertz (derived
+     * from the tones if not set).
+     * @param frequencyLoopBandwidth Noise bandwidth of the frequency-locked
+     * assist, in Hertz.
+     * @param xLabel Label for the x-axis.
+     * @param graphLabel Label for the graphs.
+     */
+    TPhaseLockedLoop(
+        const TSignalLine*         signalLine,
+        std::vector<double>        frequencies,
+        std::optional<double>      loopBandwidth = std::nullopt,
+        std::optional<double>      frequencyLoopBandwidth =
+            PLL::DEFAULT_FREQUENCY_LOOP_BANDWIDTH,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> graphLabel = PLL::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TPhaseLockedLoop with tracking parameters.
+     *
+     * @param params Structure containing the parameters of the loops.
+     */
+    explicit TPhaseLockedLoop(TPhaseLockedLoopParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TPhaseLockedLoop() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TPhaseLockedLoop(const TPhaseLockedLoop&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TPhaseLockedLoop(TPhaseLockedLoop&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TPhaseLockedLoop& operator=(const TPhaseLockedLoop&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TPhaseLockedLoop& operator=(TPhaseLockedLoop&&) noexcept = default;
+
+    /**
+     * @brief Retrieves a result line of a tone.
+     *
+     * @param result The result.
+     * @param tone Index of the tone.
+     * @return const TSignalLine* A pointer to the signal line.
+     *
+     * @throw SignalProcessingError If the loops have not been executed or if
+     * the index is out of bounds.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine(
+        PLL::Result result,
+        std::size_t tone = 0) const;
+
+    /**
+     * @brief Retrieves the parameters of the loops.
+     *
+     * @return const TPhaseLockedLoopParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TPhaseLockedLoopParams& getParams() const;
+
+    /**
+     * @brief Determines if the loops have been executed.
+     *
+     * @return bool True if the loops have been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Tracks the tones over the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points, if the parameters are invalid, or if the arm filters cannot
+     * separate the tones from their mixing products.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next samples.
+     * @return std::vector<TToneTrack> The tracking results of every tone.
+     *
+     * @throws SignalProcessingError If the parameters are invalid or the
+     * arm filters cannot separate the tones from their mixing products.
+     */
+    [[nodiscard]] std::vector<TToneTrack> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct Tone
+     * @brief Loop state of one tone.
+     */
+    struct Tone {
+        double phase     = 0.0;  ///< Oscillator phase, in radians.
+        double frequency = 0.0;  ///< Loop integrator, in radians per sample.
+        double armCoefficient = 0.0;  ///< Coefficient of the arm filters.
+        std::array<double, PLL::ARM_FILTER_ORDER> inPhase =
+            {};  ///< Stages of the in-phase arm filter.
+        std::array<double, PLL::ARM_FILTER_ORDER> quadrature =
+            {};  ///< Stages of the quadrature arm filter.
+        double lock  = 0.0;  ///< Averaged cosine of the phase error.
+        double error = 0.0;  ///< Averaged phase error.
+    };
+
+    /**
+     * @struct State
+     * @brief Loop gains and the states of all tones.
+     */
+    struct State {
+        double proportionalGain = 0.0;  ///< Proportional gain of the phase
+                                        ///< loop.
+        double integralGain = 0.0;  ///< Integral gain of the phase loop.
+        double frequencyGain = 0.0;  ///< Gain of the frequency-locked assist.
+        double averageCoefficient = 0.0;  ///< Coefficient of the lock metric
+                                          ///< and phase error averages.
+        double lockThreshold = 0.0;  ///< Threshold of the lock metric.
+        double samplingFrequency = 0.0;  ///< Input sampling frequency.
+        std::vector<Tone> tones = {};  ///< States of the tones.
+    };
+
+    std::vector<TSignalLine> _lines =
+        {};  ///< Result lines, `PLL::RESULTS_COUNT` per tone.
+    TPhaseLockedLoopParams _params = {};  ///< Parameters of the loops.
+    std::optional<State>   _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the loops have been
+                               ///< executed.
+
+    /**
+     * @brief Resolves the sampling frequency from the parameters or the
+     * signal line.
+     *
+     * @return double The sampling frequency.
+     *
+     * @throws SignalProcessingError If the sampling frequency is not set or
+     * not positive.
+     */
+    [[nodiscard]] double resolveSamplingFrequency() const;
+
+    /**
+     * @brief Validates the parameters and creates a fresh state.
+     *
+     * @param samplingFrequency Input sampling frequency.
+     * @return State The initial state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid or the
+     * arm filters cannot separate the tones from their mixing products.
+     */
+    [[nodiscard]] State makeState(double samplingFrequency) const;
+
+    /**
+     * @brief Tracks all tones over a run of samples.
+     *
+     * @param state State to continue from; updated in place.
+     * @param samples The samples.
+     * @return std::vector<TToneTrack> The tracking results of every tone.
+     */
+    [[nodiscard]] std::vector<TToneTrack> track(
+        State&                  state,
+        std::span<const double> samples) const;
+};
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+ * @file TResampler.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TResampler class mapping signal
+ * lines with arbitrary x coordinates onto a uniform grid.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TResampler.hpp"
+#include "TCore.hpp"
+#include "TFilterDesign.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Solves the second derivatives of the natural cubic spline through
+     * the points (tridiagonal system, Thomas algorithm).
+     *
+     * @param points Points with strictly increasing x coordinates.
+     * @return std::vector<double> The second derivatives at the points.
+     */
+    std::vector<double> solveCurvatures(const std::vector<Point>& points) {
+        const std::size_t   count = points.size();
+        std::vector<double> curvatures(count, 0.0);
+        if (count < 3) {
+            return curvatures;
+        }
+
+        // Forward elimination; the natural ends have zero curvature
+        std::vector<double> upper(count, 0.0);
+        std::vector<double> right(count, 0.0);
+        for (std::size_t i = 1; i + 1 < count; ++i) {
+            const double left  = points[i].x - points[i - 1].x;
+            const double next  = points[i + 1].x - points[i].x;
+            const double slope = (points[i + 1].y - points[i].y) / next -
+                                 (points[i].y - points[i - 1].y) / left;
+            const double pivot =
+                (left + next) / 3.0 - left / 6.0 * upper[i - 1];
+            upper[i] = next / 6.0 / pivot;
+            right[i] = (slope - left / 6.0 * right[i - 1]) / pivot;
+        }
+
+        for (std::size_t i = count - 2; i > 0; --i) {
+            curvatures[i] = right[i] - upper[i] * curvatures[i + 1];
+        }
+        return curvatures;
+    }
+
+}  // namespace
+
+/*
+ * PUBLIC METHODS
+ */
+
+TResampler::TResampler(
+    const TSignalLine*                      signalLine,
+    const std::optional<double>             samplingFrequency,
+    const std::optional<RES::Interpolation> interpolation,
+    std::optional<std::string>              xLabel,
+    std::optional<std::string>              yLabel,
+    std::optional<std::string>              graphLabel)
+    : _params{.signalLine        = signalLine,
+              .samplingFrequency = samplingFrequency,
+              .interpolation     = interpolation,
+              .xLabel            = std::move(xLabel),
+              .yLabel            = std::move(yLabel),
+              .graphLabel        = std::move(graphLabel)} {}
+
+TResampler::TResampler(TResamplerParams params) : _params(std::move(params)) {}
+
+TResampler::TResampler(const TResampler& resampler)
+    : _sl(resampler._sl ? std::make_unique<TSignalLine>(*resampler._sl)
+                        : nullptr),
+      _params(resampler._params),
+      _isExecuted(resampler._isExecuted) {}
+
+TResampler& TResampler::operator=(const TResampler& resampler) {
+    if (this == &resampler) {
+        return *this;
+    }
+    _sl =
+        resampler._sl ? std::make_unique<TSignalLine>(*resampler._sl) : nullptr;
+    _params     = resampler._params;
+    _isExecuted = resampler._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TResampler::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Resampler not executed");
+    }
+    return _sl.get();
+}
+
+const TResamplerParams& TResampler::getParams() const {
+    return _params;
+}
+
+bool TResampler::isExecuted() const {
+    return _isExecuted;
+}
+
+void TResampler::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TResampler object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto& points = _params.signalLine->getPoints();
+    if (points.size() < 2) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+    for (std::size_t i = 1; i < points.size(); ++i) {
+        if (points[i].x <= points[i - 1].x) {
+            throw SignalProcessingError(
+                "X coordinates should be strictly increasing");
+        }
+    }
+    if (!_params.samplingFrequency || *_params.samplingFrequency <= 0.0) {
+        throw SignalProcessingError(
+            "Sampling frequency should be set and positive");
+    }
+    const auto interpolation =
+        _params.interpolation.value_or(RES::DEFAULT_INTERPOLATION);
+    if (interpolation == RES::Interpolation::Sinc &&
+        _params.sincHalfWidth.value_or(RES::DEFAULT_SINC_HALF_WIDTH) == 0) {
+        throw SignalProcessingError("Sinc half width should be positive");
+    }
+
+    const double samplingFrequency = *_params.samplingFrequency;
+    const double startTime = _params.startTime.value_or(points.front().x);
+    const double duration =
+        _params.duration.value_or(points.back().x - startTime);
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.samplingFrequency = samplingFrequency;
+    slParams.duration          = duration;
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    // TSignalLine constructor checks the duration and sampling frequency and
+    // computes the number of points. The line is built aside and only
+    // replaces the previous result once the interpolation has succeeded.
+    auto sl = std::make_unique<TSignalLine>(slParams);
+
+    const std::size_t  pointsCount = sl->getParams().pointsCount;
+    std::vector<Point> output(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        output[i].x = startTime + static_cast<double>(i) / samplingFrequency;
+    }
+
+    const std::vector<double> curvatures =
+        interpolation == RES::Interpolation::CubicSpline
+            ? solveCurvatures(points)
+            : std::vector<double>{};
+    PAR::parallelFor(
+        pointsCount,
+        [this, &points, &curvatures, &output](const std::size_t begin,
+                                              const std::size_t end) {
+            interpolateRange(points, curvatures, output, begin, end);
+        },
+        _params.threadsCount, RES::SAMPLES_PER_CHUNK);
+    sl->setPoints(std::move(output));
+
+    _sl         = std::move(sl);
+    _isExecuted = true;
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+void TResampler::interpolateRange(const std::vector<Point>&  points,
+                                  const std::vector<double>& curvatures,
+                                  std::vector<Point>&        output,
+                                  const std::size_t          begin,
+                                  const std::size_t          end) const {
+    const auto interpolation =
+        _params.interpolation.value_or(RES::DEFAULT_INTERPOLATION);
+    const double samplingFrequency = *_params.samplingFrequency;
+    const auto   halfWidth         = static_cast<double>(
+        _params.sincHalfWidth.value_or(RES::DEFAULT_SINC_HALF_WIDTH));
+    const double      reach = halfWidth / samplingFrequency;
+    const std::size_t count = points.size();
+    const auto        byX   = [](const Point& point, const double x) {
+        return point.x < x;
+    };
+
+    // next is the first input point to the right of the output point and
+    // first the first input point within the reach of the sinc kernel; both
+    // only move forward.
+    const double firstX = output[begin].x;
+    auto         next   = static_cast<std::size_t>(
+        std::upper_bound(points.begin(), points.end(), firstX,
+                         [](const double x, const Point& point) {
+                             return x < point.x;
+                         }) -
+        points.begin());
+    auto first = static_cast<std::size_t>(
+        std::lower_bound(points.begin(), points.end(), firstX - reach, byX) -
+        points.begin());
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const double x = output[i].x;
+        while (next < count && points[next].x <= x) {
+            ++next;
+        }
+
+        // Edge values are held outside the input range
+        double value = 0.0;
+        if (next == 0) {
+            value = points.front().y;
+        } else if (next == count) {
+            value = points.back().y;
+        } else {
+            const Point& left  = points[next - 1];
+            const Point& right = points[next];
+            const double width = right.x - left.x;
+            const double t     = (x - left.x) / width;
+            value              = left.y + t * (right.y - left.y);
+            if (interpolation == RES::Interpolation::CubicSpline) {
+                const double s = 1.0 - t;
+                value += ((s * s * s - s) * curvatures[next - 1] +
+                          (t * t * t - t) * curvatures[next]) *
+                         width * width / 6.0;
+            }
+        }
+
+        if (interpolation == RES::Interpolation::Sinc) {
+            while (first < count && points[first].x < x - reach) {
+                ++first;
+            }
+            double weightedSum  = 0.0;
+            double weightSum    = 0.0;
+            double magnitudeSum = 0.0;
+            for (std::size_t k = first; k < count && points[k].x <= x + reach;
+                 ++k) {
+                const double distance = (x - points[k].x) * samplingFrequency;
+                // Each input point stands for the half-way span to its
+                // neighbours (Riemann sum of the convolution integral)
+                const double span =
+                    (points[std::min(k + 1, count - 1)].x -
+                     points[k > 0 ? k - 1 : 0].x) /
+                    2.0;
+                const double weight =
+                    span * FDES::lanczos(distance, halfWidth);
+                weightedSum += weight * points[k].y;
+                weightSum += weight;
+                magnitudeSum += std::abs(weight);
+            }
+            // Without points under the kernel the linear estimate is kept;
+            // the tolerance is relative, as the weights scale with the spacing
+            if (magnitudeSum > 0.0) {
+                if (std::abs(weightSum) <=
+                    RES::MIN_WEIGHT_SUM_RATIO * magnitudeSum) {
+                    throw SignalProcessingError(
+                        "Sinc kernel weights cancel out; the input is too "
+                        "sparse for the output sampling frequency");
+                }
+                value = weightedSum / weightSum;
+            }
+        }
+
+        output[i].y = value;
+    }
+}
\ No newline at end of file
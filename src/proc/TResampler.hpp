@@ -0,0 +1,228 @@
+/**
+ * @file TResampler.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TResampler class mapping signal lines
+ * with arbitrary x coordinates onto a uniform grid.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace RES
+ * @brief Contains default parameters used for resampling.
+ */
+namespace RES {
+
+    /**
+     * @enum Interpolation
+     * @brief Specifies how values between the input points are estimated.
+     */
+    enum class Interpolation : std::uint8_t {
+        Linear,       ///< Straight line between the two nearest points.
+        CubicSpline,  ///< Natural cubic spline through all points.
+        Sinc          ///< Lanczos-windowed sinc kernel at the output rate,
+                      ///< normalized by the sum of its weights.
+    };
+
+    static constexpr auto DEFAULT_INTERPOLATION =
+        Interpolation::Linear;  ///< Default interpolation.
+    static constexpr std::size_t DEFAULT_SINC_HALF_WIDTH =
+        8;  ///< Default half width of the sinc kernel, in output periods.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Resampled Signal";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_CHUNK =
+        4096;  ///< Minimal number of output samples computed by one thread.
+    static constexpr double MIN_WEIGHT_SUM_RATIO =
+        1e-6;  ///< Minimal ratio of the sinc weight sum to the sum of the
+               ///< weight magnitudes.
+
+}  // namespace RES
+
+/**
+ * @struct TResamplerParams
+ * @brief Contains parameters used for resampling.
+ */
+struct TResamplerParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to resample (strictly
+                  ///< increasing x coordinates).
+    std::optional<double> samplingFrequency =
+        std::nullopt;  ///< Sampling frequency of the output grid, in Hertz
+                       ///< (required).
+    std::optional<double> startTime =
+        std::nullopt;  ///< First x coordinate of the output grid. If not set,
+                       ///< the first x coordinate of the input is used.
+    std::optional<double> duration =
+        std::nullopt;  ///< Duration of the output grid. If not set, the grid
+                       ///< ends at the last x coordinate of the input.
+
+    // Calculation Parameters
+    std::optional<RES::Interpolation> interpolation =
+        RES::DEFAULT_INTERPOLATION;  ///< Interpolation method.
+    std::optional<std::size_t> sincHalfWidth =
+        RES::DEFAULT_SINC_HALF_WIDTH;  ///< Half width of the sinc kernel, in
+                                       ///< output periods.
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        RES::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TResampler
+ * @brief Class for mapping a signal line with arbitrary x coordinates onto a
+ * uniform grid.
+ *
+ * @details The output grid is `startTime + i / samplingFrequency` for
+ * `i = 0 ... ceil(duration * samplingFrequency)`, and the output line has
+ * `samplingFrequency` and `duration` set, so it can be used by the stages
+ * that need uniform sampling. Outside the input range the edge values are
+ * held (linear and spline interpolation) or the kernel is truncated (sinc).
+ *
+ * The output grid is split into chunks processed on several threads. Each
+ * chunk locates its first input point by binary search and then walks the
+ * input and output grids together in a single merge-style pass. The spline
+ * coefficients are solved once beforehand in `O(N)`.
+ *
+ * The sinc kernel `sinc(d * fs) * sinc(d * fs / a)` (`a` = `sincHalfWidth`,
+ * `d` the distance to an input point) band-limits the signal to the output
+ * Nyquist frequency. Every input point is weighted by the span half-way to its
+ * neighbours and the weights are normalized to unit sum, which approximates
+ * the convolution integral for irregular spacing. It is meant for inputs
+ * several times denser than the output grid, where it avoids the aliasing of
+ * linear and spline interpolation. Where no input point falls under the kernel
+ * (a gap wider than the kernel) the linear estimate is used; where the weights
+ * nearly cancel (`RES::MIN_WEIGHT_SUM_RATIO` of their magnitudes), the input
+ * is too sparse for the output rate and the resampling fails.
+ */
+class TResampler {
+   public:
+    /**
+     * @brief Constructs a TResampler with a signal line and an output rate.
+     *
+     * @param signalLine Pointer to the signal line to resample.
+     * @param samplingFrequency Sampling frequency of the output grid.
+     * @param interpolation Interpolation method.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    TResampler(
+        const TSignalLine*                signalLine,
+        std::optional<double>             samplingFrequency,
+        std::optional<RES::Interpolation> interpolation =
+            RES::DEFAULT_INTERPOLATION,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = RES::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TResampler with resampling parameters.
+     *
+     * @param params Structure containing the parameters for resampling.
+     */
+    explicit TResampler(TResamplerParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TResampler() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TResampler(const TResampler& resampler);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TResampler(TResampler&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TResampler& operator=(const TResampler& resampler);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TResampler& operator=(TResampler&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the resampled signal line.
+     *
+     * @return const TSignalLine* A pointer to the resampled signal line.
+     *
+     * @throw SignalProcessingError If the resampler has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the resampler.
+     *
+     * @return const TResamplerParams& A constant reference to the parameters.
+     */
+    [[nodiscard]] const TResamplerParams& getParams() const;
+
+    /**
+     * @brief Determines if the resampler has been executed.
+     *
+     * @return bool True if the resampler has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Resamples the signal line.
+     *
+     * @throws SignalProcessingError If the signal line is null or has fewer
+     * than two points, if its x coordinates are not strictly increasing, if
+     * the sampling frequency, duration or sinc half width is invalid, or if
+     * the sinc weights cancel out. The previous result is then kept.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the resampled signal line.
+    TResamplerParams _params = {};  ///< Parameters of the resampler.
+    bool _isExecuted = false;  ///< Flag indicating if the resampler has been
+                               ///< executed.
+
+    /**
+     * @brief Computes a chunk of output samples.
+     *
+     * @param points Input points.
+     * @param curvatures Second derivatives of the spline at the input points
+     * (spline interpolation only).
+     * @param output Output points with the x coordinates already set.
+     * @param begin First output index of the chunk.
+     * @param end Output index past the last one of the chunk.
+     */
+    void interpolateRange(const std::vector<Point>&  points,
+                          const std::vector<double>& curvatures,
+                          std::vector<Point>&        output,
+                          std::size_t                begin,
+                          std::size_t                end) const;
+};
\ No newline at end of file
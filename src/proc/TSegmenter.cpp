@@ -0,0 +1,184 @@
+/**
+ * @file TSegmenter.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TSegmenter class cutting
+ * pre/post-trigger windows around detected events.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TSegmenter.hpp"
+#include "TCore.hpp"
+#include "TEventDetector.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+#include "TStatistics.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+std::vector<TDescriptiveStatistics> SEG::describe(
+    const std::span<const TSegment>  segments,
+    const std::optional<std::size_t> threadsCount) {
+    std::vector<TDescriptiveStatistics> statistics(segments.size());
+    PAR::parallelFor(
+        segments.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t s = begin; s < end; ++s) {
+                statistics[s] =
+                    STAT::describe(STAT::accumulate(segments[s].values));
+            }
+        },
+        threadsCount, SEGMENTS_PER_CHUNK);
+    return statistics;
+}
+
+/*
+ * PUBLIC METHODS
+ */
+
+TSegmenter::TSegmenter(const TSignalLine*               signalLine,
+                       const TEventDetector*            detector,
+                       const std::optional<std::size_t> preTriggerCount,
+                       const std::optional<std::size_t> postTriggerCount)
+    : _params{.signalLine       = signalLine,
+              .detector         = detector,
+              .preTriggerCount  = preTriggerCount,
+              .postTriggerCount = postTriggerCount} {}
+
+TSegmenter::TSegmenter(TSegmenterParams params) : _params(std::move(params)) {}
+
+std::vector<TSegment> TSegmenter::getSegments() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Segmenter not executed");
+    }
+    std::vector<TSegment> segments;
+    segments.reserve(_events.size());
+    for (const TEvent& event : _events) {
+        segments.push_back(makeSegment(_values, 0, event));
+    }
+    return segments;
+}
+
+const TSegmenterParams& TSegmenter::getParams() const {
+    return _params;
+}
+
+bool TSegmenter::isExecuted() const {
+    return _isExecuted;
+}
+
+void TSegmenter::execute() {
+    // We're ensuring that the signal line and the detector are not null here
+    // because they may be set after the TSegmenter object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    if (_params.detector == nullptr) {
+        throw SignalProcessingError("Invalid event detector (nullptr)");
+    }
+    validateWindow();
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    // The samples are gathered once; the windows are views into them
+    _values.resize(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        _values[i] = points[i].y;
+    }
+    _events.clear();
+    for (const TEvent& event : _params.detector->getEvents()) {
+        if (event.index < pointsCount) {
+            _events.push_back(event);
+        }
+    }
+    _isExecuted = true;
+}
+
+std::vector<TSegment> TSegmenter::processBlock(
+    const std::span<const double> samples,
+    const std::span<const TEvent> events) {
+    validateWindow();
+    const std::size_t pre  = *_params.preTriggerCount;
+    const std::size_t post = *_params.postTriggerCount;
+    if (!_stream) {
+        _stream = State{};
+    }
+    State& state = *_stream;
+
+    // Samples no window can reach any more are dropped before the new block
+    // arrives, so that the views returned by the previous call stay valid
+    // until now
+    std::size_t keep = state.end > pre ? state.end - pre : 0;
+    if (!state.pending.empty()) {
+        const std::size_t first = state.pending.front().index;
+        keep = std::min(keep, first > pre ? first - pre : 0);
+    }
+    keep = std::max(keep, state.start);
+    state.history.erase(
+        state.history.begin(),
+        state.history.begin() +
+            static_cast<std::ptrdiff_t>(keep - state.start));
+    state.start = keep;
+
+    state.history.insert(state.history.end(), samples.begin(), samples.end());
+    state.end += samples.size();
+    for (const TEvent& event : events) {
+        if (event.index < state.start || event.index >= state.end) {
+            throw SignalProcessingError(
+                "Event lies outside the processed samples");
+        }
+        state.pending.push_back(event);
+    }
+
+    std::vector<TSegment> segments;
+    std::size_t           completed = 0;
+    while (completed < state.pending.size() &&
+           state.pending[completed].index + post <= state.end) {
+        segments.push_back(
+            makeSegment(state.history, state.start, state.pending[completed]));
+        ++completed;
+    }
+    state.pending.erase(
+        state.pending.begin(),
+        state.pending.begin() + static_cast<std::ptrdiff_t>(completed));
+    return segments;
+}
+
+void TSegmenter::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TSegment TSegmenter::makeSegment(const std::span<const double> values,
+                                 const std::size_t             start,
+                                 const TEvent&                 event) const {
+    const std::size_t pre  = *_params.preTriggerCount;
+    const std::size_t post = *_params.postTriggerCount;
+    const std::size_t begin =
+        std::max(start, event.index > pre ? event.index - pre : 0);
+    const std::size_t end = std::min(start + values.size(), event.index + post);
+    return {.event  = event,
+            .begin  = begin,
+            .values = values.subspan(begin - start, end - begin)};
+}
+
+void TSegmenter::validateWindow() const {
+    if (!_params.preTriggerCount || !_params.postTriggerCount) {
+        throw SignalProcessingError("Window lengths are not specified");
+    }
+    if (*_params.preTriggerCount + *_params.postTriggerCount == 0) {
+        throw SignalProcessingError("Window should not be empty");
+    }
+}
\ No newline at end of file
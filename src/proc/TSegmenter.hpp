@@ -0,0 +1,246 @@
+/**
+ * @file TSegmenter.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TSegmenter class cutting
+ * pre/post-trigger windows around detected events.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TEventDetector.hpp"
+#include "TSignalLine.hpp"
+#include "TStatistics.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * @struct TSegment
+ * @brief Contains a non-owning view of the window around an event.
+ */
+struct TSegment {
+    TEvent      event = {};  ///< Event that triggered the window.
+    std::size_t begin = 0;   ///< Index of the first sample of the window
+                             ///< (counted from the start of the stream).
+    std::span<const double> values = {};  ///< Samples of the window.
+};
+
+/**
+ * @namespace SEG
+ * @brief Contains default parameters and batched analysis of segments.
+ */
+namespace SEG {
+
+    static constexpr std::size_t DEFAULT_PRE_TRIGGER_COUNT =
+        100;  ///< Default number of samples before the trigger.
+    static constexpr std::size_t DEFAULT_POST_TRIGGER_COUNT =
+        400;  ///< Default number of samples from the trigger on.
+
+    // Kernel parameters
+    static constexpr std::size_t SEGMENTS_PER_CHUNK =
+        8;  ///< Minimal number of segments analyzed by one thread.
+
+    /**
+     * @brief Computes the descriptive statistics of every segment.
+     * @details The segments are distributed over threads; each one is reduced
+     * by STAT::accumulate() directly from its view.
+     *
+     * @param segments The segments.
+     * @param threadsCount Number of threads. If not set, the number of hardware
+     * threads is used.
+     * @return std::vector<TDescriptiveStatistics> The statistics, one per
+     * segment.
+     */
+    [[nodiscard]] std::vector<TDescriptiveStatistics> describe(
+        std::span<const TSegment>  segments,
+        std::optional<std::size_t> threadsCount = std::nullopt);
+
+}  // namespace SEG
+
+/**
+ * @struct TSegmenterParams
+ * @brief Contains parameters used for segmentation.
+ */
+struct TSegmenterParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to segment (not needed for
+                  ///< streaming).
+    const TEventDetector* detector =
+        nullptr;  ///< Pointer to the executed detector of the signal line
+                  ///< (not needed for streaming).
+
+    // Calculation Parameters
+    std::optional<std::size_t> preTriggerCount =
+        SEG::DEFAULT_PRE_TRIGGER_COUNT;  ///< Number of samples before the
+                                         ///< trigger sample.
+    std::optional<std::size_t> postTriggerCount =
+        SEG::DEFAULT_POST_TRIGGER_COUNT;  ///< Number of samples from the
+                                          ///< trigger sample on.
+};
+
+/**
+ * @class TSegmenter
+ * @brief Class for cutting the windows around events found by a
+ * TEventDetector without copying them.
+ *
+ * @details Every window spans `preTriggerCount` samples before the trigger
+ * sample (`TEvent::index`) and `postTriggerCount` samples from it on. The
+ * segments are views: the samples of the line are gathered once into a
+ * contiguous buffer and every window, overlapping or not, points into it. The
+ * views stay valid until the segmenter is executed again or destroyed. Windows
+ * are clipped to the line.
+ *
+ * Streams are segmented block by block: `processBlock()` takes the samples and
+ * the events a TEventDetector found in them. The segmenter keeps the last
+ * `preTriggerCount` samples as a pre-trigger history together with the samples
+ * of windows still waiting for their post-trigger part, and returns the
+ * windows completed by the block. Their views stay valid until the next call.
+ */
+class TSegmenter {
+   public:
+    /**
+     * @brief Constructs a TSegmenter with a signal line, its detector and the
+     * window lengths.
+     *
+     * @param signalLine Pointer to the signal line to segment.
+     * @param detector Pointer to the executed detector of the signal line.
+     * @param preTriggerCount Number of samples before the trigger sample.
+     * @param postTriggerCount Number of samples from the trigger sample on.
+     */
+    TSegmenter(const TSignalLine*         signalLine,
+               const TEventDetector*      detector,
+               std::optional<std::size_t> preTriggerCount =
+                   SEG::DEFAULT_PRE_TRIGGER_COUNT,
+               std::optional<std::size_t> postTriggerCount =
+                   SEG::DEFAULT_POST_TRIGGER_COUNT);
+
+    /**
+     * @brief Constructs a TSegmenter with segmentation parameters.
+     *
+     * @param params Structure containing the parameters of the segmentation.
+     */
+    explicit TSegmenter(TSegmenterParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TSegmenter() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TSegmenter(const TSegmenter&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TSegmenter(TSegmenter&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TSegmenter& operator=(const TSegmenter&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TSegmenter& operator=(TSegmenter&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the segments of the signal line.
+     *
+     * @return std::vector<TSegment> Views of the windows, one per event.
+     *
+     * @throw SignalProcessingError If the segmentation has not been executed.
+     */
+    [[nodiscard]] std::vector<TSegment> getSegments() const;
+
+    /**
+     * @brief Retrieves the parameters of the segmentation.
+     *
+     * @return const TSegmenterParams& A constant reference to the parameters.
+     */
+    [[nodiscard]] const TSegmenterParams& getParams() const;
+
+    /**
+     * @brief Determines if the segmentation has been executed.
+     *
+     * @return bool True if the segmentation has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Segments the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line or the detector is
+     * null, if the detector has not been executed, if the line has no points
+     * or if the window is empty.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next samples.
+     * @param events Events found in these samples, in order.
+     * @return std::vector<TSegment> The windows completed by the block.
+     *
+     * @throws SignalProcessingError If the window is empty or an event lies
+     * outside the samples processed so far.
+     */
+    [[nodiscard]] std::vector<TSegment> processBlock(
+        std::span<const double> samples,
+        std::span<const TEvent> events);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     * @details Windows still waiting for their post-trigger part are dropped.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Sample history and pending events carried between blocks.
+     */
+    struct State {
+        std::vector<double> history = {};  ///< Retained samples.
+        std::size_t start = 0;  ///< Stream index of the first retained sample.
+        std::size_t end   = 0;  ///< Number of samples processed.
+        std::vector<TEvent> pending =
+            {};  ///< Events awaiting their post-trigger samples.
+    };
+
+    std::vector<double>  _values = {};  ///< Samples of the signal line.
+    std::vector<TEvent>  _events = {};  ///< Events of the signal line.
+    TSegmenterParams     _params = {};  ///< Parameters of the segmentation.
+    std::optional<State> _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the segmentation has
+                               ///< been executed.
+
+    /**
+     * @brief Builds the view of the window around an event.
+     *
+     * @param values Samples starting at the stream index `start`.
+     * @param start Stream index of the first sample.
+     * @param event The event.
+     * @return TSegment The window clipped to the samples.
+     */
+    [[nodiscard]] TSegment makeSegment(std::span<const double> values,
+                                       std::size_t             start,
+                                       const TEvent&           event) const;
+
+    /**
+     * @brief Validates the window lengths.
+     *
+     * @throws SignalProcessingError If the window is empty.
+     */
+    void validateWindow() const;
+};
\ No newline at end of file
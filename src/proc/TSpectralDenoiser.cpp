@@ -0,0 +1,408 @@
+/**
+ * @file TSpectralDenoiser.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TSpectralDenoiser class removing
+ * broadband noise by spectral subtraction or Wiener filtering.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TSpectralDenoiser.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TSpectralDenoiser::TSpectralDenoiser(
+    const TSignalLine*               signalLine,
+    const std::optional<SDN::Method> method,
+    const std::optional<std::size_t> frameLength,
+    const std::optional<double>      overlap,
+    std::optional<std::string>       xLabel,
+    std::optional<std::string>       yLabel,
+    std::optional<std::string>       graphLabel)
+    : _params{.signalLine  = signalLine,
+              .method      = method,
+              .frameLength = frameLength,
+              .overlap     = overlap,
+              .xLabel      = std::move(xLabel),
+              .yLabel      = std::move(yLabel),
+              .graphLabel  = std::move(graphLabel)} {}
+
+TSpectralDenoiser::TSpectralDenoiser(TSpectralDenoiserParams params)
+    : _params(std::move(params)) {}
+
+TSpectralDenoiser::TSpectralDenoiser(const TSpectralDenoiser& denoiser)
+    : _sl(denoiser._sl ? std::make_unique<TSignalLine>(*denoiser._sl)
+                       : nullptr),
+      _params(denoiser._params),
+      _stream(denoiser._stream),
+      _isExecuted(denoiser._isExecuted) {}
+
+TSpectralDenoiser& TSpectralDenoiser::operator=(
+    const TSpectralDenoiser& denoiser) {
+    if (this == &denoiser) {
+        return *this;
+    }
+    _sl = denoiser._sl ? std::make_unique<TSignalLine>(*denoiser._sl)
+                       : nullptr;
+    _params     = denoiser._params;
+    _stream     = denoiser._stream;
+    _isExecuted = denoiser._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TSpectralDenoiser::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Spectral denoiser not executed");
+    }
+    return _sl.get();
+}
+
+const TSpectralDenoiserParams& TSpectralDenoiser::getParams() const {
+    return _params;
+}
+
+bool TSpectralDenoiser::isExecuted() const {
+    return _isExecuted;
+}
+
+void TSpectralDenoiser::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TSpectralDenoiser object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    State             state       = makeState();
+    if (pointsCount < state.fft.getSize()) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    std::vector<double> samples(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        samples[i] = points[i].y;
+    }
+    const std::vector<double> output = denoise(state, samples, true);
+
+    std::vector<Point> outputPoints(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        outputPoints[i] = Point{.x = points[i].x, .y = output[i]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    slParams.pointsCount       = pointsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+
+    _isExecuted = true;
+}
+
+std::vector<double> TSpectralDenoiser::processBlock(
+    const std::span<const double> samples) {
+    if (!_stream) {
+        _stream = makeState();
+    }
+    return denoise(*_stream, samples, false);
+}
+
+void TSpectralDenoiser::reset() {
+    _stream.reset();
+}
+
+/*
+ * PRIVATE METHODS
+ */
+
+TSpectralDenoiser::State TSpectralDenoiser::makeState() const {
+    const std::size_t length =
+        _params.frameLength.value_or(SDN::DEFAULT_FRAME_LENGTH);
+    if (length < 2 || !TFFT::isPowerOfTwo(length)) {
+        throw SignalProcessingError(
+            "Frame length should be a power of two (at least 2)");
+    }
+    const double overlap = _params.overlap.value_or(SDN::DEFAULT_OVERLAP);
+    if (overlap < 0.0 || overlap >= 1.0) {
+        throw SignalProcessingError("Overlap should be within [0, 1)");
+    }
+    const double smoothingFactor =
+        _params.smoothingFactor.value_or(SDN::DEFAULT_SMOOTHING_FACTOR);
+    if (smoothingFactor < 0.0 || smoothingFactor >= 1.0) {
+        throw SignalProcessingError("Smoothing factor should be within [0, 1)");
+    }
+    const double noiseRise =
+        _params.noiseRise.value_or(SDN::DEFAULT_NOISE_RISE);
+    if (noiseRise <= 0.0) {
+        throw SignalProcessingError("Noise rise should be positive");
+    }
+    const double overSubtraction =
+        _params.overSubtraction.value_or(SDN::DEFAULT_OVER_SUBTRACTION);
+    if (overSubtraction <= 0.0) {
+        throw SignalProcessingError(
+            "Over-subtraction factor should be positive");
+    }
+    const double priorSmoothing =
+        _params.priorSmoothing.value_or(SDN::DEFAULT_PRIOR_SMOOTHING);
+    if (priorSmoothing < 0.0 || priorSmoothing >= 1.0) {
+        throw SignalProcessingError("Prior smoothing should be within [0, 1)");
+    }
+    const double gainFloor =
+        _params.gainFloor.value_or(SDN::DEFAULT_GAIN_FLOOR);
+    if (gainFloor < 0.0 || gainFloor > 1.0) {
+        throw SignalProcessingError("Gain floor should be within [0, 1]");
+    }
+
+    const std::size_t hop = std::max<std::size_t>(
+        1, length - static_cast<std::size_t>(
+                        std::lround(overlap * static_cast<double>(length))));
+
+    // The periodic window (the symmetric one of one more sample without its
+    // last sample) tiles the time axis evenly at the usual overlaps
+    std::vector<double> window = WIN::makeWindow(
+        _params.window.value_or(SDN::DEFAULT_WINDOW), length + 1);
+    window.pop_back();
+
+    std::vector<double> normalization(hop, 0.0);
+    for (std::size_t i = 0; i < length; ++i) {
+        normalization[i % hop] += window[i] * window[i];
+    }
+    const auto [smallest, largest] = std::ranges::minmax(normalization);
+    if (smallest <= SDN::MIN_COVERAGE * largest) {
+        throw SignalProcessingError(
+            "Window and overlap should cover every sample");
+    }
+
+    // The leading padding places the first frame of the signal after the
+    // frames covering its first samples only partially
+    const std::size_t padding = (length - hop + hop - 1) / hop * hop;
+    const std::size_t binsCount = length / 2 + 1;
+    const SDN::Method method = _params.method.value_or(SDN::DEFAULT_METHOD);
+    return State{.fft             = TFFT(length),
+                 .window          = std::move(window),
+                 .normalization   = std::move(normalization),
+                 .hop             = hop,
+                 .method          = method,
+                 .smoothingFactor = smoothingFactor,
+                 .riseFactor      = 1.0 + noiseRise,
+                 .overSubtraction = overSubtraction,
+                 .priorSmoothing  = priorSmoothing,
+                 .gainFloor       = gainFloor,
+                 .history         = std::vector<double>(padding, 0.0),
+                 .accumulator     = std::vector<double>(length, 0.0),
+                 .smoothedPower   = std::vector<double>(binsCount, 0.0),
+                 .noisePower      = std::vector<double>(binsCount, 0.0),
+                 .cleanPower      = std::vector<double>(binsCount, 0.0),
+                 .skippedCount    = padding};
+}
+
+std::vector<double> TSpectralDenoiser::denoise(
+    State&                        state,
+    const std::span<const double> samples,
+    const bool                    isFinal) const {
+    const std::size_t length    = state.fft.getSize();
+    const std::size_t hop       = state.hop;
+    const std::size_t binsCount = length / 2 + 1;
+    state.history.insert(state.history.end(), samples.begin(), samples.end());
+
+    // Frames lying completely within the received samples update the noise
+    // floor; the final frames padded with zeros only reuse it
+    const std::size_t available = state.history.size();
+    const std::size_t fullCount =
+        available >= length ? (available - length) / hop + 1 : 0;
+    const std::size_t warmUpCount =
+        state.isInitialized ? 0 : state.skippedCount / hop;
+    if (fullCount <= warmUpCount) {
+        if (isFinal) {
+            throw SignalProcessingError("Insufficient number of points");
+        }
+        return {};
+    }
+    std::size_t framesCount = fullCount;
+    if (isFinal) {
+        framesCount = (available + hop - 1) / hop;
+        state.history.resize((framesCount - 1) * hop + length, 0.0);
+    }
+
+    // The first block reaches the frame initializing the estimates
+    const std::size_t blockSize =
+        std::max(SDN::FRAMES_PER_BLOCK, warmUpCount + 1);
+    std::vector<double> output;
+    output.reserve(framesCount * hop);
+    std::vector<std::complex<double>> spectra;
+    std::vector<double>               frames;
+    for (std::size_t block = 0; block < framesCount; block += blockSize) {
+        const std::size_t count = std::min(blockSize, framesCount - block);
+        spectra.resize(count * binsCount);
+        frames.resize(count * length);
+
+        // Windowing and forward transforms, several frames per thread
+        PAR::parallelFor(
+            count,
+            [&](const std::size_t begin, const std::size_t end) {
+                std::vector<double> input((end - begin) * length);
+                for (std::size_t f = begin; f < end; ++f) {
+                    const double* frame =
+                        state.history.data() + (block + f) * hop;
+                    double* windowed = input.data() + (f - begin) * length;
+                    for (std::size_t i = 0; i < length; ++i) {
+                        windowed[i] = frame[i] * state.window[i];
+                    }
+                }
+                std::vector<std::complex<double>> transformed;
+                state.fft.forwardRealBatch(input, end - begin, transformed);
+                std::ranges::copy(
+                    transformed,
+                    spectra.begin() +
+                        static_cast<std::ptrdiff_t>(begin * binsCount));
+            },
+            _params.threadsCount, FFT::BATCH_LANES);
+
+        // Recursive estimates and gains, several bins per thread
+        const std::size_t updateBegin =
+            std::clamp(warmUpCount, block, block + count) - block;
+        const std::size_t updateEnd =
+            std::clamp(fullCount, block, block + count) - block;
+        PAR::parallelFor(
+            binsCount,
+            [&](const std::size_t begin, const std::size_t end) {
+                suppress(state, spectra, count, updateBegin, updateEnd, begin,
+                         end);
+            },
+            _params.threadsCount, SDN::BINS_PER_CHUNK);
+        state.isInitialized = true;
+
+        // Inverse transforms and synthesis windowing, several frames per
+        // thread
+        PAR::parallelFor(
+            count,
+            [&](const std::size_t begin, const std::size_t end) {
+                const std::vector<std::complex<double>> input(
+                    spectra.begin() +
+                        static_cast<std::ptrdiff_t>(begin * binsCount),
+                    spectra.begin() +
+                        static_cast<std::ptrdiff_t>(end * binsCount));
+                std::vector<double> transformed;
+                state.fft.inverseRealBatch(input, end - begin, transformed);
+                for (std::size_t f = begin; f < end; ++f) {
+                    const double* frame =
+                        transformed.data() + (f - begin) * length;
+                    double* windowed = frames.data() + f * length;
+                    for (std::size_t i = 0; i < length; ++i) {
+                        windowed[i] = frame[i] * state.window[i];
+                    }
+                }
+            },
+            _params.threadsCount, FFT::BATCH_LANES);
+
+        // Overlap-add; the first hop of the accumulator is complete after
+        // every frame
+        for (std::size_t f = 0; f < count; ++f) {
+            const double* frame = frames.data() + f * length;
+            for (std::size_t i = 0; i < length; ++i) {
+                state.accumulator[i] += frame[i];
+            }
+            for (std::size_t i = 0; i < hop; ++i) {
+                if (state.skippedCount > 0) {
+                    --state.skippedCount;
+                } else {
+                    output.push_back(state.accumulator[i] /
+                                     state.normalization[i]);
+                }
+            }
+            std::copy(state.accumulator.begin() +
+                          static_cast<std::ptrdiff_t>(hop),
+                      state.accumulator.end(), state.accumulator.begin());
+            std::fill(state.accumulator.end() -
+                          static_cast<std::ptrdiff_t>(hop),
+                      state.accumulator.end(), 0.0);
+        }
+    }
+
+    state.history.erase(
+        state.history.begin(),
+        state.history.begin() + static_cast<std::ptrdiff_t>(framesCount * hop));
+    if (isFinal) {
+        // The last frame may complete padding samples beyond the signal
+        output.resize(output.size() - (framesCount * hop - available));
+        state.history.clear();
+    }
+    return output;
+}
+
+void TSpectralDenoiser::suppress(State&                             state,
+                                 std::vector<std::complex<double>>& spectra,
+                                 const std::size_t framesCount,
+                                 const std::size_t updateBegin,
+                                 const std::size_t updateEnd,
+                                 const std::size_t binBegin,
+                                 const std::size_t binEnd) {
+    const std::size_t binsCount = state.noisePower.size();
+    const bool        isWiener  = state.method == SDN::Method::Wiener;
+    const double      floorPower = state.gainFloor * state.gainFloor;
+    for (std::size_t k = binBegin; k < binEnd; ++k) {
+        double smoothed = state.smoothedPower[k];
+        double noise    = state.noisePower[k];
+        double clean    = state.cleanPower[k];
+        if (!state.isInitialized) {
+            smoothed = std::norm(spectra[updateBegin * binsCount + k]);
+            noise    = smoothed;
+            clean    = SDN::NOISE_BIAS * smoothed;
+        }
+
+        for (std::size_t f = 0; f < framesCount; ++f) {
+            std::complex<double>& bin   = spectra[f * binsCount + k];
+            const double          power = std::norm(bin);
+            if (f >= updateBegin && f < updateEnd) {
+                smoothed = state.smoothingFactor * smoothed +
+                           (1.0 - state.smoothingFactor) * power;
+                noise = noise > 0.0
+                            ? std::min(smoothed, noise * state.riseFactor)
+                            : smoothed;
+            }
+
+            const double estimate = SDN::NOISE_BIAS * noise;
+            double       gain     = 1.0;
+            if (estimate > 0.0 && isWiener) {
+                const double prior =
+                    state.priorSmoothing * clean / estimate +
+                    (1.0 - state.priorSmoothing) *
+                        std::max(power / estimate - 1.0, 0.0);
+                gain = std::max(prior / (1.0 + prior), state.gainFloor);
+            } else if (estimate > 0.0) {
+                gain = power > 0.0
+                           ? std::sqrt(std::max(
+                                 1.0 - state.overSubtraction * estimate / power,
+                                 floorPower))
+                           : state.gainFloor;
+            }
+            clean = gain * gain * power;
+            bin *= gain;
+        }
+
+        state.smoothedPower[k] = smoothed;
+        state.noisePower[k]    = noise;
+        state.cleanPower[k]    = clean;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,342 @@
+/**
+ * @file TSpectralDenoiser.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TSpectralDenoiser class removing
+ * broadband noise by spectral subtraction or Wiener filtering.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TFFT.hpp"
+#include "TSignalLine.hpp"
+#include "TWindow.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace SDN
+ * @brief Contains suppression rules and default parameters used for spectral
+ * denoising.
+ */
+namespace SDN {
+
+    /**
+     * @enum Method
+     * @brief Enumerates the suppression rules.
+     */
+    enum class Method : std::uint8_t {
+        SpectralSubtraction,  ///< Power spectral subtraction.
+        Wiener  ///< Wiener filter with the decision-directed a priori
+                ///< signal-to-noise ratio.
+    };
+
+    static constexpr auto DEFAULT_METHOD =
+        Method::Wiener;  ///< Default suppression rule.
+    static constexpr std::size_t DEFAULT_FRAME_LENGTH =
+        512;  ///< Default number of samples per frame (a power of two).
+    static constexpr double DEFAULT_OVERLAP =
+        0.75;  ///< Default fraction of overlap between adjacent frames.
+    static constexpr auto DEFAULT_WINDOW =
+        WIN::WindowType::Hann;  ///< Default analysis and synthesis window.
+    static constexpr double DEFAULT_SMOOTHING_FACTOR =
+        0.7;  ///< Default factor of the recursive smoothing of the bin powers.
+    static constexpr double DEFAULT_NOISE_RISE =
+        0.02;  ///< Default relative growth of the noise floor estimate allowed
+               ///< per frame.
+    static constexpr double DEFAULT_OVER_SUBTRACTION =
+        1.5;  ///< Default over-subtraction factor of spectral subtraction.
+    static constexpr double DEFAULT_PRIOR_SMOOTHING =
+        0.98;  ///< Default weight of the previous frame in the decision-
+               ///< directed a priori signal-to-noise ratio.
+    static constexpr double DEFAULT_GAIN_FLOOR =
+        0.05;  ///< Default smallest gain applied to a bin.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Spectral Denoiser";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr double NOISE_BIAS =
+        2.0;  ///< Compensation of the bias of the tracked minimum towards
+              ///< lower powers.
+    static constexpr double MIN_COVERAGE =
+        1e-3;  ///< Smallest overlap-added squared window relative to its
+               ///< largest value.
+    static constexpr std::size_t FRAMES_PER_BLOCK =
+        256;  ///< Number of frames transformed and filtered together.
+    static constexpr std::size_t BINS_PER_CHUNK =
+        16;  ///< Minimal number of bins filtered by one thread.
+
+}  // namespace SDN
+
+/**
+ * @struct TSpectralDenoiserParams
+ * @brief Contains parameters used for spectral denoising.
+ */
+struct TSpectralDenoiserParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to denoise (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<SDN::Method> method =
+        SDN::DEFAULT_METHOD;  ///< Suppression rule.
+    std::optional<std::size_t> frameLength =
+        SDN::DEFAULT_FRAME_LENGTH;  ///< Samples per frame (a power of two).
+    std::optional<double> overlap =
+        SDN::DEFAULT_OVERLAP;  ///< Fraction of overlap within [0, 1).
+    std::optional<WIN::WindowType> window =
+        SDN::DEFAULT_WINDOW;  ///< Analysis and synthesis window.
+    std::optional<double> smoothingFactor =
+        SDN::DEFAULT_SMOOTHING_FACTOR;  ///< Smoothing factor of the bin
+                                        ///< powers within [0, 1).
+    std::optional<double> noiseRise =
+        SDN::DEFAULT_NOISE_RISE;  ///< Relative growth of the noise floor
+                                  ///< estimate allowed per frame.
+    std::optional<double> overSubtraction =
+        SDN::DEFAULT_OVER_SUBTRACTION;  ///< Over-subtraction factor of
+                                        ///< spectral subtraction.
+    std::optional<double> priorSmoothing =
+        SDN::DEFAULT_PRIOR_SMOOTHING;  ///< Decision-directed weight of the
+                                       ///< Wiener filter within [0, 1).
+    std::optional<double> gainFloor =
+        SDN::DEFAULT_GAIN_FLOOR;  ///< Smallest gain within [0, 1].
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        SDN::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TSpectralDenoiser
+ * @brief Class for removing stationary broadband noise from a signal line by
+ * short-time spectral suppression.
+ *
+ * @details The signal is cut into frames of `frameLength` samples overlapping
+ * by `overlap`, windowed and transformed. Every bin is scaled by a gain and
+ * the frames are transformed back, windowed again and overlap-added; the sum
+ * is divided by the overlap-added squared window, so a unit gain reproduces
+ * the input exactly for any window and overlap.
+ *
+ * The noise floor is estimated continuously and needs no noise-only segment:
+ * the powers of every bin are smoothed over frames, and the estimate follows
+ * their minimum, rising by at most `noiseRise` per frame (minimum tracking).
+ * The minimum of a fluctuating power lies below its mean, so the tracked
+ * value is scaled by `SDN::NOISE_BIAS`. The gains are
+ *
+ * - spectral subtraction: `sqrt(max(1 - overSubtraction * N / P, floor^2))`;
+ * - Wiener: `xi / (1 + xi)`, where the a priori signal-to-noise ratio `xi`
+ * blends the cleaned power of the previous frame with the current excess
+ * power (decision-directed estimate), which suppresses musical noise;
+ *
+ * and never drop below `gainFloor`.
+ *
+ * The FFT plan and the window are created once per run. Frames are processed
+ * in blocks of `SDN::FRAMES_PER_BLOCK`: the transforms of the frames run on
+ * several threads, and the recursive estimates run on several threads over
+ * the bins, which are independent. `processBlock()` processes a stream block
+ * by block with the same kernel; the latency is `frameLength` samples at the
+ * start and less than one frame afterwards, and the returned samples equal
+ * those of `execute()` for the concatenated blocks.
+ */
+class TSpectralDenoiser {
+   public:
+    /**
+     * @brief Constructs a TSpectralDenoiser with a signal line.
+     *
+     * @param signalLine Pointer to the signal line to denoise.
+     * @param method Suppression rule.
+     * @param frameLength Samples per frame (a power of two).
+     * @param overlap Fraction of overlap between adjacent frames.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TSpectralDenoiser(
+        const TSignalLine*         signalLine,
+        std::optional<SDN::Method> method      = SDN::DEFAULT_METHOD,
+        std::optional<std::size_t> frameLength = SDN::DEFAULT_FRAME_LENGTH,
+        std::optional<double>      overlap     = SDN::DEFAULT_OVERLAP,
+        std::optional<std::string> xLabel      = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel      = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel  = SDN::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TSpectralDenoiser with denoising parameters.
+     *
+     * @param params Structure containing the parameters of the denoiser.
+     */
+    explicit TSpectralDenoiser(TSpectralDenoiserParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TSpectralDenoiser() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TSpectralDenoiser(const TSpectralDenoiser& denoiser);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TSpectralDenoiser(TSpectralDenoiser&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TSpectralDenoiser& operator=(const TSpectralDenoiser& denoiser);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TSpectralDenoiser& operator=(TSpectralDenoiser&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the denoised signal line.
+     *
+     * @return const TSignalLine* A pointer to the denoised signal line.
+     *
+     * @throw SignalProcessingError If the denoiser has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the parameters of the denoiser.
+     *
+     * @return const TSpectralDenoiserParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TSpectralDenoiserParams& getParams() const;
+
+    /**
+     * @brief Determines if the denoiser has been executed.
+     *
+     * @return bool True if the denoiser has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Denoises the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has fewer
+     * points than a frame, or if the parameters are invalid.
+     */
+    void execute();
+
+    /**
+     * @brief Processes the next block of a stream.
+     *
+     * @param samples Next input samples.
+     * @return std::vector<double> Output samples completed by the block.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] std::vector<double> processBlock(
+        std::span<const double> samples);
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    /**
+     * @struct State
+     * @brief Plan, window and recursive estimates of a run.
+     */
+    struct State {
+        TFFT                fft;          ///< Plan of the frame transform.
+        std::vector<double> window = {};  ///< Periodic frame window.
+        std::vector<double> normalization =
+            {};  ///< Overlap-added squared window per phase of the hop.
+        std::size_t hop = 0;  ///< Number of samples between frame starts.
+        SDN::Method method = SDN::DEFAULT_METHOD;  ///< Suppression rule.
+        double smoothingFactor = 0.0;  ///< Smoothing factor of the powers.
+        double riseFactor      = 1.0;  ///< Growth of the noise floor per frame.
+        double overSubtraction = 1.0;  ///< Over-subtraction factor.
+        double priorSmoothing  = 0.0;  ///< Decision-directed weight.
+        double gainFloor       = 0.0;  ///< Smallest gain.
+        std::vector<double> history =
+            {};  ///< Input from the start of the next frame on.
+        std::vector<double> accumulator =
+            {};  ///< Overlap-added output from the start of the next frame on.
+        std::vector<double> smoothedPower = {};  ///< Smoothed bin powers.
+        std::vector<double> noisePower = {};  ///< Tracked noise floor per bin.
+        std::vector<double> cleanPower =
+            {};  ///< Cleaned bin powers of the previous frame.
+        std::size_t skippedCount = 0;  ///< Leading padding samples still to be
+                                       ///< dropped from the output.
+        bool isInitialized = false;    ///< Flag indicating if the estimates
+                                       ///< have been initialized.
+    };
+
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the denoised signal line.
+    TSpectralDenoiserParams _params = {};  ///< Parameters of the denoiser.
+    std::optional<State>    _stream = std::nullopt;  ///< Stream state.
+    bool _isExecuted = false;  ///< Flag indicating if the denoiser has been
+                               ///< executed.
+
+    /**
+     * @brief Validates the parameters and creates a fresh state.
+     *
+     * @return State The initial state.
+     *
+     * @throws SignalProcessingError If the parameters are invalid.
+     */
+    [[nodiscard]] State makeState() const;
+
+    /**
+     * @brief Denoises the frames completed by a run of samples.
+     *
+     * @param state State to continue from; updated in place.
+     * @param samples Next input samples.
+     * @param isFinal True if no samples follow (the remaining samples are
+     * completed with zero padding).
+     * @return std::vector<double> Output samples completed by the run.
+     */
+    [[nodiscard]] std::vector<double> denoise(State&                  state,
+                                              std::span<const double> samples,
+                                              bool isFinal) const;
+
+    /**
+     * @brief Updates the estimates of a range of bins over a block of frames
+     * and applies the gains.
+     *
+     * @param state State holding the estimates of the bins.
+     * @param spectra Spectra of the frames, scaled in place.
+     * @param framesCount Number of frames.
+     * @param updateBegin First frame updating the noise floor; it also
+     * initializes the estimates if they have not been initialized.
+     * @param updateEnd One past the last frame updating the noise floor (the
+     * other frames only reuse it).
+     * @param binBegin First bin of the range.
+     * @param binEnd One past the last bin of the range.
+     */
+    static void suppress(State&                             state,
+                         std::vector<std::complex<double>>& spectra,
+                         std::size_t                        framesCount,
+                         std::size_t                        updateBegin,
+                         std::size_t                        updateEnd,
+                         std::size_t                        binBegin,
+                         std::size_t                        binEnd);
+};
\ No newline at end of file
@@ -0,0 +1,282 @@
+/**
+ * @file TStatistics.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TStatistics class computing
+ * descriptive statistics of signal lines in one pass.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TStatistics.hpp"
+#include "TCore.hpp"
+#include "TParallel.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief Computes the moments of one block held in cache.
+     *
+     * @param values The samples of the block (not empty).
+     * @return TMoments The moments.
+     */
+    TMoments reduceBlock(const std::span<const double> values) {
+        constexpr std::size_t lanes = STAT::LANES_COUNT;
+        const std::size_t     count = values.size();
+        const std::size_t     bulk  = count - count % lanes;
+        const double*         data  = values.data();
+
+        std::array<double, lanes> sums{};
+        std::array<double, lanes> minima;
+        std::array<double, lanes> maxima;
+        minima.fill(data[0]);
+        maxima.fill(data[0]);
+        for (std::size_t i = 0; i < bulk; i += lanes) {
+            for (std::size_t l = 0; l < lanes; ++l) {
+                const double value = data[i + l];
+                sums[l] += value;
+                minima[l] = value < minima[l] ? value : minima[l];
+                maxima[l] = value > maxima[l] ? value : maxima[l];
+            }
+        }
+        double sum     = 0.0;
+        double minimum = minima[0];
+        double maximum = maxima[0];
+        for (std::size_t l = 0; l < lanes; ++l) {
+            sum += sums[l];
+            minimum = std::min(minimum, minima[l]);
+            maximum = std::max(maximum, maxima[l]);
+        }
+        for (std::size_t i = bulk; i < count; ++i) {
+            sum += data[i];
+            minimum = std::min(minimum, data[i]);
+            maximum = std::max(maximum, data[i]);
+        }
+        const double mean = sum / static_cast<double>(count);
+
+        // Central power sums around the block mean
+        std::array<double, lanes> squares{};
+        std::array<double, lanes> cubes{};
+        std::array<double, lanes> fourths{};
+        for (std::size_t i = 0; i < bulk; i += lanes) {
+            for (std::size_t l = 0; l < lanes; ++l) {
+                const double deviation = data[i + l] - mean;
+                const double square    = deviation * deviation;
+                squares[l] += square;
+                cubes[l] += square * deviation;
+                fourths[l] += square * square;
+            }
+        }
+        TMoments moments{.count   = count,
+                         .mean    = mean,
+                         .minimum = minimum,
+                         .maximum = maximum};
+        for (std::size_t l = 0; l < lanes; ++l) {
+            moments.m2 += squares[l];
+            moments.m3 += cubes[l];
+            moments.m4 += fourths[l];
+        }
+        for (std::size_t i = bulk; i < count; ++i) {
+            const double deviation = data[i] - mean;
+            const double square    = deviation * deviation;
+            moments.m2 += square;
+            moments.m3 += square * deviation;
+            moments.m4 += square * square;
+        }
+        return moments;
+    }
+
+    /**
+     * @brief Computes the moments of every block of a run of samples.
+     *
+     * @param values The samples.
+     * @param begin Index of the first block.
+     * @param end Index past the last block.
+     * @param moments Receives the moments of the blocks.
+     */
+    void reduceBlocks(const std::span<const double> values,
+                      const std::size_t             begin,
+                      const std::size_t             end,
+                      std::vector<TMoments>&        moments) {
+        for (std::size_t b = begin; b < end; ++b) {
+            const std::size_t first = b * STAT::SAMPLES_PER_BLOCK;
+            const std::size_t length =
+                std::min(STAT::SAMPLES_PER_BLOCK, values.size() - first);
+            moments[b] = reduceBlock(values.subspan(first, length));
+        }
+    }
+
+    /**
+     * @brief Merges the moments of consecutive blocks in order.
+     *
+     * @param moments Moments of the blocks.
+     * @return TMoments The moments of all blocks.
+     */
+    TMoments mergeAll(const std::vector<TMoments>& moments) {
+        TMoments total;
+        for (const TMoments& block : moments) {
+            total = STAT::merge(total, block);
+        }
+        return total;
+    }
+
+}  // namespace
+
+TMoments STAT::accumulate(const std::span<const double> values) {
+    const std::size_t blocksCount =
+        (values.size() + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK;
+    std::vector<TMoments> moments(blocksCount);
+    reduceBlocks(values, 0, blocksCount, moments);
+    return mergeAll(moments);
+}
+
+TMoments STAT::merge(const TMoments& first, const TMoments& second) {
+    if (first.count == 0) {
+        return second;
+    }
+    if (second.count == 0) {
+        return first;
+    }
+    const auto   countA = static_cast<double>(first.count);
+    const auto   countB = static_cast<double>(second.count);
+    const double count  = countA + countB;
+    const double delta  = second.mean - first.mean;
+    const double delta2 = delta * delta;
+    const double weight = countA * countB / count;
+
+    TMoments result;
+    result.count = first.count + second.count;
+    result.mean  = first.mean + delta * countB / count;
+    result.m2    = first.m2 + second.m2 + delta2 * weight;
+    result.m3    = first.m3 + second.m3 +
+                delta2 * delta * weight * (countA - countB) / count +
+                3.0 * delta * (countA * second.m2 - countB * first.m2) / count;
+    result.m4 =
+        first.m4 + second.m4 +
+        delta2 * delta2 * weight *
+            (countA * countA - countA * countB + countB * countB) /
+            (count * count) +
+        6.0 * delta2 *
+            (countA * countA * second.m2 + countB * countB * first.m2) /
+            (count * count) +
+        4.0 * delta * (countA * second.m3 - countB * first.m3) / count;
+    result.minimum = std::min(first.minimum, second.minimum);
+    result.maximum = std::max(first.maximum, second.maximum);
+    return result;
+}
+
+TDescriptiveStatistics STAT::describe(const TMoments& moments) {
+    if (moments.count == 0) {
+        return {};
+    }
+    const auto   count    = static_cast<double>(moments.count);
+    const double variance = moments.m2 / count;
+
+    TDescriptiveStatistics statistics;
+    statistics.count             = moments.count;
+    statistics.mean              = moments.mean;
+    statistics.variance          = variance;
+    statistics.standardDeviation = sqrt(variance);
+    if (variance > 0.0) {
+        statistics.skewness = moments.m3 / count / (variance * sqrt(variance));
+        statistics.kurtosis = moments.m4 / count / (variance * variance);
+    }
+    statistics.minimum    = moments.minimum;
+    statistics.maximum    = moments.maximum;
+    statistics.peakToPeak = moments.maximum - moments.minimum;
+    statistics.energy     = moments.m2 + count * moments.mean * moments.mean;
+    statistics.rms        = sqrt(statistics.energy / count);
+    if (statistics.rms > 0.0) {
+        statistics.crestFactor =
+            std::max(std::abs(moments.minimum), std::abs(moments.maximum)) /
+            statistics.rms;
+    }
+    return statistics;
+}
+
+/*
+ * PUBLIC METHODS
+ */
+
+TStatistics::TStatistics(const TSignalLine* signalLine)
+    : _params{.signalLine = signalLine} {}
+
+TStatistics::TStatistics(TStatisticsParams params)
+    : _params(std::move(params)) {}
+
+const TDescriptiveStatistics& TStatistics::getStatistics() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Statistics not executed");
+    }
+    return _statistics;
+}
+
+const TMoments& TStatistics::getMoments() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Statistics not executed");
+    }
+    return _moments;
+}
+
+const TStatisticsParams& TStatistics::getParams() const {
+    return _params;
+}
+
+bool TStatistics::isExecuted() const {
+    return _isExecuted;
+}
+
+void TStatistics::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TStatistics object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    if (pointsCount == 0) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    std::vector<double> values(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        values[i] = points[i].y;
+    }
+
+    const std::size_t blocksCount =
+        (pointsCount + STAT::SAMPLES_PER_BLOCK - 1) / STAT::SAMPLES_PER_BLOCK;
+    std::vector<TMoments> moments(blocksCount);
+    PAR::parallelFor(
+        blocksCount,
+        [&](const std::size_t begin, const std::size_t end) {
+            reduceBlocks(values, begin, end, moments);
+        },
+        _params.threadsCount, STAT::BLOCKS_PER_CHUNK);
+
+    _moments    = mergeAll(moments);
+    _statistics = STAT::describe(_moments);
+    _isExecuted = true;
+}
+
+TDescriptiveStatistics TStatistics::processBlock(
+    const std::span<const double> samples) {
+    _stream = STAT::merge(_stream, STAT::accumulate(samples));
+    return STAT::describe(_stream);
+}
+
+const TMoments& TStatistics::getStreamMoments() const {
+    return _stream;
+}
+
+void TStatistics::reset() {
+    _stream = {};
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+/**
+ * @file TStatistics.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TStatistics class computing
+ * descriptive statistics of signal lines in one pass.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+
+/**
+ * @struct TMoments
+ * @brief Contains the mergeable partial result of a statistics pass: the
+ * count, the mean, the central moment sums and the extrema of a run of
+ * samples.
+ */
+struct TMoments {
+    std::size_t count = 0;    ///< Number of samples.
+    double      mean  = 0.0;  ///< Mean value.
+    double      m2    = 0.0;  ///< Sum of squared deviations from the mean.
+    double      m3    = 0.0;  ///< Sum of cubed deviations from the mean.
+    double      m4    = 0.0;  ///< Sum of fourth powers of the deviations.
+    double      minimum =
+        std::numeric_limits<double>::infinity();  ///< Minimal value.
+    double maximum =
+        -std::numeric_limits<double>::infinity();  ///< Maximal value.
+};
+
+/**
+ * @struct TDescriptiveStatistics
+ * @brief Contains the descriptive statistics of a run of samples.
+ */
+struct TDescriptiveStatistics {
+    std::size_t count             = 0;    ///< Number of samples.
+    double      mean              = 0.0;  ///< Mean value.
+    double      variance          = 0.0;  ///< Population variance.
+    double      standardDeviation = 0.0;  ///< Population standard deviation.
+    double      skewness          = 0.0;  ///< Skewness (zero if constant).
+    double      kurtosis = 0.0;  ///< Kurtosis, 3 for a normal distribution
+                                 ///< (zero if constant).
+    double minimum    = 0.0;  ///< Minimal value.
+    double maximum    = 0.0;  ///< Maximal value.
+    double peakToPeak = 0.0;  ///< Difference between the extrema.
+    double energy     = 0.0;  ///< Sum of the squared values.
+    double rms        = 0.0;  ///< Root mean square.
+    double crestFactor =
+        0.0;  ///< Ratio of the peak magnitude to the RMS (zero if silent).
+};
+
+/**
+ * @namespace STAT
+ * @brief Contains the one-pass statistics kernel and its parameters.
+ */
+namespace STAT {
+
+    // Kernel parameters
+    static constexpr std::size_t SAMPLES_PER_BLOCK =
+        1024;  ///< Number of samples reduced in cache before merging.
+    static constexpr std::size_t LANES_COUNT =
+        4;  ///< Number of independent partial sums within a block.
+    static constexpr std::size_t BLOCKS_PER_CHUNK =
+        16;  ///< Minimal number of blocks reduced by one thread.
+
+    /**
+     * @brief Computes the moments of a run of samples.
+     * @details The samples are reduced in blocks of `STAT::SAMPLES_PER_BLOCK`:
+     * the block mean first, then the central power sums around it, both in
+     * `STAT::LANES_COUNT` independent lanes so that the loops are vectorized
+     * without reordering floating-point sums. The blocks are combined by
+     * merge(), which keeps the result accurate for long runs with a large
+     * offset.
+     *
+     * @param values The samples.
+     * @return TMoments The moments (a zero count for no samples).
+     */
+    [[nodiscard]] TMoments accumulate(std::span<const double> values);
+
+    /**
+     * @brief Merges the moments of two disjoint runs of samples (pairwise
+     * update of Pébay).
+     *
+     * @param first Moments of the first run.
+     * @param second Moments of the second run.
+     * @return TMoments The moments of both runs.
+     */
+    [[nodiscard]] TMoments merge(const TMoments& first, const TMoments& second);
+
+    /**
+     * @brief Derives the descriptive statistics from the moments.
+     *
+     * @param moments The moments.
+     * @return TDescriptiveStatistics The statistics (all zero for no samples).
+     */
+    [[nodiscard]] TDescriptiveStatistics describe(const TMoments& moments);
+
+}  // namespace STAT
+
+/**
+ * @struct TStatisticsParams
+ * @brief Contains parameters used for computing descriptive statistics.
+ */
+struct TStatisticsParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to describe (not needed for
+                  ///< streaming).
+
+    // Calculation Parameters
+    std::optional<std::size_t> threadsCount =
+        std::nullopt;  ///< Number of threads. If not set, the number of
+                       ///< hardware threads is used.
+};
+
+/**
+ * @class TStatistics
+ * @brief Class for computing the mean, variance, skewness, kurtosis, extrema,
+ * energy, RMS and crest factor of a signal line in one pass.
+ *
+ * @details The line is split into blocks whose moments are computed on several
+ * threads (see STAT::accumulate()) and merged in order, so the result does not
+ * depend on the number of threads. Streams are described block by block: every
+ * processed block is merged into the running moments.
+ */
+class TStatistics {
+   public:
+    /**
+     * @brief Constructs a TStatistics with a signal line.
+     *
+     * @param signalLine Pointer to the signal line to describe.
+     */
+    explicit TStatistics(const TSignalLine* signalLine);
+
+    /**
+     * @brief Constructs a TStatistics with calculation parameters.
+     *
+     * @param params Structure containing the parameters of the calculation.
+     */
+    explicit TStatistics(TStatisticsParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TStatistics() = default;
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TStatistics(const TStatistics&) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TStatistics(TStatistics&&) noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TStatistics& operator=(const TStatistics&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TStatistics& operator=(TStatistics&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the statistics of the signal line.
+     *
+     * @return const TDescriptiveStatistics& A constant reference to the
+     * statistics.
+     *
+     * @throw SignalProcessingError If the calculation has not been executed.
+     */
+    [[nodiscard]] const TDescriptiveStatistics& getStatistics() const;
+
+    /**
+     * @brief Retrieves the moments of the signal line, e.g. to merge them with
+     * the moments of other lines.
+     *
+     * @return const TMoments& A constant reference to the moments.
+     *
+     * @throw SignalProcessingError If the calculation has not been executed.
+     */
+    [[nodiscard]] const TMoments& getMoments() const;
+
+    /**
+     * @brief Retrieves the parameters of the calculation.
+     *
+     * @return const TStatisticsParams& A constant reference to the parameters.
+     */
+    [[nodiscard]] const TStatisticsParams& getParams() const;
+
+    /**
+     * @brief Determines if the calculation has been executed.
+     *
+     * @return bool True if the calculation has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Computes the statistics of the whole signal line.
+     * @details The stream state used by `processBlock()` is not affected.
+     *
+     * @throws SignalProcessingError If the signal line is null or has no
+     * points.
+     */
+    void execute();
+
+    /**
+     * @brief Merges the next block of a stream into the running moments.
+     *
+     * @param samples Next samples.
+     * @return TDescriptiveStatistics The statistics of the stream so far.
+     */
+    TDescriptiveStatistics processBlock(std::span<const double> samples);
+
+    /**
+     * @brief Retrieves the running moments of the stream.
+     *
+     * @return const TMoments& A constant reference to the moments (a zero
+     * count before the first block).
+     */
+    [[nodiscard]] const TMoments& getStreamMoments() const;
+
+    /**
+     * @brief Clears the stream state so that a new stream can be processed.
+     */
+    void reset();
+
+   private:
+    TDescriptiveStatistics _statistics = {};  ///< Statistics of the line.
+    TMoments               _moments    = {};  ///< Moments of the line.
+    TMoments               _stream     = {};  ///< Running moments of the
+                                              ///< stream.
+    TStatisticsParams _params = {};  ///< Parameters of the calculation.
+    bool _isExecuted = false;  ///< Flag indicating if the calculation has
+                               ///< been executed.
+};
\ No newline at end of file
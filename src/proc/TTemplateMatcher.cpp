@@ -0,0 +1,242 @@
+/**
+ * @file TTemplateMatcher.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TTemplateMatcher class searching a
+ * signal line for occurrences of a template with the sliding normalized
+ * cross-correlation.
+ * @version 2.2.0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TTemplateMatcher.hpp"
+#include "TCore.hpp"
+#include "TFFT.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * PUBLIC METHODS
+ */
+
+TTemplateMatcher::TTemplateMatcher(const TSignalLine*          signalLine,
+                                   const TSignalLine*          templateLine,
+                                   const std::optional<double> threshold,
+                                   const std::optional<bool>   useAbsoluteValue,
+                                   std::optional<std::string>  xLabel,
+                                   std::optional<std::string>  yLabel,
+                                   std::optional<std::string>  graphLabel)
+    : _params{.signalLine       = signalLine,
+              .templateLine     = templateLine,
+              .threshold        = threshold,
+              .useAbsoluteValue = useAbsoluteValue,
+              .xLabel           = std::move(xLabel),
+              .yLabel           = std::move(yLabel),
+              .graphLabel       = std::move(graphLabel)} {}
+
+TTemplateMatcher::TTemplateMatcher(TTemplateMatcherParams params)
+    : _params(std::move(params)) {}
+
+TTemplateMatcher::TTemplateMatcher(const TTemplateMatcher& matcher)
+    : _sl(matcher._sl ? std::make_unique<TSignalLine>(*matcher._sl)
+                      : nullptr),
+      _matches(matcher._matches),
+      _params(matcher._params),
+      _isExecuted(matcher._isExecuted) {}
+
+TTemplateMatcher& TTemplateMatcher::operator=(const TTemplateMatcher& matcher) {
+    if (this == &matcher) {
+        return *this;
+    }
+    _sl = matcher._sl ? std::make_unique<TSignalLine>(*matcher._sl) : nullptr;
+    _matches    = matcher._matches;
+    _params     = matcher._params;
+    _isExecuted = matcher._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TTemplateMatcher::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Template matcher not executed");
+    }
+    return _sl.get();
+}
+
+const std::vector<TTemplateMatch>& TTemplateMatcher::getMatches() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Template matcher not executed");
+    }
+    return _matches;
+}
+
+const TTemplateMatcherParams& TTemplateMatcher::getParams() const {
+    return _params;
+}
+
+bool TTemplateMatcher::isExecuted() const {
+    return _isExecuted;
+}
+
+void TTemplateMatcher::execute() {
+    // We're ensuring that the signal lines are not null here because they may
+    // be set after the TTemplateMatcher object creation.
+    if (_params.signalLine == nullptr || _params.templateLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+
+    const auto&       signal        = _params.signalLine->getPoints();
+    const auto&       pattern       = _params.templateLine->getPoints();
+    const std::size_t signalCount   = signal.size();
+    const std::size_t templateCount = pattern.size();
+    if (templateCount < 2) {
+        throw SignalProcessingError("Insufficient number of template points");
+    }
+    if (templateCount > signalCount) {
+        throw SignalProcessingError(
+            "Template should not be longer than the signal line");
+    }
+
+    // Zero-mean template and its norm
+    double templateMean = 0.0;
+    for (const auto& point : pattern) {
+        templateMean += point.y;
+    }
+    templateMean /= static_cast<double>(templateCount);
+    double templateNorm = 0.0;
+    for (const auto& point : pattern) {
+        templateNorm += (point.y - templateMean) * (point.y - templateMean);
+    }
+    templateNorm = sqrt(templateNorm);
+    if (templateNorm == 0.0) {
+        throw SignalProcessingError("Template line should not be constant");
+    }
+
+    // The NCC does not depend on the signal offset, so the global mean is
+    // removed first to reduce cancellation in the local energies.
+    double signalMean = 0.0;
+    for (const auto& point : signal) {
+        signalMean += point.y;
+    }
+    signalMean /= static_cast<double>(signalCount);
+
+    // Numerators of all offsets: IFFT(S * conj(T)) holds
+    // sum(t[j] * s[k + j]), and no wrap-around occurs because k + j stays
+    // below the signal length.
+    const std::size_t   fftSize = TFFT::nextPowerOfTwo(signalCount);
+    const TFFT          fft(fftSize);
+    std::vector<double> samples(2 * fftSize, 0.0);
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        samples[i] = signal[i].y - signalMean;
+    }
+    for (std::size_t j = 0; j < templateCount; ++j) {
+        samples[fftSize + j] = pattern[j].y - templateMean;
+    }
+    std::vector<std::complex<double>> spectra;
+    fft.forwardRealBatch(samples, 2, spectra);
+
+    const std::size_t                 spectrumSize = fftSize / 2 + 1;
+    std::vector<std::complex<double>> product(spectrumSize);
+    for (std::size_t k = 0; k < spectrumSize; ++k) {
+        const auto& lhs = spectra[k];
+        const auto& rhs = spectra[spectrumSize + k];
+        product[k]      = {lhs.real() * rhs.real() + lhs.imag() * rhs.imag(),
+                           lhs.imag() * rhs.real() - lhs.real() * rhs.imag()};
+    }
+    std::vector<double> numerators;
+    fft.inverseReal(product, numerators);
+
+    // Local window energies as differences of prefix sums, which do not drift
+    // along the signal
+    std::vector<double> prefixSum(signalCount + 1, 0.0);
+    std::vector<double> prefixSquare(signalCount + 1, 0.0);
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        const double value  = signal[i].y - signalMean;
+        prefixSum[i + 1]    = prefixSum[i] + value;
+        prefixSquare[i + 1] = prefixSquare[i] + value * value;
+    }
+
+    const std::size_t  offsetsCount = signalCount - templateCount + 1;
+    const double       windowLength = static_cast<double>(templateCount);
+    std::vector<Point> nccPoints(offsetsCount);
+    for (std::size_t k = 0; k < offsetsCount; ++k) {
+        const double windowSum = prefixSum[k + templateCount] - prefixSum[k];
+        const double windowSquare =
+            prefixSquare[k + templateCount] - prefixSquare[k];
+        const double variance =
+            windowSquare - windowSum * windowSum / windowLength;
+        double ncc = 0.0;
+        if (variance > TM::VARIANCE_EPSILON * windowSquare && variance > 0.0) {
+            ncc = numerators[k] / (templateNorm * sqrt(variance));
+            ncc = std::clamp(ncc, -1.0, 1.0);
+        }
+        nccPoints[k] = Point{.x = signal[k].x, .y = ncc};
+    }
+
+    // The NCC line covers the offsets grid only, so its duration is shorter
+    // than the one of the signal line by the template length
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    if (slParams.samplingFrequency) {
+        slParams.duration = static_cast<double>(offsetsCount - 1) /
+                            *slParams.samplingFrequency;
+    }
+    slParams.xLabel      = _params.xLabel;
+    slParams.yLabel      = _params.yLabel;
+    slParams.graphLabel  = _params.graphLabel;
+    slParams.pointsCount = offsetsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(nccPoints));
+
+    // Offsets above the threshold, strongest first, skipping the ones that
+    // overlap an accepted match
+    const double threshold = _params.threshold.value_or(TM::DEFAULT_THRESHOLD);
+    const bool   useAbsoluteValue =
+        _params.useAbsoluteValue.value_or(TM::DEFAULT_USE_ABSOLUTE_VALUE);
+    const auto& ncc      = _sl->getPoints();
+    const auto  strength = [&](const std::size_t k) {
+        return useAbsoluteValue ? std::abs(ncc[k].y) : ncc[k].y;
+    };
+
+    std::vector<std::size_t> candidates;
+    for (std::size_t k = 0; k < offsetsCount; ++k) {
+        if (strength(k) >= threshold) {
+            candidates.push_back(k);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&](const std::size_t lhs, const std::size_t rhs) {
+                         return strength(lhs) > strength(rhs);
+                     });
+
+    // Occupied offsets are tracked in a sorted list of accepted matches
+    std::vector<std::size_t> accepted;
+    for (const std::size_t candidate : candidates) {
+        const auto next =
+            std::lower_bound(accepted.begin(), accepted.end(), candidate);
+        const bool overlapsNext =
+            next != accepted.end() && *next - candidate < templateCount;
+        const bool overlapsPrevious =
+            next != accepted.begin() && candidate - *(next - 1) < templateCount;
+        if (!overlapsNext && !overlapsPrevious) {
+            accepted.insert(next, candidate);
+        }
+    }
+
+    _matches.clear();
+    _matches.reserve(accepted.size());
+    for (const std::size_t index : accepted) {
+        _matches.push_back(TTemplateMatch{
+            .index = index, .x = ncc[index].x, .value = ncc[index].y});
+    }
+
+    _isExecuted = true;
+}
\ No newline at end of file
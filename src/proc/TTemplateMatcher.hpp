@@ -0,0 +1,212 @@
+/**
+ * @file TTemplateMatcher.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TTemplateMatcher class searching a
+ * signal line for occurrences of a template with the sliding normalized
+ * cross-correlation.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace TM
+ * @brief Contains default parameters used for template matching.
+ */
+namespace TM {
+
+    static constexpr double DEFAULT_THRESHOLD =
+        0.8;  ///< Default normalized cross-correlation threshold of a match.
+    static constexpr bool DEFAULT_USE_ABSOLUTE_VALUE =
+        false;  ///< Default flag indicating whether inverted occurrences
+                ///< (negative correlation) are detected as matches.
+    static const std::string DEFAULT_Y_LABEL =
+        "Normalized Cross-Correlation";  ///< Default label for the y-axis.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Template Matching";  ///< Default graph label.
+
+    // Kernel parameters
+    static constexpr double VARIANCE_EPSILON =
+        1e-12;  ///< Relative window variance below which the window is treated
+                ///< as constant (zero correlation).
+
+}  // namespace TM
+
+/**
+ * @struct TTemplateMatch
+ * @brief Describes one occurrence of the template in the signal line.
+ */
+struct TTemplateMatch {
+    std::size_t index =
+        0;  ///< Index of the signal point where the occurrence starts.
+    double x     = 0.0;  ///< x-coordinate where the occurrence starts.
+    double value = 0.0;  ///< Normalized cross-correlation of the occurrence.
+};
+
+/**
+ * @struct TTemplateMatcherParams
+ * @brief Contains parameters used for template matching.
+ */
+struct TTemplateMatcherParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to search.
+    const TSignalLine* templateLine =
+        nullptr;  ///< Pointer to the template signal line.
+
+    // Calculation Parameters
+    std::optional<double> threshold =
+        TM::DEFAULT_THRESHOLD;  ///< Normalized cross-correlation threshold of
+                                ///< a match.
+    std::optional<bool> useAbsoluteValue =
+        TM::DEFAULT_USE_ABSOLUTE_VALUE;  ///< Flag indicating whether inverted
+                                         ///< occurrences are detected.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        TM::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        TM::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TTemplateMatcher
+ * @brief Class for finding occurrences of a template in a signal line.
+ *
+ * @details The normalized cross-correlation (NCC) of the template with every
+ * window of the signal is computed:
+ *
+ * `ncc[k] = sum((t[j] - mean(t)) * s[k + j]) /
+ *           (|t - mean(t)| * |s[k..k+M) - mean(s[k..k+M))|)`
+ *
+ * The numerators of all offsets are computed at once via FFT, and the local
+ * window energies are differences of prefix sums of the signal and its square,
+ * so the cost is O(N log N) regardless of the template length. The NCC is
+ * invariant to the offset and the scale of the signal, so it lies within
+ * [-1, 1].
+ *
+ * Matches are selected greedily: the offsets whose NCC reaches the threshold
+ * are accepted from the strongest down, skipping every offset closer than the
+ * template length to an already accepted match.
+ */
+class TTemplateMatcher {
+   public:
+    /**
+     * @brief Constructs a TTemplateMatcher with a signal line and a template.
+     *
+     * @param signalLine Pointer to the signal line to search.
+     * @param templateLine Pointer to the template signal line.
+     * @param threshold Normalized cross-correlation threshold of a match.
+     * @param useAbsoluteValue Flag indicating whether inverted occurrences are
+     * detected.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    TTemplateMatcher(
+        const TSignalLine*    signalLine,
+        const TSignalLine*    templateLine,
+        std::optional<double> threshold = TM::DEFAULT_THRESHOLD,
+        std::optional<bool>   useAbsoluteValue = TM::DEFAULT_USE_ABSOLUTE_VALUE,
+        std::optional<std::string> xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string> yLabel     = TM::DEFAULT_Y_LABEL,
+        std::optional<std::string> graphLabel = TM::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TTemplateMatcher with template matching parameters.
+     *
+     * @param params Structure containing the parameters for template matching.
+     */
+    explicit TTemplateMatcher(TTemplateMatcherParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TTemplateMatcher() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TTemplateMatcher(const TTemplateMatcher& matcher);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TTemplateMatcher(TTemplateMatcher&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TTemplateMatcher& operator=(const TTemplateMatcher& matcher);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TTemplateMatcher& operator=(TTemplateMatcher&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the normalized cross-correlation signal line.
+     *
+     * @return const TSignalLine* A pointer to the signal line with one point
+     * per offset of the template (x-coordinate of the window start, NCC value).
+     *
+     * @throw SignalProcessingError If the matcher has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the detected matches.
+     *
+     * @return const std::vector<TTemplateMatch>& The matches sorted by their
+     * position in the signal line.
+     *
+     * @throw SignalProcessingError If the matcher has not been executed.
+     */
+    [[nodiscard]] const std::vector<TTemplateMatch>& getMatches() const;
+
+    /**
+     * @brief Retrieves the parameters of the template matcher.
+     *
+     * @return const TTemplateMatcherParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TTemplateMatcherParams& getParams() const;
+
+    /**
+     * @brief Determines if the template matcher has been executed.
+     *
+     * @return bool True if the template matcher has been executed, false
+     * otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Executes the template matching.
+     *
+     * @throws SignalProcessingError If one of the signal lines is null, if the
+     * template has less than two points or more points than the signal line,
+     * or if the template is constant.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the NCC signal line.
+    std::vector<TTemplateMatch> _matches = {};  ///< Detected matches.
+    TTemplateMatcherParams      _params =
+        {};                    ///< Parameters of the template matcher.
+    bool _isExecuted = false;  ///< Flag indicating if the template matcher has
+                               ///< been executed.
+};
\ No newline at end of file
@@ -0,0 +1,382 @@
+/**
+ * @file TWaveletTransform.cpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the implementation of the TWaveletTransform class performing
+ * multilevel discrete wavelet decomposition and threshold denoising of signal
+ * lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TWaveletTransform.hpp"
+#include "TCore.hpp"
+#include "TSignalLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+     * @struct LiftingStep
+     * @brief One lifting step: the odd (predict) or even (update) samples are
+     * increased by a combination of their neighbours of the other parity.
+     */
+    struct LiftingStep {
+        bool   isOdd    = true;  ///< True if the odd samples are lifted.
+        double current  = 0.0;   ///< Weight of the neighbour with equal index.
+        double previous = 0.0;   ///< Weight of the neighbour with index - 1.
+        double next     = 0.0;   ///< Weight of the neighbour with index + 1.
+    };
+
+    /**
+     * @struct Lifting
+     * @brief Factorization of a wavelet into lifting steps.
+     */
+    struct Lifting {
+        std::vector<LiftingStep> steps = {};  ///< Steps in forward order.
+        double evenScale = 1.0;  ///< Final scale of the approximation.
+        double oddScale  = 1.0;  ///< Final scale of the detail.
+    };
+
+    /**
+     * @brief Returns the lifting factorization of a wavelet.
+     *
+     * @param wavelet Wavelet.
+     * @return Lifting The lifting steps and scales.
+     *
+     * @throws SignalProcessingError If the wavelet is unknown.
+     */
+    Lifting makeLifting(const DWT::Wavelet wavelet) {
+        const double sqrt2 = std::sqrt(2.0);
+        const double sqrt3 = std::sqrt(3.0);
+        switch (wavelet) {
+            case DWT::Wavelet::Haar:
+                return Lifting{.steps     = {{.isOdd = true, .current = -1.0},
+                                             {.isOdd = false, .current = 0.5}},
+                               .evenScale = sqrt2,
+                               .oddScale  = 1.0 / sqrt2};
+            case DWT::Wavelet::Daubechies4:
+                return Lifting{
+                    .steps     = {{.isOdd = false, .current = sqrt3},
+                                  {.isOdd    = true,
+                                   .current  = -sqrt3 / 4.0,
+                                   .previous = -(sqrt3 - 2.0) / 4.0},
+                                  {.isOdd = false, .next = -1.0}},
+                    .evenScale = (sqrt3 - 1.0) / sqrt2,
+                    .oddScale  = (sqrt3 + 1.0) / sqrt2};
+            case DWT::Wavelet::CDF97: {
+                const double alpha = -1.586134342059924;
+                const double beta  = -0.052980118572961;
+                const double gamma = 0.882911075530934;
+                const double delta = 0.443506852043971;
+                const double kappa = 1.149604398860241;
+                return Lifting{
+                    .steps     = {{.isOdd   = true,
+                                   .current = alpha,
+                                   .next    = alpha},
+                                  {.isOdd    = false,
+                                   .current  = beta,
+                                   .previous = beta},
+                                  {.isOdd   = true,
+                                   .current = gamma,
+                                   .next    = gamma},
+                                  {.isOdd    = false,
+                                   .current  = delta,
+                                   .previous = delta}},
+                    .evenScale = kappa,
+                    .oddScale  = 1.0 / kappa};
+            }
+            default:
+                throw SignalProcessingError("Unknown wavelet");
+        }
+    }
+
+    /**
+     * @brief Applies a lifting step to interleaved samples with periodic
+     * boundaries.
+     *
+     * @param data Interleaved even and odd samples (`2 * half` values).
+     * @param half Number of samples of each parity.
+     * @param step Lifting step.
+     * @param sign 1 for the forward step, -1 to undo it.
+     */
+    void lift(double*            data,
+              const std::size_t  half,
+              const LiftingStep& step,
+              const double       sign) {
+        double*       target   = data + (step.isOdd ? 1 : 0);
+        const double* source   = data + (step.isOdd ? 0 : 1);
+        const double  current  = sign * step.current;
+        const double  previous = sign * step.previous;
+        const double  next     = sign * step.next;
+
+        const auto update = [&](const std::size_t i, const std::size_t p,
+                                const std::size_t n) {
+            target[2 * i] += current * source[2 * i] +
+                             previous * source[2 * p] + next * source[2 * n];
+        };
+        // The boundary samples wrap around; the interior loop does not
+        update(0, half - 1, half > 1 ? 1 : 0);
+        for (std::size_t i = 1; i + 1 < half; ++i) {
+            update(i, i - 1, i + 1);
+        }
+        if (half > 1) {
+            update(half - 1, half - 2, 0);
+        }
+    }
+
+    /**
+     * @brief Checks that the data can be transformed over the given levels.
+     *
+     * @param size Number of values.
+     * @param levels Number of levels.
+     *
+     * @throws SignalProcessingError If the size is not a positive multiple of
+     * `2^levels`.
+     */
+    void checkSize(const std::size_t size, const std::size_t levels) {
+        if (levels == 0 || levels >= std::numeric_limits<std::size_t>::digits) {
+            throw SignalProcessingError("Invalid number of levels");
+        }
+        const std::size_t block = std::size_t{1} << levels;
+        if (size == 0 || size % block != 0) {
+            throw SignalProcessingError(
+                "Data size should be a positive multiple of 2^levels");
+        }
+    }
+
+}  // namespace
+
+void DWT::decompose(std::vector<double>& data,
+                    const Wavelet        wavelet,
+                    const std::size_t    levels) {
+    checkSize(data.size(), levels);
+    const Lifting       lifting = makeLifting(wavelet);
+    std::vector<double> details(data.size() / 2);
+
+    for (std::size_t length = data.size(), level = 0; level < levels;
+         length /= 2, ++level) {
+        const std::size_t half = length / 2;
+        for (const auto& step : lifting.steps) {
+            lift(data.data(), half, step, 1.0);
+        }
+        // Even samples become the next approximation block, odd ones follow
+        for (std::size_t i = 0; i < half; ++i) {
+            details[i] = data[2 * i + 1] * lifting.oddScale;
+            data[i]    = data[2 * i] * lifting.evenScale;
+        }
+        std::copy(details.begin(),
+                  details.begin() + static_cast<std::ptrdiff_t>(half),
+                  data.begin() + static_cast<std::ptrdiff_t>(half));
+    }
+}
+
+void DWT::reconstruct(std::vector<double>& data,
+                      const Wavelet        wavelet,
+                      const std::size_t    levels) {
+    checkSize(data.size(), levels);
+    const Lifting       lifting = makeLifting(wavelet);
+    std::vector<double> details(data.size() / 2);
+
+    for (std::size_t level = levels; level-- > 0;) {
+        const std::size_t half = data.size() >> (level + 1);
+        std::copy(data.begin() + static_cast<std::ptrdiff_t>(half),
+                  data.begin() + static_cast<std::ptrdiff_t>(2 * half),
+                  details.begin());
+        // Spread from the back so that no approximation is overwritten early
+        for (std::size_t i = half; i-- > 0;) {
+            data[2 * i]     = data[i] / lifting.evenScale;
+            data[2 * i + 1] = details[i] / lifting.oddScale;
+        }
+        for (auto step = lifting.steps.rbegin(); step != lifting.steps.rend();
+             ++step) {
+            lift(data.data(), half, *step, -1.0);
+        }
+    }
+}
+
+/*
+ * PUBLIC METHODS
+ */
+
+TWaveletTransform::TWaveletTransform(
+    const TSignalLine*                  signalLine,
+    const std::optional<DWT::Wavelet>   wavelet,
+    const std::optional<std::size_t>    levels,
+    const std::optional<DWT::Threshold> threshold,
+    std::optional<std::string>          xLabel,
+    std::optional<std::string>          yLabel,
+    std::optional<std::string>          graphLabel)
+    : _params{.signalLine = signalLine,
+              .wavelet    = wavelet,
+              .levels     = levels,
+              .threshold  = threshold,
+              .xLabel     = std::move(xLabel),
+              .yLabel     = std::move(yLabel),
+              .graphLabel = std::move(graphLabel)} {}
+
+TWaveletTransform::TWaveletTransform(TWaveletTransformParams params)
+    : _params(std::move(params)) {}
+
+TWaveletTransform::TWaveletTransform(const TWaveletTransform& transform)
+    : _sl(transform._sl ? std::make_unique<TSignalLine>(*transform._sl)
+                        : nullptr),
+      _coefficients(transform._coefficients),
+      _thresholdValue(transform._thresholdValue),
+      _params(transform._params),
+      _isExecuted(transform._isExecuted) {}
+
+TWaveletTransform& TWaveletTransform::operator=(
+    const TWaveletTransform& transform) {
+    if (this == &transform) {
+        return *this;
+    }
+    _sl = transform._sl ? std::make_unique<TSignalLine>(*transform._sl)
+                        : nullptr;
+    _coefficients   = transform._coefficients;
+    _thresholdValue = transform._thresholdValue;
+    _params         = transform._params;
+    _isExecuted     = transform._isExecuted;
+    return *this;
+}
+
+const TSignalLine* TWaveletTransform::getSignalLine() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Wavelet transform not executed");
+    }
+    return _sl.get();
+}
+
+std::span<const double> TWaveletTransform::getApproximation() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Wavelet transform not executed");
+    }
+    const std::size_t levels = _params.levels.value_or(DWT::DEFAULT_LEVELS);
+    return {_coefficients.data(), _coefficients.size() >> levels};
+}
+
+std::span<const double> TWaveletTransform::getDetail(
+    const std::size_t level) const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Wavelet transform not executed");
+    }
+    const std::size_t levels = _params.levels.value_or(DWT::DEFAULT_LEVELS);
+    if (level == 0 || level > levels) {
+        throw SignalProcessingError("Level is out of range");
+    }
+    const std::size_t length = _coefficients.size() >> level;
+    return {_coefficients.data() + length, length};
+}
+
+double TWaveletTransform::getThresholdValue() const {
+    if (!_isExecuted) {
+        throw SignalProcessingError("Wavelet transform not executed");
+    }
+    return _thresholdValue;
+}
+
+const TWaveletTransformParams& TWaveletTransform::getParams() const {
+    return _params;
+}
+
+bool TWaveletTransform::isExecuted() const {
+    return _isExecuted;
+}
+
+void TWaveletTransform::execute() {
+    // We're ensuring that the signal line is not null here because it may be
+    // set after the TWaveletTransform object creation.
+    if (_params.signalLine == nullptr) {
+        throw SignalProcessingError("Invalid signal line (nullptr)");
+    }
+    const auto&       points      = _params.signalLine->getPoints();
+    const std::size_t pointsCount = points.size();
+    const std::size_t levels = _params.levels.value_or(DWT::DEFAULT_LEVELS);
+    const DWT::Wavelet wavelet =
+        _params.wavelet.value_or(DWT::DEFAULT_WAVELET);
+    if (levels == 0 || levels >= std::numeric_limits<std::size_t>::digits) {
+        throw SignalProcessingError("Invalid number of levels");
+    }
+    const std::size_t block = std::size_t{1} << levels;
+    if (pointsCount < block) {
+        throw SignalProcessingError("Insufficient number of points");
+    }
+
+    // Mirror the end of the line up to a multiple of 2^levels
+    const std::size_t   paddedCount = (pointsCount + block - 1) / block * block;
+    std::vector<double> data(paddedCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        data[i] = points[i].y;
+    }
+    for (std::size_t i = pointsCount; i < paddedCount; ++i) {
+        data[i] = points[2 * pointsCount - 2 - i].y;
+    }
+
+    DWT::decompose(data, wavelet, levels);
+    _coefficients = data;
+
+    const DWT::Threshold threshold =
+        _params.threshold.value_or(DWT::DEFAULT_THRESHOLD);
+    double value = 0.0;
+    if (threshold != DWT::Threshold::None) {
+        if (_params.thresholdValue) {
+            value = *_params.thresholdValue;
+        } else {
+            // Noise level from the median absolute finest detail
+            std::vector<double> finest(
+                data.begin() + static_cast<std::ptrdiff_t>(paddedCount / 2),
+                data.end());
+            for (double& coefficient : finest) {
+                coefficient = std::abs(coefficient);
+            }
+            const auto middle =
+                finest.begin() + static_cast<std::ptrdiff_t>(finest.size() / 2);
+            std::nth_element(finest.begin(), middle, finest.end());
+            const double sigma = *middle / DWT::MAD_SCALE;
+            value              = sigma * std::sqrt(2.0 * std::log(
+                                        static_cast<double>(pointsCount)));
+        }
+        if (value < 0.0) {
+            throw SignalProcessingError("Threshold should not be negative");
+        }
+
+        const bool isSoft = threshold == DWT::Threshold::Soft;
+        for (std::size_t i = paddedCount >> levels; i < paddedCount; ++i) {
+            const double magnitude = std::abs(data[i]);
+            if (magnitude <= value) {
+                data[i] = 0.0;
+            } else if (isSoft) {
+                data[i] = std::copysign(magnitude - value, data[i]);
+            }
+        }
+    }
+
+    DWT::reconstruct(data, wavelet, levels);
+
+    std::vector<Point> outputPoints(pointsCount);
+    for (std::size_t i = 0; i < pointsCount; ++i) {
+        outputPoints[i] = Point{.x = points[i].x, .y = data[i]};
+    }
+
+    TSignalLineParams slParams = _params.signalLine->getParams();
+    slParams.xLabel            = _params.xLabel;
+    slParams.yLabel            = _params.yLabel;
+    slParams.graphLabel        = _params.graphLabel;
+    slParams.pointsCount       = pointsCount;
+    _sl = std::make_unique<TSignalLine>(slParams,
+                                        SL::Preference::PreferPointsCount);
+    _sl->setPoints(std::move(outputPoints));
+    _thresholdValue = value;
+
+    _isExecuted = true;
+}
\ No newline at end of file
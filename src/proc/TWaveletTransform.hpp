@@ -0,0 +1,268 @@
+/**
+ * @file TWaveletTransform.hpp
+ * @author Vorontsov Ilya Aleksandrovich (ilvoron)
+ * @brief Contains the declaration of the TWaveletTransform class performing
+ * multilevel discrete wavelet decomposition and threshold denoising of signal
+ * lines.
+ * @version 2.2.0.0
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "TSignalLine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace DWT
+ * @brief Contains wavelet types, default parameters and the lifting
+ * transforms used for discrete wavelet analysis.
+ */
+namespace DWT {
+
+    /**
+     * @enum Wavelet
+     * @brief Enumerates the supported wavelets.
+     */
+    enum class Wavelet : std::uint8_t {
+        Haar,         ///< Haar wavelet (orthonormal).
+        Daubechies4,  ///< Daubechies wavelet with four taps (orthonormal).
+        CDF97         ///< Cohen-Daubechies-Feauveau 9/7 wavelet (biorthogonal).
+    };
+
+    /**
+     * @enum Threshold
+     * @brief Specifies how the detail coefficients are thresholded.
+     */
+    enum class Threshold : std::uint8_t {
+        None,  ///< Coefficients are kept.
+        Hard,  ///< Coefficients below the threshold are zeroed.
+        Soft   ///< Coefficients are shrunk towards zero by the threshold.
+    };
+
+    static constexpr auto DEFAULT_WAVELET =
+        Wavelet::Daubechies4;  ///< Default wavelet.
+    static constexpr std::size_t DEFAULT_LEVELS =
+        4;  ///< Default number of decomposition levels.
+    static constexpr auto DEFAULT_THRESHOLD =
+        Threshold::None;  ///< Default thresholding.
+    static constexpr double MAD_SCALE =
+        0.6745;  ///< Median absolute deviation of a unit normal distribution.
+    static const std::string DEFAULT_GRAPH_LABEL =
+        "Wavelet Reconstruction";  ///< Default graph label.
+
+    /**
+     * @brief Performs the multilevel forward transform in place.
+     * @details Every level lifts the leading approximation block in place and
+     * then packs its even (approximation) and odd (detail) samples into two
+     * contiguous halves, so each level runs over contiguous memory half the
+     * size of the previous one. The result has the layout
+     * `[aL | dL | ... | d2 | d1]`. Boundaries are periodic.
+     *
+     * @param data Samples, replaced by the coefficients (the size should be a
+     * multiple of `2^levels`).
+     * @param wavelet Wavelet.
+     * @param levels Number of levels.
+     *
+     * @throws SignalProcessingError If the size is not a positive multiple of
+     * `2^levels` or the wavelet is unknown.
+     */
+    void decompose(std::vector<double>& data,
+                   Wavelet              wavelet,
+                   std::size_t          levels);
+
+    /**
+     * @brief Performs the multilevel inverse transform in place.
+     *
+     * @param data Coefficients in the layout produced by `decompose()`,
+     * replaced by the samples.
+     * @param wavelet Wavelet.
+     * @param levels Number of levels.
+     *
+     * @throws SignalProcessingError If the size is not a positive multiple of
+     * `2^levels` or the wavelet is unknown.
+     */
+    void reconstruct(std::vector<double>& data,
+                     Wavelet              wavelet,
+                     std::size_t          levels);
+
+}  // namespace DWT
+
+/**
+ * @struct TWaveletTransformParams
+ * @brief Contains parameters used for discrete wavelet analysis.
+ */
+struct TWaveletTransformParams {
+    // Signal Parameters
+    const TSignalLine* signalLine =
+        nullptr;  ///< Pointer to the signal line to analyze.
+
+    // Calculation Parameters
+    std::optional<DWT::Wavelet> wavelet = DWT::DEFAULT_WAVELET;  ///< Wavelet.
+    std::optional<std::size_t> levels =
+        DWT::DEFAULT_LEVELS;  ///< Number of decomposition levels.
+    std::optional<DWT::Threshold> threshold =
+        DWT::DEFAULT_THRESHOLD;  ///< Thresholding of the detail coefficients.
+    std::optional<double> thresholdValue =
+        std::nullopt;  ///< Threshold. If not set, the universal threshold
+                       ///< `sigma * sqrt(2 * ln(N))` is used.
+
+    // Graphical Parameters
+    std::optional<std::string> xLabel =
+        SL::DEFAULT_X_LABEL;  ///< Label for the x-axis.
+    std::optional<std::string> yLabel =
+        SL::DEFAULT_Y_LABEL;  ///< Label for the y-axis.
+    std::optional<std::string> graphLabel =
+        DWT::DEFAULT_GRAPH_LABEL;  ///< Label for the graph.
+};
+
+/**
+ * @class TWaveletTransform
+ * @brief Class for the multilevel discrete wavelet decomposition of a signal
+ * line and its threshold denoising.
+ *
+ * @details The transform is computed with the lifting scheme (`DWT::decompose`)
+ * on a copy of the y values, mirrored at the end up to a multiple of
+ * `2^levels`. The detail coefficients of all levels are then optionally
+ * thresholded and the line is reconstructed. Without thresholding the
+ * reconstruction equals the input up to rounding.
+ *
+ * If no threshold value is given, the universal threshold
+ * `sigma * sqrt(2 * ln(N))` is used, where the noise level `sigma` is
+ * estimated as `median(|d1|) / 0.6745` from the finest details. This is meant
+ * for the orthonormal wavelets; the CDF 9/7 wavelet is close to orthonormal.
+ */
+class TWaveletTransform {
+   public:
+    /**
+     * @brief Constructs a TWaveletTransform with a signal line.
+     *
+     * @param signalLine Pointer to the signal line to analyze.
+     * @param wavelet Wavelet.
+     * @param levels Number of decomposition levels.
+     * @param threshold Thresholding of the detail coefficients.
+     * @param xLabel Label for the x-axis.
+     * @param yLabel Label for the y-axis.
+     * @param graphLabel Label for the graph.
+     */
+    explicit TWaveletTransform(
+        const TSignalLine*            signalLine,
+        std::optional<DWT::Wavelet>   wavelet    = DWT::DEFAULT_WAVELET,
+        std::optional<std::size_t>    levels     = DWT::DEFAULT_LEVELS,
+        std::optional<DWT::Threshold> threshold  = DWT::DEFAULT_THRESHOLD,
+        std::optional<std::string>    xLabel     = SL::DEFAULT_X_LABEL,
+        std::optional<std::string>    yLabel     = SL::DEFAULT_Y_LABEL,
+        std::optional<std::string>    graphLabel = DWT::DEFAULT_GRAPH_LABEL);
+
+    /**
+     * @brief Constructs a TWaveletTransform with transform parameters.
+     *
+     * @param params Structure containing the parameters of the transform.
+     */
+    explicit TWaveletTransform(TWaveletTransformParams params);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TWaveletTransform() = default;
+
+    /**
+     * @brief Copy constructor.
+     */
+    TWaveletTransform(const TWaveletTransform& transform);
+
+    /**
+     * @brief Default move constructor.
+     */
+    TWaveletTransform(TWaveletTransform&&) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TWaveletTransform& operator=(const TWaveletTransform& transform);
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TWaveletTransform& operator=(TWaveletTransform&&) noexcept = default;
+
+    /**
+     * @brief Retrieves the reconstructed (denoised) signal line.
+     *
+     * @return const TSignalLine* A pointer to the reconstructed signal line.
+     *
+     * @throw SignalProcessingError If the transform has not been executed.
+     */
+    [[nodiscard]] const TSignalLine* getSignalLine() const;
+
+    /**
+     * @brief Retrieves the approximation coefficients of the coarsest level.
+     *
+     * @return std::span<const double> The approximation coefficients.
+     *
+     * @throw SignalProcessingError If the transform has not been executed.
+     */
+    [[nodiscard]] std::span<const double> getApproximation() const;
+
+    /**
+     * @brief Retrieves the detail coefficients of a level (before
+     * thresholding).
+     *
+     * @param level Level within [1, levels]; level 1 is the finest.
+     * @return std::span<const double> The detail coefficients.
+     *
+     * @throw SignalProcessingError If the transform has not been executed or
+     * the level is out of range.
+     */
+    [[nodiscard]] std::span<const double> getDetail(std::size_t level) const;
+
+    /**
+     * @brief Retrieves the threshold applied to the detail coefficients.
+     *
+     * @return double The threshold (zero without thresholding).
+     *
+     * @throw SignalProcessingError If the transform has not been executed.
+     */
+    [[nodiscard]] double getThresholdValue() const;
+
+    /**
+     * @brief Retrieves the parameters of the transform.
+     *
+     * @return const TWaveletTransformParams& A constant reference to the
+     * parameters.
+     */
+    [[nodiscard]] const TWaveletTransformParams& getParams() const;
+
+    /**
+     * @brief Determines if the transform has been executed.
+     *
+     * @return bool True if the transform has been executed, false otherwise.
+     */
+    [[nodiscard]] bool isExecuted() const;
+
+    /**
+     * @brief Decomposes, thresholds and reconstructs the signal line.
+     *
+     * @throws SignalProcessingError If the signal line is null or has fewer
+     * points than `2^levels`, or if the parameters are invalid.
+     */
+    void execute();
+
+   private:
+    std::unique_ptr<TSignalLine> _sl =
+        nullptr;  ///< A unique pointer to the reconstructed signal line.
+    std::vector<double> _coefficients =
+        {};  ///< Coefficients in the layout `[aL | dL | ... | d1]`.
+    double _thresholdValue = 0.0;  ///< Applied threshold.
+    TWaveletTransformParams _params = {};  ///< Parameters of the transform.
+    bool _isExecuted = false;  ///< Flag indicating if the transform has been
+                               ///< executed.
+};
\ No newline at end of file